@@ -250,4 +250,68 @@ static void BM_Dataset_setData_replace(benchmark::State &state) {
 }
 BENCHMARK(BM_Dataset_setData_replace);
 
+// Data array with `n_coord` short coords, such that the cost of operations is
+// dominated by handling of the coord dict.
+DataArray make_data_array_with_coords(const scipp::index n_coord) {
+  DataArray da(makeCoordData({Dim::X, 8}));
+  for (scipp::index i = 0; i < n_coord; ++i)
+    da.coords().set(Dim("coord" + std::to_string(i)),
+                    makeCoordData({Dim::X, 8}));
+  return da;
+}
+
+static void Args_DataArray_coords(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(2)->Range(1, 64);
+}
+
+static void BM_DataArray_coord_access(benchmark::State &state) {
+  const auto da = make_data_array_with_coords(state.range(0));
+  // Last inserted coord, worst case for linear search.
+  const Dim dim("coord" + std::to_string(state.range(0) - 1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(da.coords()[dim]);
+  }
+  state.counters["coords"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_DataArray_coord_access)->Apply(Args_DataArray_coords);
+
+static void BM_DataArray_coords_contains(benchmark::State &state) {
+  const auto da = make_data_array_with_coords(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(da.coords().contains(Dim::Y));
+  }
+  state.counters["coords"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_DataArray_coords_contains)->Apply(Args_DataArray_coords);
+
+static void BM_DataArray_slice_all_coords(benchmark::State &state) {
+  const auto da = make_data_array_with_coords(state.range(0));
+  for (auto _ : state) {
+    const auto slice = da.slice({Dim::X, 2, 4});
+    for (const auto &item : slice.coords())
+      benchmark::DoNotOptimize(item.second);
+  }
+  state.counters["coords"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_DataArray_slice_all_coords)->Apply(Args_DataArray_coords);
+
+static void BM_DataArray_shallow_copy(benchmark::State &state) {
+  const auto da = make_data_array_with_coords(state.range(0));
+  for (auto _ : state) {
+    DataArray copy(da);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.counters["coords"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_DataArray_shallow_copy)->Apply(Args_DataArray_coords);
+
+static void BM_DataArray_deep_copy(benchmark::State &state) {
+  const auto da = make_data_array_with_coords(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(copy(da));
+  }
+  state.counters["coords"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_DataArray_deep_copy)->Apply(Args_DataArray_coords);
+
 BENCHMARK_MAIN();
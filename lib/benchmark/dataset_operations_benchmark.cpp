@@ -4,6 +4,7 @@
 #include <benchmark/benchmark.h>
 
 #include <numeric>
+#include <string>
 
 #include "scipp/dataset/dataset.h"
 #include "scipp/dataset/mean.h"
@@ -197,4 +198,55 @@ BENCHMARK_TEMPLATE(BM_Dataset_mean, Generate_3D_data)
     ->Ranges({/* Item count */ {16, 128},
               /* Masks count */ {1, 8}});
 
+Dataset make_dataset_with_many_items(const scipp::index item_count,
+                                     const scipp::index item_length) {
+  Dataset d;
+  d.setCoord(Dim::X, makeData<double>({Dim::X, item_length}));
+  for (scipp::index i = 0; i < item_count; ++i)
+    d.setData("spectrum" + std::to_string(i),
+              makeData<double>({Dim::X, item_length}));
+  return d;
+}
+
+static void BM_Dataset_binary_op(benchmark::State &state) {
+  const auto item_count = state.range(0);
+  const auto item_length = state.range(1);
+  const auto a = make_dataset_with_many_items(item_count, item_length);
+  const auto b = make_dataset_with_many_items(item_count, item_length);
+  for (auto _ : state) {
+    const auto result = a + b;
+    benchmark::DoNotOptimize(result);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * item_count * item_length);
+  state.SetBytesProcessed(state.iterations() * item_count * item_length * 3 *
+                          sizeof(double));
+}
+
+BENCHMARK(BM_Dataset_binary_op)
+    ->RangeMultiplier(4)
+    ->Ranges({/* Item count */ {16, 1024},
+              /* Item length */ {64, 4096}})
+    ->UseRealTime();
+
+static void BM_Dataset_binary_op_in_place(benchmark::State &state) {
+  const auto item_count = state.range(0);
+  const auto item_length = state.range(1);
+  auto a = make_dataset_with_many_items(item_count, item_length);
+  const auto b = make_dataset_with_many_items(item_count, item_length);
+  for (auto _ : state) {
+    a += b;
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * item_count * item_length);
+  state.SetBytesProcessed(state.iterations() * item_count * item_length * 3 *
+                          sizeof(double));
+}
+
+BENCHMARK(BM_Dataset_binary_op_in_place)
+    ->RangeMultiplier(4)
+    ->Ranges({/* Item count */ {16, 1024},
+              /* Item length */ {64, 4096}})
+    ->UseRealTime();
+
 BENCHMARK_MAIN();
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <benchmark/benchmark.h>
+
+#include "scipp/variable/reduction.h"
+#include "scipp/variable/variable.h"
+
+using namespace scipp;
+using namespace scipp::variable;
+
+namespace {
+/// 1e8 elements, reducing all but one of the three dims.
+Variable make_input() {
+  return makeVariable<double>(Dims{Dim::X, Dim::Y, Dim::Z},
+                              Shape{500, 400, 500});
+}
+
+std::vector<Dim> reduced_dims(const Variable &var, const int64_t keep) {
+  std::vector<Dim> dims;
+  for (const auto dim : var.dims())
+    if (dim != var.dims().label(keep))
+      dims.push_back(dim);
+  return dims;
+}
+} // namespace
+
+static void BM_sum_two_of_three_dims(benchmark::State &state) {
+  const auto var = make_input();
+  const auto dims = reduced_dims(var, state.range(0));
+  const bool single_pass = state.range(1);
+  for ([[maybe_unused]] auto _ : state) {
+    if (single_pass)
+      benchmark::DoNotOptimize(sum(var, dims));
+    else
+      benchmark::DoNotOptimize(sum(sum(var, dims[1]), dims[0]));
+  }
+  state.SetItemsProcessed(state.iterations() * var.dims().volume());
+  state.SetBytesProcessed(state.iterations() * var.dims().volume() *
+                          sizeof(double));
+  state.counters["kept-dim"] = state.range(0);
+  state.counters["single-pass"] = single_pass;
+}
+
+// Args: index of the dim that is *not* reduced, single pass or per dim
+BENCHMARK(BM_sum_two_of_three_dims)
+    ->ArgsProduct({{0, 1, 2}, {false, true}})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_mean_two_of_three_dims(benchmark::State &state) {
+  const auto var = make_input();
+  const auto dims = reduced_dims(var, state.range(0));
+  for ([[maybe_unused]] auto _ : state)
+    benchmark::DoNotOptimize(mean(var, dims));
+  state.SetItemsProcessed(state.iterations() * var.dims().volume());
+  state.counters["kept-dim"] = state.range(0);
+}
+
+BENCHMARK(BM_mean_two_of_three_dims)
+    ->DenseRange(0, 2)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -63,10 +63,70 @@ static void BM_dataset_slice_aggregate(benchmark::State &state) {
   state.SetItemsProcessed(state.iterations());
 }
 
+auto make_data_array(const scipp::index n_coord) {
+  const scipp::index n_spectrum = 1000;
+  const scipp::index n_bin = 100;
+  DataArray da(makeVariable<double>(Dims{Dim("spectrum"), Dim::X},
+                                    Shape{n_spectrum, n_bin}));
+  da.coords().set(Dim::X, makeVariable<double>(Dims{Dim::X}, Shape{n_bin + 1}));
+  for (scipp::index i = 1; i < n_coord; ++i)
+    da.coords().set(Dim("coord" + std::to_string(i)),
+                    makeVariable<double>(Dims{Dim("spectrum")},
+                                         Shape{n_spectrum}));
+  da.masks().set("mask", makeVariable<bool>(Dims{Dim("spectrum")},
+                                            Shape{n_spectrum}));
+  return da;
+}
+
+// Per-slice cost of slicing a spectrum out of a data array with many coords,
+// without accessing metadata.
+static void BM_data_array_slice(benchmark::State &state) {
+  const auto da = make_data_array(state.range(0));
+  const auto n_spectrum = da.dims()[Dim("spectrum")];
+  scipp::index i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(da.slice({Dim("spectrum"), i}));
+    i = (i + 1) % n_spectrum;
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["coords"] = static_cast<double>(state.range(0));
+}
+
+// Per-slice cost of slicing a spectrum and accessing a single coord.
+static void BM_data_array_slice_coord(benchmark::State &state) {
+  const auto da = make_data_array(state.range(0));
+  const auto n_spectrum = da.dims()[Dim("spectrum")];
+  scipp::index i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(da.slice({Dim("spectrum"), i}).coords()[Dim::X]);
+    i = (i + 1) % n_spectrum;
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["coords"] = static_cast<double>(state.range(0));
+}
+
+// Per-slice cost of slicing a spectrum and accessing all coords.
+static void BM_data_array_slice_all_coords(benchmark::State &state) {
+  const auto da = make_data_array(state.range(0));
+  const auto n_spectrum = da.dims()[Dim("spectrum")];
+  scipp::index i = 0;
+  for (auto _ : state) {
+    const auto slice = da.slice({Dim("spectrum"), i});
+    for (const auto &item : slice.coords())
+      benchmark::DoNotOptimize(item.second);
+    i = (i + 1) % n_spectrum;
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["coords"] = static_cast<double>(state.range(0));
+}
+
 BENCHMARK(BM_dataset_create_view);
 BENCHMARK(BM_dataset_slice);
 BENCHMARK(BM_dataset_slice_item);
 BENCHMARK(BM_dataset_slice_item_dims);
 BENCHMARK(BM_dataset_slice_aggregate);
+BENCHMARK(BM_data_array_slice)->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK(BM_data_array_slice_coord)->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK(BM_data_array_slice_all_coords)->RangeMultiplier(4)->Range(1, 64);
 
 BENCHMARK_MAIN();
@@ -7,6 +7,7 @@
 #include <random>
 
 #include "scipp/variable/bins.h"
+#include "scipp/variable/shape.h"
 #include "scipp/variable/transform.h"
 #include "scipp/variable/variable.h"
 
@@ -139,6 +140,51 @@ BENCHMARK(BM_transform_in_place_transposed)
     ->RangeMultiplier(2)
     ->Ranges({{1, 2ul << 18ul}, {false, true}});
 
+// Both dims are long, i.e., rows and columns do not fit into the cache. This
+// is processed in tiles.
+static void BM_transform_in_place_transposed_square(benchmark::State &state) {
+  const auto nx = state.range(0);
+  const auto n = nx * nx;
+  const bool use_variances = state.range(1);
+  auto a = makeBenchmarkVariable(Dimensions{{Dim::Y, nx}, {Dim::X, nx}},
+                                 use_variances);
+  auto b = makeBenchmarkVariable(Dimensions{{Dim::X, nx}, {Dim::Y, nx}},
+                                 use_variances);
+  static constexpr auto op{[](auto &a_, const auto &b_) { a_ *= b_; }};
+
+  for ([[maybe_unused]] auto _ : state) {
+    transform_in_place<Types>(a, b, op, "");
+  }
+
+  const scipp::index variance_factor = use_variances ? 2 : 1;
+  const scipp::index read_write_factor = 3;
+  state.SetItemsProcessed(state.iterations() * n * variance_factor);
+  state.SetBytesProcessed(state.iterations() * n * variance_factor *
+                          read_write_factor * sizeof(double));
+  state.counters["n"] = n;
+  state.counters["variances"] = use_variances;
+}
+
+BENCHMARK(BM_transform_in_place_transposed_square)
+    ->RangeMultiplier(4)
+    ->Ranges({{64, 8192}, {false, true}});
+
+static void BM_copy_transposed(benchmark::State &state) {
+  const auto nx = state.range(0);
+  const auto n = nx * nx;
+  const auto a = makeBenchmarkVariable(Dimensions{{Dim::Y, nx}, {Dim::X, nx}},
+                                       false);
+  const auto b = transpose(a);
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(copy(b));
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+  state.SetBytesProcessed(state.iterations() * n * 2 * sizeof(double));
+  state.counters["n"] = n;
+}
+
+BENCHMARK(BM_copy_transposed)->RangeMultiplier(4)->Range(64, 8192);
+
 static void BM_transform(benchmark::State &state) {
   run<false>(
       state,
@@ -198,6 +244,38 @@ BENCHMARK(BM_transform_slice)
     ->RangeMultiplier(2)
     ->Ranges({{1, 2 << 18}, {false, true}});
 
+// Small to medium 1-D operands, for which the setup cost of iteration is a
+// large part of the runtime. Contiguous operands with equal dims are iterated
+// using a single flat index, a broadcast operand requires MultiIndex.
+template <bool in_place>
+static void BM_transform_small(benchmark::State &state) {
+  const auto n = state.range(0);
+  const bool broadcast = state.range(1);
+  auto a = makeVariable<double>(Dims{Dim::X}, Shape{n});
+  const auto b = broadcast ? makeVariable<double>(Values{2.0})
+                           : makeVariable<double>(Dims{Dim::X}, Shape{n});
+  for ([[maybe_unused]] auto _ : state) {
+    if constexpr (in_place) {
+      transform_in_place<Types>(
+          a, b, [](auto &a_, const auto &b_) { a_ *= b_; }, "");
+    } else {
+      benchmark::DoNotOptimize(transform<Types>(
+          a, b, [](const auto &a_, const auto &b_) { return a_ * b_; }, ""));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+  state.counters["n"] = n;
+  state.counters["broadcast"] = broadcast;
+}
+
+// {false, true} -> broadcast
+BENCHMARK_TEMPLATE(BM_transform_small, false)
+    ->RangeMultiplier(4)
+    ->Ranges({{16, 1 << 17}, {false, true}});
+BENCHMARK_TEMPLATE(BM_transform_small, true)
+    ->RangeMultiplier(4)
+    ->Ranges({{16, 1 << 17}, {false, true}});
+
 // Arguments are:
 // range(0) -> ny
 // range(1) -> average nx (uniform distribution of events extents)
@@ -7,6 +7,7 @@
 #include "variable_common.h"
 
 #include "scipp/variable/operations.h"
+#include "scipp/variable/shape.h"
 #include "scipp/variable/variable.h"
 
 using namespace scipp;
@@ -215,4 +216,27 @@ static void BM_Variable_sin_deg(benchmark::State &state) {
 }
 BENCHMARK(BM_Variable_sin_deg);
 
+static void BM_Variable_concat(benchmark::State &state) {
+  const auto n_input = state.range(0);
+  const auto size = state.range(1);
+  const auto dim = state.range(2) ? Dim::X : Dim::Y;
+  const auto chunk = makeVariable<double>(Dims{Dim::X, Dim::Y},
+                                          Shape{size / 64, 64}, units::m);
+  const std::vector<Variable> inputs(n_input, chunk);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(concat(inputs, dim));
+  }
+  constexpr auto read_write_factor = 2;
+  state.SetItemsProcessed(state.iterations() * n_input * size);
+  state.SetBytesProcessed(state.iterations() * sizeof(double) * n_input *
+                          size * read_write_factor);
+  state.counters["outer"] = dim == Dim::X;
+}
+
+// Many small per-pulse chunks, and a few large arrays.
+BENCHMARK(BM_Variable_concat)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({{10000}, {64, 1024}, {0, 1}})
+    ->ArgsProduct({{4}, {1 << 20, 1 << 24}, {0, 1}});
+
 BENCHMARK_MAIN();
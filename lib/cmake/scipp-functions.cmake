@@ -191,6 +191,18 @@ scipp_function(
 scipp_function(
   "unary" bins bins_any SKIP_VARIABLE BASE_INCLUDE variable/reduction.h
 )
+scipp_function(
+  "unary" bins bins_median SKIP_VARIABLE BASE_INCLUDE variable/reduction.h
+)
+scipp_function(
+  "unary" bins bins_nanmedian SKIP_VARIABLE BASE_INCLUDE variable/reduction.h
+)
+scipp_function(
+  "unary" bins bins_argmin SKIP_VARIABLE BASE_INCLUDE variable/reduction.h
+)
+scipp_function(
+  "unary" bins bins_argmax SKIP_VARIABLE BASE_INCLUDE variable/reduction.h
+)
 setup_scipp_category(bins)
 
 scipp_function("reduction" reduction sum SKIP_VARIABLE)
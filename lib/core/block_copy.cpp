@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <algorithm>
+#include <cstring>
+
+#include <boost/container/small_vector.hpp>
+
+#include "scipp/core/block_copy.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/sizes.h"
+
+namespace scipp::core {
+
+bool BlockCopyPlan::add(const std::byte *src,
+                        const scipp::span<const scipp::index> src_strides,
+                        std::byte *dest,
+                        const scipp::span<const scipp::index> dest_strides,
+                        const scipp::span<const scipp::index> shape,
+                        const scipp::index elem_size) {
+  using small_vector = boost::container::small_vector<scipp::index, NDIM_STACK>;
+  small_vector sh;
+  small_vector s;
+  small_vector d;
+  for (scipp::index dim = 0; dim < scipp::size(shape); ++dim) {
+    if (shape[dim] == 0)
+      return true;
+    // Strides of length-1 dims are irrelevant and would prevent merging.
+    if (shape[dim] == 1)
+      continue;
+    sh.push_back(shape[dim]);
+    s.push_back(src_strides[dim]);
+    d.push_back(dest_strides[dim]);
+  }
+  // Merge inner dims that are contiguous in source and destination.
+  auto ndim = scipp::size(sh);
+  scipp::index run = 1;
+  while (ndim > 0 && s[ndim - 1] == run && d[ndim - 1] == run)
+    run *= sh[--ndim];
+  const auto block_bytes = run * elem_size;
+  if (ndim > 0 && block_bytes < min_block_bytes)
+    return false;
+
+  scipp::index nblock = 1;
+  for (scipp::index dim = 0; dim < ndim; ++dim)
+    nblock *= sh[dim];
+  m_blocks.reserve(m_blocks.size() + nblock);
+  m_ends.reserve(m_ends.size() + nblock);
+  small_vector pos(ndim, 0);
+  scipp::index src_offset = 0;
+  scipp::index dest_offset = 0;
+  for (scipp::index block = 0; block < nblock; ++block) {
+    m_blocks.push_back(
+        {src + src_offset * elem_size, dest + dest_offset * elem_size});
+    m_ends.push_back(bytes() + block_bytes);
+    for (auto dim = ndim - 1; dim >= 0; --dim) {
+      src_offset += s[dim];
+      dest_offset += d[dim];
+      if (++pos[dim] < sh[dim])
+        break;
+      src_offset -= s[dim] * sh[dim];
+      dest_offset -= d[dim] * sh[dim];
+      pos[dim] = 0;
+    }
+  }
+  return true;
+}
+
+void BlockCopyPlan::execute() const {
+  const auto copy_range = [this](const scipp::index begin,
+                                 const scipp::index end) {
+    auto i = std::upper_bound(m_ends.begin(), m_ends.end(), begin) -
+             m_ends.begin();
+    for (auto pos = begin; pos < end; ++i) {
+      const auto offset = pos - (i == 0 ? 0 : m_ends[i - 1]);
+      const auto n = std::min(m_ends[i], end) - pos;
+      std::memcpy(m_blocks[i].dest + offset, m_blocks[i].src + offset,
+                  static_cast<size_t>(n));
+      pos += n;
+    }
+  };
+  // Tasks are split by bytes, so large blocks are shared by multiple threads.
+  const auto size = bytes();
+  if (size <= parallel::min_items_per_task(1))
+    return copy_range(0, size);
+  parallel::parallel_for(
+      parallel::blocked_range(0, size, parallel::grainsize(size, 1)),
+      [&](const auto &range) { copy_range(range.begin(), range.end()); });
+}
+
+} // namespace scipp::core
@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include "scipp/core/categorical_string.h"
+
+namespace scipp::core {
+
+namespace {
+std::size_t hash_string(const std::string_view str) noexcept {
+  return std::hash<std::string_view>{}(str);
+}
+
+const categorical_string::Entry *empty() noexcept {
+  static const categorical_string::Entry entry{"", hash_string("")};
+  return &entry;
+}
+} // namespace
+
+categorical_string::categorical_string() noexcept : m_entry(empty()) {}
+
+categorical_string CategoricalDictionary::encode(const std::string_view str) {
+  if (str.empty())
+    return categorical_string{};
+  if (const auto it = m_index.find(str); it != m_index.end())
+    return categorical_string(it->second);
+  const auto &entry = m_entries.emplace_back(
+      categorical_string::Entry{std::string(str), hash_string(str)});
+  // Keys view the characters of the entry, which are never moved.
+  m_index.emplace(entry.str, &entry);
+  return categorical_string(&entry);
+}
+
+} // namespace scipp::core
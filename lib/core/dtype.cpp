@@ -9,9 +9,16 @@
 
 namespace scipp::core {
 
-bool is_int(DType tp) { return tp == dtype<int32_t> || tp == dtype<int64_t>; }
+bool is_int(DType tp) {
+  return tp == dtype<int32_t> || tp == dtype<int64_t> || tp == dtype<int8_t> ||
+         tp == dtype<int16_t> || tp == dtype<uint8_t> ||
+         tp == dtype<uint16_t> || tp == dtype<uint32_t> ||
+         tp == dtype<uint64_t>;
+}
 
-bool is_float(DType tp) { return tp == dtype<float> || tp == dtype<double>; }
+bool is_float(DType tp) {
+  return tp == dtype<float> || tp == dtype<double> || tp == dtype<float16>;
+}
 
 bool is_fundamental(DType tp) {
   return is_int(tp) || is_float(tp) || tp == dtype<bool>;
@@ -30,7 +37,9 @@ template <class... Ts> bool is_span_impl(DType tp) {
 } // namespace
 
 bool is_span(DType tp) {
-  return is_span_impl<double, float, int64_t, int32_t, bool, time_point>(tp);
+  return is_span_impl<double, float, int64_t, int32_t, bool, time_point,
+                      int8_t, int16_t, uint8_t, uint16_t, uint32_t, uint64_t,
+                      float16, categorical_string, std::string_view>(tp);
 }
 
 std::ostream &operator<<(std::ostream &os, const DType &dtype) {
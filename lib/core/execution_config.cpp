@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "scipp/core/execution_config.h"
+
+namespace scipp::core::parallel {
+
+namespace {
+std::mutex config_mutex;
+ExecutionConfig current_config;
+std::atomic<int64_t> config_version{0};
+// Cached to avoid locking in every `parallel_for`.
+std::atomic<scipp::index> cached_max_threads{0};
+std::atomic<scipp::index> cached_min_bytes_per_task{
+    ExecutionConfig{}.min_bytes_per_task};
+std::atomic<scipp::index> cached_tasks_per_thread{
+    ExecutionConfig{}.tasks_per_thread};
+
+void expect_non_negative(const scipp::index value, const std::string &name) {
+  if (value < 0)
+    throw std::invalid_argument("Execution config parameter '" + name +
+                                "' must not be negative, got " +
+                                std::to_string(value) + '.');
+}
+} // namespace
+
+ExecutionConfig execution_config() {
+  std::lock_guard<std::mutex> lock(config_mutex);
+  return current_config;
+}
+
+void set_execution_config(const ExecutionConfig &config) {
+  expect_non_negative(config.max_threads, "max_threads");
+  expect_non_negative(config.min_bytes_per_task, "min_bytes_per_task");
+  if (config.tasks_per_thread < 1)
+    throw std::invalid_argument(
+        "Execution config parameter 'tasks_per_thread' must be positive, got " +
+        std::to_string(config.tasks_per_thread) + '.');
+  std::lock_guard<std::mutex> lock(config_mutex);
+  current_config = config;
+  cached_max_threads = config.max_threads;
+  cached_min_bytes_per_task = config.min_bytes_per_task;
+  cached_tasks_per_thread = config.tasks_per_thread;
+  ++config_version;
+}
+
+int64_t execution_config_version() noexcept { return config_version; }
+
+scipp::index max_threads() {
+  if (const scipp::index n = cached_max_threads; n > 0)
+    return n;
+  return std::max(scipp::index(1),
+                  scipp::index(std::thread::hardware_concurrency()));
+}
+
+void set_max_threads(const scipp::index max_threads) {
+  auto config = execution_config();
+  config.max_threads = max_threads;
+  set_execution_config(config);
+}
+
+scipp::index min_items_per_task(const scipp::index bytes_per_item) {
+  return std::max(scipp::index(1),
+                  cached_min_bytes_per_task /
+                      std::max(scipp::index(1), bytes_per_item));
+}
+
+scipp::index grainsize(const scipp::index size,
+                       const scipp::index bytes_per_item) {
+  const scipp::index ntask = max_threads() * cached_tasks_per_thread;
+  return std::max(min_items_per_task(bytes_per_item),
+                  (size + ntask - 1) / ntask);
+}
+
+} // namespace scipp::core::parallel
@@ -30,8 +30,14 @@ element_to_string(const T &item,
   using std::to_string;
   if constexpr (std::is_same_v<T, std::string>)
     return {'"' + item + "\", "};
+  else if constexpr (std::is_same_v<T, categorical_string>)
+    return element_to_string(item.str());
+  else if constexpr (std::is_same_v<T, std::string_view>)
+    return element_to_string(std::string(item));
   else if constexpr (std::is_same_v<T, bool>)
     return core::to_string(item) + ", ";
+  else if constexpr (std::is_same_v<T, int8_t> || std::is_same_v<T, uint8_t>)
+    return to_string(static_cast<int32_t>(item)) + ", "; // not as char
   else if constexpr (std::is_same_v<T, scipp::core::time_point>) {
     return core::to_string(to_iso_date(item, unit.value())) + ", ";
   } else if constexpr (std::is_same_v<T, Eigen::Vector3d>) {
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "scipp-core_export.h"
+#include "scipp/common/index.h"
+#include "scipp/common/span.h"
+
+namespace scipp::core {
+
+/// Plan for copying many strided arrays of trivially copyable elements.
+///
+/// All copies are reduced to contiguous blocks of bytes when they are added.
+/// `execute` copies all blocks using `memcpy` in a single `parallel_for`,
+/// splitting work by bytes and not by blocks. Many small copies (such as the
+/// inputs of `concat`) thus share the overhead of threading, and large blocks
+/// are processed by multiple threads.
+class SCIPP_CORE_EXPORT BlockCopyPlan {
+public:
+  /// Add a copy of an array with given `shape`. Strides are given in elements
+  /// of `elem_size` bytes and dimensions ordered from outer to inner.
+  ///
+  /// Returns false and leaves the plan unchanged if the copy does not produce
+  /// contiguous blocks of at least `min_block_bytes`, e.g., if the inner
+  /// dimension is transposed or broadcast. Such copies should instead use
+  /// strided iteration.
+  bool add(const std::byte *src, scipp::span<const scipp::index> src_strides,
+           std::byte *dest, scipp::span<const scipp::index> dest_strides,
+           scipp::span<const scipp::index> shape, scipp::index elem_size);
+
+  /// Number of contiguous blocks.
+  [[nodiscard]] scipp::index size() const noexcept {
+    return scipp::size(m_blocks);
+  }
+  /// Total number of bytes to copy.
+  [[nodiscard]] scipp::index bytes() const noexcept {
+    return m_ends.empty() ? 0 : m_ends.back();
+  }
+
+  /// Copy all blocks. Destinations must not overlap with each other or with
+  /// any source.
+  void execute() const;
+
+  /// Blocks smaller than this are not worth a separate `memcpy`.
+  static constexpr scipp::index min_block_bytes = 64;
+
+private:
+  struct Block {
+    const std::byte *src;
+    std::byte *dest;
+  };
+  std::vector<Block> m_blocks;
+  /// End of each block in the concatenation of all blocks, in bytes.
+  std::vector<scipp::index> m_ends;
+};
+
+} // namespace scipp::core
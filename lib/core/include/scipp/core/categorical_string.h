@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+#include "scipp-core_export.h"
+
+namespace scipp::core {
+
+class CategoricalDictionary;
+
+/// Dictionary-encoded string.
+///
+/// The value is a code referring to an entry of a CategoricalDictionary, which
+/// stores each distinct string once together with its hash. Equal strings in
+/// the same dictionary share the same code, so copies do not allocate and
+/// hashing and comparison of elements from the same dictionary do not look at
+/// characters. This is intended for labels with few distinct values, such as
+/// sample or detector bank names, which are compared often, e.g., for
+/// grouping.
+///
+/// The dictionary must outlive all elements referring to it. Variables keep
+/// the dictionaries of their elements alive, see CategoricalStringArrayModel.
+class SCIPP_CORE_EXPORT categorical_string {
+public:
+  struct Entry {
+    std::string str;
+    std::size_t hash;
+  };
+
+  /// The empty string, which does not require a dictionary.
+  categorical_string() noexcept;
+
+  [[nodiscard]] const std::string &str() const noexcept { return m_entry->str; }
+  explicit operator const std::string &() const noexcept { return str(); }
+  explicit operator std::string_view() const noexcept { return str(); }
+
+  /// Equal codes imply equal strings. Strings from different dictionaries
+  /// may be equal despite different codes.
+  [[nodiscard]] const void *code() const noexcept { return m_entry; }
+  [[nodiscard]] std::size_t hash() const noexcept { return m_entry->hash; }
+
+  friend bool operator==(const categorical_string a,
+                         const categorical_string b) noexcept {
+    return a.m_entry == b.m_entry ||
+           (a.hash() == b.hash() && a.str() == b.str());
+  }
+  friend bool operator!=(const categorical_string a,
+                         const categorical_string b) noexcept {
+    return !(a == b);
+  }
+  /// Lexicographic order of the strings, not of the codes, such that sorted
+  /// groups are ordered as for std::string.
+  friend bool operator<(const categorical_string a,
+                        const categorical_string b) noexcept {
+    return a.m_entry != b.m_entry && a.str() < b.str();
+  }
+  friend bool operator>(const categorical_string a,
+                        const categorical_string b) noexcept {
+    return b < a;
+  }
+  friend bool operator<=(const categorical_string a,
+                         const categorical_string b) noexcept {
+    return !(b < a);
+  }
+  friend bool operator>=(const categorical_string a,
+                         const categorical_string b) noexcept {
+    return !(a < b);
+  }
+
+private:
+  friend class CategoricalDictionary;
+  explicit categorical_string(const Entry *entry) noexcept : m_entry(entry) {}
+
+  const Entry *m_entry;
+};
+
+static_assert(sizeof(categorical_string) == sizeof(void *));
+static_assert(std::is_trivially_copyable_v<categorical_string>);
+
+/// Storage of the distinct strings referred to by categorical_string.
+///
+/// Entries are never moved or removed, so codes remain valid as long as the
+/// dictionary exists. Not thread-safe, `encode` must not be called
+/// concurrently.
+class SCIPP_CORE_EXPORT CategoricalDictionary {
+public:
+  CategoricalDictionary() = default;
+  CategoricalDictionary(const CategoricalDictionary &) = delete;
+  CategoricalDictionary &operator=(const CategoricalDictionary &) = delete;
+
+  /// Return the code of `str`, adding it to the dictionary if required.
+  [[nodiscard]] categorical_string encode(std::string_view str);
+  /// Number of distinct strings, excluding the empty string.
+  [[nodiscard]] std::size_t size() const noexcept { return m_entries.size(); }
+
+private:
+  std::deque<categorical_string::Entry> m_entries;
+  std::unordered_map<std::string_view, const categorical_string::Entry *>
+      m_index;
+};
+
+} // namespace scipp::core
+
+namespace scipp {
+using core::categorical_string;
+} // namespace scipp
+
+namespace std {
+template <> struct hash<scipp::core::categorical_string> {
+  std::size_t
+  operator()(const scipp::core::categorical_string &x) const noexcept {
+    return x.hash();
+  }
+};
+} // namespace std
@@ -4,10 +4,13 @@
 /// @author Simon Heybrock
 #pragma once
 #include <functional>
+#include <string_view>
 #include <unordered_map>
 
 #include "scipp-core_export.h"
 #include "scipp/common/span.h"
+#include "scipp/core/categorical_string.h"
+#include "scipp/core/float16.h"
 #include "scipp/core/time_point.h"
 
 namespace scipp::core {
@@ -43,6 +46,15 @@ template <> inline constexpr DType dtype<std::string>{6};
 template <> inline constexpr DType dtype<time_point>{7};
 class SubbinSizes;
 template <> inline constexpr DType dtype<SubbinSizes>{10};
+template <> inline constexpr DType dtype<int8_t>{11};
+template <> inline constexpr DType dtype<int16_t>{12};
+template <> inline constexpr DType dtype<uint8_t>{13};
+template <> inline constexpr DType dtype<uint16_t>{14};
+template <> inline constexpr DType dtype<uint32_t>{15};
+template <> inline constexpr DType dtype<uint64_t>{16};
+template <> inline constexpr DType dtype<float16>{17};
+template <> inline constexpr DType dtype<categorical_string>{18};
+template <> inline constexpr DType dtype<std::string_view>{19};
 // span<T> start at 100
 template <> inline constexpr DType dtype<scipp::span<const double>>{100};
 template <> inline constexpr DType dtype<scipp::span<const float>>{101};
@@ -51,6 +63,17 @@ template <> inline constexpr DType dtype<scipp::span<const int32_t>>{103};
 template <> inline constexpr DType dtype<scipp::span<const bool>>{104};
 template <> inline constexpr DType dtype<scipp::span<const std::string>>{105};
 template <> inline constexpr DType dtype<scipp::span<const time_point>>{106};
+template <> inline constexpr DType dtype<scipp::span<const int8_t>>{107};
+template <> inline constexpr DType dtype<scipp::span<const int16_t>>{108};
+template <> inline constexpr DType dtype<scipp::span<const uint8_t>>{109};
+template <> inline constexpr DType dtype<scipp::span<const uint16_t>>{110};
+template <> inline constexpr DType dtype<scipp::span<const uint32_t>>{111};
+template <> inline constexpr DType dtype<scipp::span<const uint64_t>>{112};
+template <> inline constexpr DType dtype<scipp::span<const float16>>{113};
+template <>
+inline constexpr DType dtype<scipp::span<const categorical_string>>{114};
+template <>
+inline constexpr DType dtype<scipp::span<const std::string_view>>{115};
 // span<inline const T> start at 200
 template <> inline constexpr DType dtype<scipp::span<double>>{200};
 template <> inline constexpr DType dtype<scipp::span<float>>{201};
@@ -59,6 +82,16 @@ template <> inline constexpr DType dtype<scipp::span<int32_t>>{203};
 template <> inline constexpr DType dtype<scipp::span<bool>>{204};
 template <> inline constexpr DType dtype<scipp::span<std::string>>{205};
 template <> inline constexpr DType dtype<scipp::span<time_point>>{206};
+template <> inline constexpr DType dtype<scipp::span<int8_t>>{207};
+template <> inline constexpr DType dtype<scipp::span<int16_t>>{208};
+template <> inline constexpr DType dtype<scipp::span<uint8_t>>{209};
+template <> inline constexpr DType dtype<scipp::span<uint16_t>>{210};
+template <> inline constexpr DType dtype<scipp::span<uint32_t>>{211};
+template <> inline constexpr DType dtype<scipp::span<uint64_t>>{212};
+template <> inline constexpr DType dtype<scipp::span<float16>>{213};
+template <>
+inline constexpr DType dtype<scipp::span<categorical_string>>{214};
+template <> inline constexpr DType dtype<scipp::span<std::string_view>>{215};
 // std containers start at 300
 template <> inline constexpr DType dtype<std::pair<int32_t, int32_t>>{300};
 template <> inline constexpr DType dtype<std::pair<int64_t, int64_t>>{301};
@@ -92,6 +125,36 @@ inline constexpr DType dtype<std::unordered_map<core::time_point, int64_t>>{
 template <>
 inline constexpr DType dtype<std::unordered_map<core::time_point, int32_t>>{
     315};
+template <>
+inline constexpr DType dtype<std::unordered_map<int8_t, int64_t>>{316};
+template <>
+inline constexpr DType dtype<std::unordered_map<int8_t, int32_t>>{317};
+template <>
+inline constexpr DType dtype<std::unordered_map<int16_t, int64_t>>{318};
+template <>
+inline constexpr DType dtype<std::unordered_map<int16_t, int32_t>>{319};
+template <>
+inline constexpr DType dtype<std::unordered_map<uint8_t, int64_t>>{320};
+template <>
+inline constexpr DType dtype<std::unordered_map<uint8_t, int32_t>>{321};
+template <>
+inline constexpr DType dtype<std::unordered_map<uint16_t, int64_t>>{322};
+template <>
+inline constexpr DType dtype<std::unordered_map<uint16_t, int32_t>>{323};
+template <>
+inline constexpr DType dtype<std::unordered_map<uint32_t, int64_t>>{324};
+template <>
+inline constexpr DType dtype<std::unordered_map<uint32_t, int32_t>>{325};
+template <>
+inline constexpr DType dtype<std::unordered_map<uint64_t, int64_t>>{326};
+template <>
+inline constexpr DType dtype<std::unordered_map<uint64_t, int32_t>>{327};
+template <>
+inline constexpr DType
+    dtype<std::unordered_map<categorical_string, int64_t>>{328};
+template <>
+inline constexpr DType
+    dtype<std::unordered_map<categorical_string, int32_t>>{329};
 // scipp::variable types start at 1000
 // scipp::dataset types start at 2000
 // scipp::python types start at 3000
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "scipp/common/numeric.h"
+#include "scipp/common/overloaded.h"
+#include "scipp/common/span.h"
+#include "scipp/core/element/arg_list.h"
+#include "scipp/core/transform_common.h"
+#include "scipp/core/value_and_variance.h"
+#include "scipp/units/unit.h"
+
+namespace scipp::core::element {
+
+namespace arg_reduction_detail {
+template <class T> decltype(auto) values_of(const T &x) {
+  if constexpr (is_ValueAndVariance_v<T>)
+    return x.value; // variances do not affect the location of the extremum
+  else
+    return x;
+}
+
+/// Return the index of the first element preferred by `compare`, skipping
+/// masked elements. As in numpy, the first NaN is returned if there is one.
+/// The result is -1 if all elements are masked or the span is empty.
+template <class Compare, class T, class Mask>
+int64_t arg_extremum(const scipp::span<const T> &values, const Mask &mask,
+                     Compare compare) {
+  // (value, index) accumulator, the value is looked up via the index.
+  int64_t best = -1;
+  for (scipp::index i = 0; i < scipp::size(values); ++i) {
+    if constexpr (!std::is_same_v<Mask, std::nullptr_t>)
+      if (mask[i])
+        continue;
+    if (numeric::isnan(values[i]))
+      return i;
+    if (best < 0 || compare(values[i], values[best]))
+      best = i;
+  }
+  return best;
+}
+
+/// Write the `out.size()` largest elements of `values` into `out`, in
+/// descending order. Masked elements and NaN are skipped. If there are not
+/// enough elements the remainder is filled with NaN, or with the lowest value
+/// for integer types.
+template <class T, class Mask>
+void topk(const scipp::span<T> &out, const scipp::span<const T> &values,
+          const Mask &mask) {
+  thread_local std::vector<T> buffer;
+  buffer.clear();
+  for (scipp::index i = 0; i < scipp::size(values); ++i) {
+    if constexpr (!std::is_same_v<Mask, std::nullptr_t>)
+      if (mask[i])
+        continue;
+    if (!numeric::isnan(values[i]))
+      buffer.push_back(values[i]);
+  }
+  const auto end = std::partial_sort_copy(buffer.begin(), buffer.end(),
+                                          out.begin(), out.end(),
+                                          std::greater<T>());
+  std::fill(end, out.end(),
+            std::numeric_limits<T>::has_quiet_NaN
+                ? std::numeric_limits<T>::quiet_NaN()
+                : std::numeric_limits<T>::lowest());
+}
+
+template <class Compare> constexpr auto make_arg_extremum(Compare compare) {
+  return overloaded{
+      arg_list<scipp::span<const double>, scipp::span<const float>,
+               scipp::span<const int64_t>, scipp::span<const int32_t>>,
+      [](const units::Unit &) { return units::none; },
+      [compare](const auto &values) {
+        return arg_extremum(values_of(values), nullptr, compare);
+      }};
+}
+
+template <class Compare>
+constexpr auto make_masked_arg_extremum(Compare compare) {
+  return overloaded{
+      arg_list<std::tuple<scipp::span<const double>, scipp::span<const bool>>,
+               std::tuple<scipp::span<const float>, scipp::span<const bool>>,
+               std::tuple<scipp::span<const int64_t>, scipp::span<const bool>>,
+               std::tuple<scipp::span<const int32_t>, scipp::span<const bool>>>,
+      transform_flags::expect_no_variance_arg<1>,
+      [](const units::Unit &, const units::Unit &) { return units::none; },
+      [compare](const auto &values, const auto &mask) {
+        return arg_extremum(values_of(values), mask, compare);
+      }};
+}
+} // namespace arg_reduction_detail
+
+/// Index of the minimum in each span of values.
+constexpr auto argmin = arg_reduction_detail::make_arg_extremum(std::less{});
+/// Index of the maximum in each span of values.
+constexpr auto argmax = arg_reduction_detail::make_arg_extremum(std::greater{});
+/// Index of the minimum in each span of values, skipping masked elements.
+constexpr auto masked_argmin =
+    arg_reduction_detail::make_masked_arg_extremum(std::less{});
+/// Index of the maximum in each span of values, skipping masked elements.
+constexpr auto masked_argmax =
+    arg_reduction_detail::make_masked_arg_extremum(std::greater{});
+
+/// Fill each output span with the largest values of the input span.
+constexpr auto topk = overloaded{
+    arg_list<std::tuple<scipp::span<double>, scipp::span<const double>>,
+             std::tuple<scipp::span<float>, scipp::span<const float>>,
+             std::tuple<scipp::span<int64_t>, scipp::span<const int64_t>>,
+             std::tuple<scipp::span<int32_t>, scipp::span<const int32_t>>>,
+    transform_flags::expect_no_variance_arg<0>,
+    transform_flags::expect_no_variance_arg<1>,
+    [](units::Unit &out, const units::Unit &in) { out = in; },
+    [](auto &out, const auto &values) {
+      arg_reduction_detail::topk(out, values, nullptr);
+    }};
+
+/// Fill each output span with the largest unmasked values of the input span.
+constexpr auto masked_topk = overloaded{
+    arg_list<std::tuple<scipp::span<double>, scipp::span<const double>,
+                        scipp::span<const bool>>,
+             std::tuple<scipp::span<float>, scipp::span<const float>,
+                        scipp::span<const bool>>,
+             std::tuple<scipp::span<int64_t>, scipp::span<const int64_t>,
+                        scipp::span<const bool>>,
+             std::tuple<scipp::span<int32_t>, scipp::span<const int32_t>,
+                        scipp::span<const bool>>>,
+    transform_flags::expect_no_variance_arg<0>,
+    transform_flags::expect_no_variance_arg<1>,
+    transform_flags::expect_no_variance_arg<2>,
+    [](units::Unit &out, const units::Unit &in, const units::Unit &) {
+      out = in;
+    },
+    [](auto &out, const auto &values, const auto &mask) {
+      arg_reduction_detail::topk(out, values, mask);
+    }};
+
+} // namespace scipp::core::element
@@ -24,7 +24,11 @@ constexpr auto add_inplace_types =
              std::tuple<int64_t, int32_t>, std::tuple<int32_t, int64_t>,
              std::tuple<double, int64_t>, std::tuple<double, int32_t>,
              std::tuple<float, int64_t>, std::tuple<float, int32_t>,
-             std::tuple<double, bool>, std::tuple<int64_t, bool>, Extra...>;
+             std::tuple<double, bool>, std::tuple<int64_t, bool>,
+             std::tuple<int64_t, int16_t>, std::tuple<int64_t, int8_t>,
+             std::tuple<int64_t, uint32_t>, std::tuple<int64_t, uint16_t>,
+             std::tuple<int64_t, uint8_t>, uint64_t,
+             std::tuple<double, float16>, Extra...>;
 
 constexpr auto add_equals = overloaded{add_inplace_types<SubbinSizes>,
                                        [](auto &&a, const auto &b) { a += b; }};
@@ -38,6 +42,45 @@ constexpr auto nan_add_equals =
                    a += b;
                }};
 
+/// Types for accumulation with a boolean mask as third argument. Covers the
+/// types used by reductions, which accumulate float32 and float16 in float64
+/// and narrow integers in int64.
+constexpr auto masked_add_inplace_types =
+    arg_list<std::tuple<double, double, bool>, std::tuple<float, float, bool>,
+             std::tuple<int64_t, int64_t, bool>,
+             std::tuple<int32_t, int32_t, bool>,
+             std::tuple<Eigen::Vector3d, Eigen::Vector3d, bool>,
+             std::tuple<double, float, bool>,
+             std::tuple<int64_t, int32_t, bool>,
+             std::tuple<int64_t, bool, bool>,
+             std::tuple<int64_t, int16_t, bool>,
+             std::tuple<int64_t, int8_t, bool>,
+             std::tuple<int64_t, uint32_t, bool>,
+             std::tuple<int64_t, uint16_t, bool>,
+             std::tuple<int64_t, uint8_t, bool>,
+             std::tuple<uint64_t, uint64_t, bool>,
+             std::tuple<double, float16, bool>>;
+
+/// As add_equals, but skips elements where the mask (third argument) is true.
+constexpr auto masked_add_equals = overloaded{
+    masked_add_inplace_types, transform_flags::expect_no_variance_arg<2>,
+    [](auto &&a, const auto &b, const bool mask) {
+      if (!mask)
+        a += b;
+    }};
+
+/// As nan_add_equals, but skips elements where the mask (third argument) is
+/// true.
+constexpr auto masked_nan_add_equals = overloaded{
+    masked_add_inplace_types, transform_flags::expect_no_variance_arg<2>,
+    [](auto &&a, const auto &b, const bool mask) {
+      using numeric::isnan;
+      if (isnan(a))
+        a = std::decay_t<decltype(a)>{0}; // Force zero
+      if (!mask && !isnan(b))
+        a += b;
+    }};
+
 constexpr auto subtract_equals =
     overloaded{add_inplace_types<>, [](auto &&a, const auto &b) { a -= b; }};
 
@@ -9,6 +9,7 @@
 #include <numeric>
 
 #include "scipp/common/overloaded.h"
+#include "scipp/core/categorical_string.h"
 #include "scipp/core/eigen.h"
 #include "scipp/core/element/arg_list.h"
 #include "scipp/core/element/util.h"
@@ -95,7 +96,11 @@ template <class Index>
 static constexpr auto groups_to_map = overloaded{
     element::arg_list<scipp::span<const double>, scipp::span<const float>,
                       scipp::span<const int64_t>, scipp::span<const int32_t>,
+                      scipp::span<const int16_t>, scipp::span<const int8_t>,
+                      scipp::span<const uint64_t>, scipp::span<const uint32_t>,
+                      scipp::span<const uint16_t>, scipp::span<const uint8_t>,
                       scipp::span<const bool>, scipp::span<const std::string>,
+                      scipp::span<const categorical_string>,
                       scipp::span<const time_point>>,
     transform_flags::expect_no_variance_arg<0>,
     [](const units::Unit &u) { return u; },
@@ -124,10 +129,26 @@ static constexpr auto update_indices_by_grouping = overloaded{
                       update_indices_by_grouping_arg<int32_t, int64_t>,
                       update_indices_by_grouping_arg<int64_t, int32_t>,
                       update_indices_by_grouping_arg<int32_t, int32_t>,
+                      update_indices_by_grouping_arg<int64_t, int16_t>,
+                      update_indices_by_grouping_arg<int32_t, int16_t>,
+                      update_indices_by_grouping_arg<int64_t, int8_t>,
+                      update_indices_by_grouping_arg<int32_t, int8_t>,
+                      update_indices_by_grouping_arg<int64_t, uint64_t>,
+                      update_indices_by_grouping_arg<int32_t, uint64_t>,
+                      update_indices_by_grouping_arg<int64_t, uint32_t>,
+                      update_indices_by_grouping_arg<int32_t, uint32_t>,
+                      update_indices_by_grouping_arg<int64_t, uint16_t>,
+                      update_indices_by_grouping_arg<int32_t, uint16_t>,
+                      update_indices_by_grouping_arg<int64_t, uint8_t>,
+                      update_indices_by_grouping_arg<int32_t, uint8_t>,
                       update_indices_by_grouping_arg<int64_t, bool>,
                       update_indices_by_grouping_arg<int32_t, bool>,
                       update_indices_by_grouping_arg<int64_t, std::string>,
                       update_indices_by_grouping_arg<int32_t, std::string>,
+                      update_indices_by_grouping_arg<int64_t,
+                                                     categorical_string>,
+                      update_indices_by_grouping_arg<int32_t,
+                                                     categorical_string>,
                       update_indices_by_grouping_arg<int32_t, time_point>,
                       update_indices_by_grouping_arg<int64_t, time_point>>,
     [](units::Unit &indices, const units::Unit &coord,
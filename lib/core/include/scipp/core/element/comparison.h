@@ -8,6 +8,7 @@
 
 #include "scipp/common/numeric.h"
 #include "scipp/common/overloaded.h"
+#include "scipp/core/categorical_string.h"
 #include "scipp/core/eigen.h"
 #include "scipp/core/element/arg_list.h"
 #include "scipp/core/transform_common.h"
@@ -64,6 +65,7 @@ struct equality_types_t {
   constexpr void operator()() const noexcept;
   using types = decltype(std::tuple_cat(
       comparison_types_t::types{}, std::tuple<std::string>{},
+      std::tuple<categorical_string>{}, std::tuple<std::string_view>{},
       std::tuple<Eigen::Vector3d>{}, std::tuple<Eigen::Matrix3d>{}));
 };
 
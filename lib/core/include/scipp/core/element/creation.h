@@ -18,14 +18,24 @@ namespace scipp::core::element {
 
 constexpr auto special_like =
     overloaded{arg_list<double, float, int64_t, int32_t, bool, SubbinSizes,
-                        time_point, Eigen::Vector3d>,
+                        time_point, Eigen::Vector3d, int16_t, int8_t,
+                        uint64_t, uint32_t, uint16_t, uint8_t, float16>,
                [](const units::Unit &u) { return u; }};
 
+/// Zeros for accumulating sums. Narrow types are widened, so sums of booleans
+/// or narrow integers count into int64 and sums of float16 into float32.
 constexpr auto zeros_not_bool_like =
     overloaded{special_like, [](const auto &x) {
                  using T = std::decay_t<decltype(x)>;
-                 if constexpr (std::is_same_v<T, bool>)
+                 if constexpr (std::is_same_v<T, bool> ||
+                               std::is_same_v<T, int16_t> ||
+                               std::is_same_v<T, int8_t> ||
+                               std::is_same_v<T, uint32_t> ||
+                               std::is_same_v<T, uint16_t> ||
+                               std::is_same_v<T, uint8_t>)
                    return int64_t{0};
+                 else if constexpr (std::is_same_v<T, float16>)
+                   return float{0};
                  else
                    return zero_init<T>::value();
                }};
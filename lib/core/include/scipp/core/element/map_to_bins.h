@@ -6,6 +6,7 @@
 #include <limits>
 
 #include "scipp/common/overloaded.h"
+#include "scipp/core/categorical_string.h"
 #include "scipp/core/eigen.h"
 #include "scipp/core/element/arg_list.h"
 #include "scipp/core/element/util.h"
@@ -103,9 +104,20 @@ static constexpr auto bin = overloaded{
         bin_arg<float, int64_t>, bin_arg<float, int32_t>,
         bin_arg<int64_t, int64_t>, bin_arg<int64_t, int32_t>,
         bin_arg<int32_t, int64_t>, bin_arg<int32_t, int32_t>,
+        bin_arg<int16_t, int64_t>, bin_arg<int16_t, int32_t>,
+        bin_arg<int8_t, int64_t>, bin_arg<int8_t, int32_t>,
+        bin_arg<uint64_t, int64_t>, bin_arg<uint64_t, int32_t>,
+        bin_arg<uint32_t, int64_t>, bin_arg<uint32_t, int32_t>,
+        bin_arg<uint16_t, int64_t>, bin_arg<uint16_t, int32_t>,
+        bin_arg<uint8_t, int64_t>, bin_arg<uint8_t, int32_t>,
+        bin_arg<float16, int64_t>, bin_arg<float16, int32_t>,
         bin_arg<bool, int64_t>, bin_arg<bool, int32_t>,
         bin_arg<Eigen::Vector3d, int64_t>, bin_arg<Eigen::Vector3d, int32_t>,
         bin_arg<std::string, int64_t>, bin_arg<std::string, int32_t>,
+        bin_arg<categorical_string, int64_t>,
+        bin_arg<categorical_string, int32_t>,
+        bin_arg<std::string_view, int64_t>,
+        bin_arg<std::string_view, int32_t>,
         bin_arg<time_point, int64_t>, bin_arg<time_point, int32_t>>,
     transform_flags::expect_in_variance_if_out_variance,
     [](units::Unit &binned, const units::Unit &, const units::Unit &data,
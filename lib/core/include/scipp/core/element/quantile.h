@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "scipp/common/numeric.h"
+#include "scipp/common/overloaded.h"
+#include "scipp/common/span.h"
+#include "scipp/core/element/arg_list.h"
+#include "scipp/core/transform_common.h"
+#include "scipp/units/unit.h"
+
+namespace scipp::core::element {
+
+namespace quantile_detail {
+/// Result type of a quantile, integers are promoted to double.
+template <class T>
+using result_t = std::conditional_t<std::is_same_v<T, float>, float, double>;
+
+/// Return the q-quantile of `values` using linear interpolation between the
+/// closest ranks, matching numpy's default. `values` is partially reordered.
+///
+/// This is based on introselect (std::nth_element), i.e., O(N) on average, and
+/// is also used as fallback by the parallel selection of large reductions.
+template <class T> double select(std::vector<T> &values, const double q) {
+  if (values.empty())
+    return std::numeric_limits<double>::quiet_NaN();
+  const double pos = q * static_cast<double>(values.size() - 1);
+  const auto rank = static_cast<scipp::index>(std::floor(pos));
+  const auto nth = values.begin() + rank;
+  std::nth_element(values.begin(), nth, values.end());
+  const auto low = static_cast<double>(*nth);
+  if (const double frac = pos - static_cast<double>(rank); frac > 0.0) {
+    // nth_element guarantees that all elements after `nth` are not smaller.
+    const auto high =
+        static_cast<double>(*std::min_element(nth + 1, values.end()));
+    return low + frac * (high - low);
+  }
+  return low;
+}
+
+/// Per-thread scratch buffer, avoids an allocation for every output element.
+template <class T> std::vector<T> &scratch() {
+  thread_local std::vector<T> buffer;
+  buffer.clear();
+  return buffer;
+}
+
+template <bool SkipNaN, class T, class Mask>
+auto quantile(const scipp::span<const T> &values, const Mask &mask,
+              const double q) {
+  auto &buffer = scratch<T>();
+  buffer.reserve(values.size());
+  for (scipp::index i = 0; i < scipp::size(values); ++i) {
+    if constexpr (!std::is_same_v<Mask, std::nullptr_t>)
+      if (mask[i])
+        continue;
+    if (numeric::isnan(values[i])) {
+      if constexpr (SkipNaN)
+        continue;
+      else
+        return static_cast<result_t<T>>(values[i]);
+    }
+    buffer.push_back(values[i]);
+  }
+  return static_cast<result_t<T>>(select(buffer, q));
+}
+} // namespace quantile_detail
+
+/// Return an operator computing the q-quantile of each span of values.
+///
+/// If `SkipNaN` is false, the result is NaN if the span contains a NaN.
+template <bool SkipNaN> auto make_quantile(const double q) {
+  return overloaded{
+      arg_list<scipp::span<const double>, scipp::span<const float>,
+               scipp::span<const int64_t>, scipp::span<const int32_t>>,
+      transform_flags::expect_no_variance_arg<0>,
+      [](const units::Unit &u) { return u; },
+      [q](const auto &values) {
+        return quantile_detail::quantile<SkipNaN>(values, nullptr, q);
+      }};
+}
+
+/// Return an operator computing the q-quantile of each span of values,
+/// skipping elements where the corresponding span of mask values is true.
+template <bool SkipNaN> auto make_masked_quantile(const double q) {
+  return overloaded{
+      arg_list<std::tuple<scipp::span<const double>, scipp::span<const bool>>,
+               std::tuple<scipp::span<const float>, scipp::span<const bool>>,
+               std::tuple<scipp::span<const int64_t>, scipp::span<const bool>>,
+               std::tuple<scipp::span<const int32_t>, scipp::span<const bool>>>,
+      transform_flags::expect_no_variance_arg<0>,
+      transform_flags::expect_no_variance_arg<1>,
+      [](const units::Unit &u, const units::Unit &) { return u; },
+      [q](const auto &values, const auto &mask) {
+        return quantile_detail::quantile<SkipNaN>(values, mask, q);
+      }};
+}
+
+} // namespace scipp::core::element
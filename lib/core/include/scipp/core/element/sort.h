@@ -5,6 +5,7 @@
 #pragma once
 
 #include "scipp/common/overloaded.h"
+#include "scipp/core/categorical_string.h"
 #include "scipp/core/element/arg_list.h"
 #include "scipp/core/element/comparison.h"
 #include "scipp/core/time_point.h"
@@ -20,6 +21,8 @@ template <class Compare> constexpr auto make_sort(Compare compare) {
       core::element::arg_list<scipp::span<int64_t>, scipp::span<int32_t>,
                               scipp::span<double>, scipp::span<float>,
                               scipp::span<std::string>,
+                              scipp::span<categorical_string>,
+                              scipp::span<std::string_view>,
                               scipp::span<time_point>>,
       [](units::Unit &) {},
       [&compare](auto &range) {
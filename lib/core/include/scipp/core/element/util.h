@@ -8,6 +8,7 @@
 
 #include "scipp/common/numeric.h"
 #include "scipp/common/overloaded.h"
+#include "scipp/core/categorical_string.h"
 #include "scipp/core/element/arg_list.h"
 #include "scipp/core/subbin_sizes.h"
 #include "scipp/core/time_point.h"
@@ -68,6 +69,8 @@ constexpr auto issorted_common = overloaded{
         std::tuple<bool, double, double>, std::tuple<bool, float, float>,
         std::tuple<bool, int64_t, int64_t>, std::tuple<bool, int32_t, int32_t>,
         std::tuple<bool, std::string, std::string>,
+        std::tuple<bool, categorical_string, categorical_string>,
+        std::tuple<bool, std::string_view, std::string_view>,
         std::tuple<bool, time_point, time_point>>,
     transform_flags::expect_no_variance_arg<1>,
     [](units::Unit &out, const units::Unit &left, const units::Unit &right) {
@@ -26,6 +26,10 @@ auto make_unique_for_overwrite_array(const scipp::index size) {
 struct init_for_overwrite_t {};
 static constexpr auto init_for_overwrite = init_for_overwrite_t{};
 
+/// Tag for wrapping memory that must not be written in class element_array.
+struct read_only_t {};
+static constexpr auto read_only = read_only_t{};
+
 /// Internal data container for Variable.
 ///
 /// This provides a vector-like storage for arrays of elements in a variable.
@@ -38,7 +42,20 @@ static constexpr auto init_for_overwrite = init_for_overwrite_t{};
 /// - As a minor benefit, since the implementation has to store a pointer and a
 ///   size, we can at the same time support an "optional" behavior, as used for
 ///   the array of variances in a variable.
+/// - Arrays can wrap memory owned by another object, e.g., a buffer imported
+///   from another library, without copying.
 template <class T> class element_array {
+  /// Deletes owned memory, or releases the owner of wrapped memory.
+  struct deleter {
+    std::shared_ptr<const void> owner;
+    bool read_only{false};
+    void operator()(T *ptr) const noexcept {
+      if (!owner)
+        delete[] ptr;
+    }
+  };
+  using storage_type = std::unique_ptr<T[], deleter>;
+
 public:
   using value_type = T;
 
@@ -47,7 +64,9 @@ public:
   explicit element_array(const scipp::index new_size, const T &value = T()) {
     resize(new_size, init_for_overwrite);
     parallel::parallel_for(
-        parallel::blocked_range(0, size()), [&](const auto &range) {
+        parallel::blocked_range(0, size(),
+                                parallel::grainsize(size(), sizeof(T))),
+        [&](const auto &range) {
           std::fill(data() + range.begin(), data() + range.end(), value);
         });
   }
@@ -66,7 +85,8 @@ public:
     const scipp::index size = std::distance(first, last);
     resize(size, init_for_overwrite);
     parallel::parallel_for(
-        parallel::blocked_range(0, size), [&](const auto &range) {
+        parallel::blocked_range(0, size, parallel::grainsize(size, sizeof(T))),
+        [&](const auto &range) {
           std::copy(first + range.begin(), first + range.end(),
                     data() + range.begin());
         });
@@ -82,6 +102,31 @@ public:
   element_array(std::initializer_list<T> init)
       : element_array(init.begin(), init.end()) {}
 
+  /// Wrap `size` elements at `data` without copying. The memory is not freed
+  /// by the array, instead `owner` is kept alive as long as the array, or any
+  /// array it is moved into. Copies of the array own their data.
+  element_array(T *data, const scipp::index size,
+                std::shared_ptr<const void> owner)
+      : m_size(size), m_data(data, deleter{std::move(owner)}) {}
+
+  /// Wrap `size` elements at `data` like the above, for memory that must not
+  /// be written, e.g., buffers imported from another library. Users of the
+  /// array must copy it before writing, see `is_read_only`.
+  element_array(const T *data, const scipp::index size,
+                std::shared_ptr<const void> owner, const read_only_t &)
+      : m_size(size),
+        m_data(const_cast<T *>(data), deleter{std::move(owner), true}) {}
+
+  /// Return true if the array wraps memory it does not own.
+  [[nodiscard]] bool is_external() const noexcept {
+    return m_data.get_deleter().owner != nullptr;
+  }
+
+  /// Return true if the array wraps memory that must not be written.
+  [[nodiscard]] bool is_read_only() const noexcept {
+    return m_data.get_deleter().read_only;
+  }
+
   element_array(element_array &&other) noexcept
       : m_size(other.m_size), m_data(std::move(other.m_data)) {
     other.m_size = -1;
@@ -114,7 +159,7 @@ public:
   T *end() noexcept { return m_size < 0 ? begin() : data() + size(); }
 
   void reset() noexcept {
-    m_data.reset();
+    m_data = storage_type();
     m_size = -1;
   }
 
@@ -127,10 +172,11 @@ public:
   /// Resize with default-initialized elements. Use with care.
   void resize(const scipp::index new_size, const init_for_overwrite_t &) {
     if (new_size == 0) {
-      m_data.reset();
+      m_data = storage_type();
       m_size = 0;
     } else if (new_size != size()) {
-      m_data = make_unique_for_overwrite_array<T>(new_size);
+      m_data =
+          storage_type(make_unique_for_overwrite_array<T>(new_size).release());
       m_size = new_size;
     }
   }
@@ -146,7 +192,7 @@ private:
     }
   }
   scipp::index m_size{-1};
-  std::unique_ptr<T[]> m_data;
+  storage_type m_data;
 };
 
 } // namespace scipp::core
@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include "scipp-core_export.h"
+#include "scipp/common/index.h"
+
+/// Runtime configuration of multi-threading, honoured by all `parallel_for`.
+namespace scipp::core::parallel {
+
+struct SCIPP_CORE_EXPORT ExecutionConfig {
+  /// Maximum number of threads. 0 uses all available cores.
+  scipp::index max_threads{0};
+  /// Tasks are not made smaller than this, to limit threading overhead.
+  scipp::index min_bytes_per_task{32768};
+  /// Number of tasks per thread a range is split into, for load balancing.
+  scipp::index tasks_per_thread{4};
+};
+
+[[nodiscard]] SCIPP_CORE_EXPORT ExecutionConfig execution_config();
+/// Set the execution config. Parallel operations that are already running
+/// finish with the previous config.
+SCIPP_CORE_EXPORT void set_execution_config(const ExecutionConfig &config);
+/// Incremented on every change of the config, lets users cache derived state.
+[[nodiscard]] SCIPP_CORE_EXPORT int64_t execution_config_version() noexcept;
+
+/// Number of threads used by `parallel_for`.
+[[nodiscard]] SCIPP_CORE_EXPORT scipp::index max_threads();
+SCIPP_CORE_EXPORT void set_max_threads(const scipp::index max_threads);
+
+/// Smallest number of items of `bytes_per_item` bytes worth a separate task.
+[[nodiscard]] SCIPP_CORE_EXPORT scipp::index
+min_items_per_task(const scipp::index bytes_per_item = sizeof(double));
+
+/// Grain size for splitting `size` items of `bytes_per_item` bytes each.
+///
+/// Large ranges are split into `tasks_per_thread` tasks per thread, but no
+/// task processes less than `min_bytes_per_task`. Pass a large
+/// `bytes_per_item` if every item is expensive or of unknown size.
+[[nodiscard]] SCIPP_CORE_EXPORT scipp::index
+grainsize(const scipp::index size,
+          const scipp::index bytes_per_item = sizeof(double));
+
+} // namespace scipp::core::parallel
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+namespace scipp::core {
+
+/// IEEE 754 half-precision floating-point number.
+///
+/// This is a storage type: Values are converted to `float` for any
+/// computation, and back to half precision (rounding to nearest even) only
+/// when stored. The layout matches numpy's `float16`.
+class float16 {
+public:
+  float16() = default;
+  // Implicit like numpy, assigning a wider value rounds on storage.
+  float16(const float x) noexcept : m_bits(from_float(x)) {}
+  template <class T, class = std::enable_if_t<std::is_arithmetic_v<T>>>
+  float16(const T x) noexcept : float16(static_cast<float>(x)) {}
+
+  operator float() const noexcept { return to_float(m_bits); }
+
+  static float16 from_bits(const uint16_t bits) noexcept {
+    float16 x;
+    x.m_bits = bits;
+    return x;
+  }
+  [[nodiscard]] uint16_t bits() const noexcept { return m_bits; }
+
+  friend bool isnan(const float16 x) noexcept {
+    return (x.m_bits & 0x7fffu) > 0x7c00u;
+  }
+
+private:
+  static uint16_t from_float(const float value) noexcept {
+    uint32_t x;
+    std::memcpy(&x, &value, sizeof(x));
+    const auto sign = static_cast<uint16_t>((x >> 16) & 0x8000u);
+    x &= 0x7fffffffu;
+    if (x >= 0x7f800000u) // inf or NaN, keep NaN quiet
+      return sign | 0x7c00u | (x > 0x7f800000u ? 0x0200u : 0u);
+    if (x >= 0x477ff000u) // rounds to a value above the largest half
+      return sign | 0x7c00u;
+    if (x < 0x38800000u) { // subnormal half
+      if (x < 0x33000000u)
+        return sign;
+      const uint32_t shift = 126u - (x >> 23);
+      const uint32_t mantissa = (x & 0x7fffffu) | 0x800000u;
+      auto h = mantissa >> shift;
+      const uint32_t rest = mantissa & ((1u << shift) - 1u);
+      const uint32_t half = 1u << (shift - 1u);
+      if (rest > half || (rest == half && (h & 1u)))
+        ++h;
+      return sign | static_cast<uint16_t>(h);
+    }
+    // Normal half, rebias exponent from 127 to 15.
+    auto h = (x >> 13) - (112u << 10);
+    const uint32_t rest = x & 0x1fffu;
+    if (rest > 0x1000u || (rest == 0x1000u && (h & 1u)))
+      ++h; // may carry into the exponent, which is correct
+    return sign | static_cast<uint16_t>(h);
+  }
+
+  static float to_float(const uint16_t h) noexcept {
+    const uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+    uint32_t exponent = (h >> 10) & 0x1fu;
+    uint32_t mantissa = h & 0x3ffu;
+    uint32_t x;
+    if (exponent == 0x1fu) {
+      x = sign | 0x7f800000u | (mantissa << 13);
+    } else if (exponent != 0) {
+      x = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    } else if (mantissa == 0) {
+      x = sign;
+    } else { // subnormal half is a normal float
+      exponent = 113u;
+      while ((mantissa & 0x400u) == 0) {
+        mantissa <<= 1;
+        --exponent;
+      }
+      x = sign | (exponent << 23) | ((mantissa & 0x3ffu) << 13);
+    }
+    float value;
+    std::memcpy(&value, &x, sizeof(value));
+    return value;
+  }
+
+  uint16_t m_bits;
+};
+
+static_assert(sizeof(float16) == 2);
+static_assert(std::is_trivially_copyable_v<float16>);
+
+} // namespace scipp::core
+
+namespace scipp {
+using core::float16;
+} // namespace scipp
+
+namespace std {
+template <> class numeric_limits<scipp::core::float16> {
+  using T = scipp::core::float16;
+
+public:
+  static constexpr bool is_specialized = true;
+  static constexpr bool is_signed = true;
+  static constexpr bool is_integer = false;
+  static constexpr bool is_exact = false;
+  static constexpr bool has_infinity = true;
+  static constexpr bool has_quiet_NaN = true;
+  static constexpr int digits = 11;
+  static T min() noexcept { return T::from_bits(0x0400); }
+  static T max() noexcept { return T::from_bits(0x7bff); }
+  static T lowest() noexcept { return T::from_bits(0xfbff); }
+  static T epsilon() noexcept { return T::from_bits(0x1400); }
+  static T infinity() noexcept { return T::from_bits(0x7c00); }
+  static T quiet_NaN() noexcept { return T::from_bits(0x7e00); }
+};
+
+template <> struct hash<scipp::core::float16> {
+  std::size_t operator()(const scipp::core::float16 &x) const noexcept {
+    return std::hash<float>{}(x);
+  }
+};
+} // namespace std
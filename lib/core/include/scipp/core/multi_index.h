@@ -4,6 +4,7 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include <cstdlib>
 #include <functional>
 #include <numeric>
 #include <optional>
@@ -176,6 +177,33 @@ public:
     return false;
   }
 
+  /// Return true if the operands disagree on the memory order of the two
+  /// inner dims, e.g., in `a + transpose(b)`. In this case iterating in 2-D
+  /// tiles gives better cache locality than iterating in the order of the
+  /// first operand.
+  [[nodiscard]] bool prefers_tiling() const noexcept {
+    if (has_bins() || m_ndim < 2 || m_shape[0] < 2 || m_shape[1] < 2)
+      return false;
+    for (scipp::index data = 0; data < N; ++data) {
+      const auto inner = std::abs(m_stride[0][data]);
+      const auto outer = std::abs(m_stride[1][data]);
+      if (outer != 0 && outer < inner)
+        return true;
+    }
+    return false;
+  }
+
+  /// Number of (flattened) iteration dims, the inner dim first.
+  [[nodiscard]] scipp::index ndim() const noexcept { return m_ndim; }
+
+  [[nodiscard]] scipp::index shape(const scipp::index dim) const noexcept {
+    return m_shape[dim];
+  }
+
+  [[nodiscard]] const auto &strides(const scipp::index dim) const noexcept {
+    return m_stride[dim];
+  }
+
 private:
   [[nodiscard]] auto dim_at_end(const scipp::index dim) const noexcept {
     return m_coord[dim] == std::max(m_shape[dim], scipp::index{1});
@@ -7,6 +7,7 @@
 #include <algorithm>
 
 #include "scipp/common/index.h"
+#include "scipp/core/execution_config.h"
 
 /// Fallback wrappers without actual threading, in case TBB is not available.
 namespace scipp::core::parallel {
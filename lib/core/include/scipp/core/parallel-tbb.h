@@ -5,33 +5,53 @@
 #pragma once
 
 #include <algorithm>
+#include <memory>
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_sort.h>
+#include <tbb/task_arena.h>
 
+#include "scipp-core_export.h"
 #include "scipp/common/index.h"
+#include "scipp/core/execution_config.h"
 
 /// Wrappers for multi-threading using TBB.
 namespace scipp::core::parallel {
 
+/// Return a range with given grain size. By default the grain size is given
+/// by the execution config, see `parallel::grainsize`.
 inline auto blocked_range(const scipp::index begin, const scipp::index end,
                           const scipp::index grainsize = -1) {
   // TBB's default grain-size is 1, which is probably quite inefficient in
-  // some cases, in particular given the slow random-access of ViewIndex. A
-  // good default value is not known right now. In practice this should also
-  // depend heavily on whether we are processing small elements like `double`
-  // or something large like `event_list<double>`.
+  // some cases, in particular given the slow random-access of ViewIndex.
   return tbb::blocked_range<scipp::index>(
       begin, end,
-      grainsize == -1 ? std::max(scipp::index(1), (end - begin) / 24)
-                      : grainsize);
+      grainsize == -1 ? parallel::grainsize(end - begin) : grainsize);
 }
 
-template <class... Args> void parallel_for(Args &&...args) {
-  tbb::parallel_for(std::forward<Args>(args)...);
+/// Return the task arena limited to `max_threads()`, or nullptr if the number
+/// of threads is not limited. The returned pointer shares ownership, so the
+/// arena stays valid if the execution config is changed concurrently.
+[[nodiscard]] SCIPP_CORE_EXPORT std::shared_ptr<tbb::task_arena> task_arena();
+
+/// Run `op(range)`, split into tasks unless limited to a single thread, in
+/// which case `op` is called directly on the calling thread.
+template <class Range, class Op>
+void parallel_for(const Range &range, Op &&op) {
+  if (max_threads() == 1)
+    op(range);
+  else if (const auto arena = task_arena())
+    arena->execute([&]() { tbb::parallel_for(range, op); });
+  else
+    tbb::parallel_for(range, op);
 }
 
 template <class... Args> void parallel_sort(Args &&...args) {
-  tbb::parallel_sort(std::forward<Args>(args)...);
+  if (max_threads() == 1)
+    std::sort(std::forward<Args>(args)...);
+  else if (const auto arena = task_arena())
+    arena->execute([&]() { tbb::parallel_sort(std::forward<Args>(args)...); });
+  else
+    tbb::parallel_sort(std::forward<Args>(args)...);
 }
 
 } // namespace scipp::core::parallel
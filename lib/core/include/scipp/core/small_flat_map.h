@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <algorithm>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include <boost/container/small_vector.hpp>
+
+#include "scipp/common/index.h"
+
+namespace scipp::core {
+
+/// Map with linear lookup, storing items in insertion order in a small vector.
+///
+/// Intended for maps with few items, such as the coords of a data array. Unlike
+/// `small_stable_map` this is not limited in size and stores keys and values
+/// together. The interface is a subset of that of `std::unordered_map`.
+///
+/// Insertion may invalidate iterators and references, unless the number of
+/// items stays below the reserved capacity. Erasing preserves the order of the
+/// remaining items.
+template <class Key, class Value, unsigned Capacity = 4> class small_flat_map {
+public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<Key, Value>;
+  using storage_type = boost::container::small_vector<value_type, Capacity>;
+  using iterator = typename storage_type::iterator;
+  using const_iterator = typename storage_type::const_iterator;
+
+  small_flat_map() = default;
+  small_flat_map(std::initializer_list<value_type> items) {
+    insert(items.begin(), items.end());
+  }
+  template <class It> small_flat_map(It first, It last) { insert(first, last); }
+
+  [[nodiscard]] auto begin() noexcept { return m_items.begin(); }
+  [[nodiscard]] auto begin() const noexcept { return m_items.begin(); }
+  [[nodiscard]] auto cbegin() const noexcept { return m_items.cbegin(); }
+  [[nodiscard]] auto end() noexcept { return m_items.end(); }
+  [[nodiscard]] auto end() const noexcept { return m_items.end(); }
+  [[nodiscard]] auto cend() const noexcept { return m_items.cend(); }
+
+  [[nodiscard]] bool empty() const noexcept { return m_items.empty(); }
+  [[nodiscard]] scipp::index size() const noexcept {
+    return scipp::size(m_items);
+  }
+  void reserve(const scipp::index n) { m_items.reserve(n); }
+  void clear() noexcept { m_items.clear(); }
+
+  [[nodiscard]] iterator find(const Key &key) noexcept {
+    return std::find_if(begin(), end(), match(key));
+  }
+  [[nodiscard]] const_iterator find(const Key &key) const noexcept {
+    return std::find_if(begin(), end(), match(key));
+  }
+  [[nodiscard]] bool contains(const Key &key) const noexcept {
+    return find(key) != end();
+  }
+  [[nodiscard]] scipp::index count(const Key &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+
+  [[nodiscard]] Value &at(const Key &key) {
+    return const_cast<Value &>(std::as_const(*this).at(key));
+  }
+  [[nodiscard]] const Value &at(const Key &key) const {
+    const auto it = find(key);
+    if (it == end())
+      throw std::out_of_range("small_flat_map::at");
+    return it->second;
+  }
+  /// Return the value for `key`, inserting a default-constructed value if
+  /// there is none.
+  Value &operator[](const Key &key) {
+    return try_emplace(key).first->second;
+  }
+
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args) {
+    if (const auto it = find(key); it != end())
+      return {it, false};
+    m_items.emplace_back(std::piecewise_construct, std::forward_as_tuple(key),
+                         std::forward_as_tuple(std::forward<Args>(args)...));
+    return {std::prev(end()), true};
+  }
+  template <class K, class V>
+  std::pair<iterator, bool> emplace(K &&key, V &&value) {
+    return try_emplace(Key(std::forward<K>(key)), std::forward<V>(value));
+  }
+  std::pair<iterator, bool> insert(const value_type &item) {
+    return try_emplace(item.first, item.second);
+  }
+  /// Insert with ignored hint, for compatibility with `std::inserter`.
+  iterator insert(const_iterator, const value_type &item) {
+    return insert(item).first;
+  }
+  template <class It> void insert(It first, It last) {
+    for (; first != last; ++first)
+      try_emplace(first->first, first->second);
+  }
+  template <class V>
+  std::pair<iterator, bool> insert_or_assign(const Key &key, V &&value) {
+    if (const auto it = find(key); it != end()) {
+      it->second = std::forward<V>(value);
+      return {it, false};
+    }
+    return try_emplace(key, std::forward<V>(value));
+  }
+
+  iterator erase(const_iterator it) { return m_items.erase(it); }
+  scipp::index erase(const Key &key) {
+    const auto it = find(key);
+    if (it == end())
+      return 0;
+    erase(it);
+    return 1;
+  }
+
+  /// Return true if both maps contain the same items, in any order.
+  bool operator==(const small_flat_map &other) const {
+    return size() == other.size() &&
+           std::all_of(begin(), end(), [&other](const auto &item) {
+             const auto it = other.find(item.first);
+             return it != other.end() && it->second == item.second;
+           });
+  }
+  bool operator!=(const small_flat_map &other) const {
+    return !operator==(other);
+  }
+
+private:
+  static auto match(const Key &key) noexcept {
+    return [&key](const value_type &item) { return item.first == key; };
+  }
+
+  storage_type m_items;
+};
+
+} // namespace scipp::core
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <Eigen/Geometry>
+
+#include "scipp-core_export.h"
+#include "scipp/common/index.h"
+#include "scipp/common/span.h"
+
+/// Kernels for applying transformations to contiguous arrays of vectors.
+///
+/// Vectors are processed as flat arrays of interleaved x, y, z components, and
+/// the elements of a single transformation are held in registers for the
+/// entire array. This lets compilers vectorize across vectors, whereas the
+/// element-wise Eigen expressions used by `transform` reload the
+/// transformation for every vector since it may alias the output.
+///
+/// Transformations must have the size of the output or size 1, the latter is
+/// broadcast. Vectors must have the size of the output. Outputs must not
+/// overlap with any input.
+namespace scipp::core::spatial_kernels {
+
+SCIPP_CORE_EXPORT void multiply(scipp::span<const Eigen::Matrix3d> a,
+                                scipp::span<const Eigen::Vector3d> b,
+                                scipp::span<Eigen::Vector3d> out);
+SCIPP_CORE_EXPORT void multiply(scipp::span<const Eigen::Affine3d> a,
+                                scipp::span<const Eigen::Vector3d> b,
+                                scipp::span<Eigen::Vector3d> out);
+
+} // namespace scipp::core::spatial_kernels
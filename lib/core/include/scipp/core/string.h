@@ -45,4 +45,7 @@ SCIPP_CORE_EXPORT std::string to_iso_date(const scipp::core::time_point &item,
 /// Return the global dtype name registry instance
 SCIPP_CORE_EXPORT std::map<DType, std::string> &dtypeNameRegistry();
 
+/// Return the dtype registered with `name`, the inverse of `to_string`.
+SCIPP_CORE_EXPORT DType dtype_from_name(const std::string &name);
+
 } // namespace scipp::core
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "scipp/core/parallel-tbb.h"
+
+namespace scipp::core::parallel {
+
+std::shared_ptr<tbb::task_arena> task_arena() {
+  static std::mutex mutex;
+  static std::shared_ptr<tbb::task_arena> arena;
+  static std::atomic<int64_t> version{-1};
+  if (const auto current = execution_config_version(); version != current) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (version != current) {
+      const auto max_threads = execution_config().max_threads;
+      // Threads still executing in the previous arena keep it alive through
+      // the copies they obtained below.
+      std::atomic_store(&arena, max_threads > 0
+                                    ? std::make_shared<tbb::task_arena>(
+                                          static_cast<int>(max_threads))
+                                    : nullptr);
+      version = current;
+    }
+  }
+  return std::atomic_load(&arena);
+}
+
+} // namespace scipp::core::parallel
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <string>
+
+#include "scipp/core/except.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/spatial_kernels.h"
+
+namespace scipp::core::spatial_kernels {
+
+namespace {
+template <class T>
+void expect_size(const scipp::span<const T> in, const scipp::index size,
+                 const bool allow_broadcast) {
+  if (scipp::size(in) != size && !(allow_broadcast && scipp::size(in) == 1))
+    throw except::SizeError("Expected input of size " + std::to_string(size) +
+                            (allow_broadcast ? " or 1" : "") + ", got " +
+                            std::to_string(scipp::size(in)) + '.');
+}
+
+/// Compute `out = m * in (+ t)` for `n` vectors given as interleaved
+/// components. All elements of `m` and `t` are copied to locals, such that
+/// they are not reloaded in every iteration.
+template <bool Translate>
+void transform_vectors(const Eigen::Matrix3d &m, const Eigen::Vector3d &t,
+                       const double *in, double *out, const scipp::index n) {
+  const double m00 = m(0, 0), m01 = m(0, 1), m02 = m(0, 2);
+  const double m10 = m(1, 0), m11 = m(1, 1), m12 = m(1, 2);
+  const double m20 = m(2, 0), m21 = m(2, 1), m22 = m(2, 2);
+  const double t0 = t[0], t1 = t[1], t2 = t[2];
+  for (scipp::index i = 0; i < 3 * n; i += 3) {
+    const double x = in[i];
+    const double y = in[i + 1];
+    const double z = in[i + 2];
+    if constexpr (Translate) {
+      out[i] = m00 * x + m01 * y + m02 * z + t0;
+      out[i + 1] = m10 * x + m11 * y + m12 * z + t1;
+      out[i + 2] = m20 * x + m21 * y + m22 * z + t2;
+    } else {
+      out[i] = m00 * x + m01 * y + m02 * z;
+      out[i + 1] = m10 * x + m11 * y + m12 * z;
+      out[i + 2] = m20 * x + m21 * y + m22 * z;
+    }
+  }
+}
+
+template <class T>
+void transform_vectors(const T &a, const double *in, double *out,
+                       const scipp::index n) {
+  if constexpr (std::is_same_v<T, Eigen::Affine3d>)
+    transform_vectors<true>(a.linear(), a.translation(), in, out, n);
+  else
+    transform_vectors<false>(a, Eigen::Vector3d::Zero(), in, out, n);
+}
+
+template <class T>
+void multiply_impl(const scipp::span<const T> a,
+                   const scipp::span<const Eigen::Vector3d> b,
+                   const scipp::span<Eigen::Vector3d> out) {
+  const auto size = scipp::size(out);
+  expect_size(a, size, true);
+  expect_size(b, size, false);
+  if (size == 0)
+    return;
+  const auto *in = reinterpret_cast<const double *>(b.data());
+  auto *o = reinterpret_cast<double *>(out.data());
+  const auto run = [&](const scipp::index begin, const scipp::index end) {
+    if (scipp::size(a) == 1) {
+      transform_vectors(a[0], in + 3 * begin, o + 3 * begin, end - begin);
+    } else {
+      for (auto i = begin; i < end; ++i)
+        transform_vectors(a[i], in + 3 * i, o + 3 * i, 1);
+    }
+  };
+  constexpr scipp::index bytes_per_item = 2 * sizeof(Eigen::Vector3d);
+  if (size <= parallel::min_items_per_task(bytes_per_item))
+    return run(0, size);
+  parallel::parallel_for(
+      parallel::blocked_range(0, size,
+                              parallel::grainsize(size, bytes_per_item)),
+      [&](const auto &range) { run(range.begin(), range.end()); });
+}
+} // namespace
+
+void multiply(const scipp::span<const Eigen::Matrix3d> a,
+              const scipp::span<const Eigen::Vector3d> b,
+              const scipp::span<Eigen::Vector3d> out) {
+  multiply_impl(a, b, out);
+}
+
+void multiply(const scipp::span<const Eigen::Affine3d> a,
+              const scipp::span<const Eigen::Vector3d> b,
+              const scipp::span<Eigen::Vector3d> out) {
+  multiply_impl(a, b, out);
+}
+
+} // namespace scipp::core::spatial_kernels
@@ -71,6 +71,13 @@ std::map<DType, std::string> &dtypeNameRegistry() {
   return registry;
 }
 
+DType dtype_from_name(const std::string &name) {
+  for (const auto &[dtype, dtype_name] : dtypeNameRegistry())
+    if (dtype_name == name)
+      return dtype;
+  throw except::TypeError("Unknown dtype '" + name + "'.");
+}
+
 namespace {
 template <class Ratio> constexpr int64_t num_digits() {
   static_assert(Ratio::num == 1 || Ratio::num % 10 == 0);
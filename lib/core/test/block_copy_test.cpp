@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <vector>
+
+#include "scipp/core/block_copy.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+class BlockCopyPlanTest : public ::testing::Test {
+protected:
+  static auto bytes(const std::vector<double> &x) {
+    return reinterpret_cast<const std::byte *>(x.data());
+  }
+  static auto bytes(std::vector<double> &x) {
+    return reinterpret_cast<std::byte *>(x.data());
+  }
+  static constexpr scipp::index elem_size = sizeof(double);
+  std::vector<double> src = std::vector<double>(4 * 16);
+  std::vector<double> dest = std::vector<double>(4 * 16);
+  BlockCopyPlanTest() { std::iota(src.begin(), src.end(), 0.0); }
+};
+
+TEST_F(BlockCopyPlanTest, empty) {
+  BlockCopyPlan plan;
+  EXPECT_EQ(plan.size(), 0);
+  EXPECT_EQ(plan.bytes(), 0);
+  EXPECT_NO_THROW(plan.execute());
+}
+
+TEST_F(BlockCopyPlanTest, zero_volume) {
+  BlockCopyPlan plan;
+  EXPECT_TRUE(plan.add(bytes(src), std::vector<scipp::index>{16, 1},
+                       bytes(dest), std::vector<scipp::index>{16, 1},
+                       std::vector<scipp::index>{0, 16}, elem_size));
+  EXPECT_EQ(plan.size(), 0);
+}
+
+TEST_F(BlockCopyPlanTest, contiguous_is_single_block) {
+  BlockCopyPlan plan;
+  EXPECT_TRUE(plan.add(bytes(src), std::vector<scipp::index>{16, 1},
+                       bytes(dest), std::vector<scipp::index>{16, 1},
+                       std::vector<scipp::index>{4, 16}, elem_size));
+  EXPECT_EQ(plan.size(), 1);
+  EXPECT_EQ(plan.bytes(), 4 * 16 * elem_size);
+  plan.execute();
+  EXPECT_EQ(dest, src);
+}
+
+TEST_F(BlockCopyPlanTest, scalar) {
+  BlockCopyPlan plan;
+  EXPECT_TRUE(plan.add(bytes(src) + 3 * elem_size, {}, bytes(dest), {}, {},
+                       elem_size));
+  EXPECT_EQ(plan.size(), 1);
+  plan.execute();
+  EXPECT_EQ(dest[0], 3.0);
+}
+
+TEST_F(BlockCopyPlanTest, length_one_dims_are_ignored) {
+  BlockCopyPlan plan;
+  EXPECT_TRUE(plan.add(bytes(src), std::vector<scipp::index>{16, 7, 1},
+                       bytes(dest), std::vector<scipp::index>{16, 3, 1},
+                       std::vector<scipp::index>{4, 1, 16}, elem_size));
+  EXPECT_EQ(plan.size(), 1);
+}
+
+TEST_F(BlockCopyPlanTest, slice_gives_block_per_row) {
+  BlockCopyPlan plan;
+  // Copy the last 8 columns of src into the first 8 columns of dest.
+  EXPECT_TRUE(plan.add(bytes(src) + 8 * elem_size,
+                       std::vector<scipp::index>{16, 1}, bytes(dest),
+                       std::vector<scipp::index>{16, 1},
+                       std::vector<scipp::index>{4, 8}, elem_size));
+  EXPECT_EQ(plan.size(), 4);
+  plan.execute();
+  for (scipp::index row = 0; row < 4; ++row)
+    for (scipp::index col = 0; col < 16; ++col)
+      EXPECT_EQ(dest[row * 16 + col], col < 8 ? src[row * 16 + col + 8] : 0.0);
+}
+
+TEST_F(BlockCopyPlanTest, broadcast_outer_dim) {
+  BlockCopyPlan plan;
+  EXPECT_TRUE(plan.add(bytes(src), std::vector<scipp::index>{0, 1},
+                       bytes(dest), std::vector<scipp::index>{16, 1},
+                       std::vector<scipp::index>{4, 16}, elem_size));
+  plan.execute();
+  for (scipp::index row = 0; row < 4; ++row)
+    for (scipp::index col = 0; col < 16; ++col)
+      EXPECT_EQ(dest[row * 16 + col], src[col]);
+}
+
+TEST_F(BlockCopyPlanTest, rejects_transposed_and_broadcast_inner_dim) {
+  BlockCopyPlan plan;
+  EXPECT_FALSE(plan.add(bytes(src), std::vector<scipp::index>{1, 4},
+                        bytes(dest), std::vector<scipp::index>{4, 1},
+                        std::vector<scipp::index>{16, 4}, elem_size));
+  EXPECT_FALSE(plan.add(bytes(src), std::vector<scipp::index>{16, 0},
+                        bytes(dest), std::vector<scipp::index>{16, 1},
+                        std::vector<scipp::index>{4, 16}, elem_size));
+  EXPECT_EQ(plan.size(), 0);
+}
+
+TEST_F(BlockCopyPlanTest, rejects_small_blocks) {
+  BlockCopyPlan plan;
+  EXPECT_FALSE(plan.add(bytes(src), std::vector<scipp::index>{16, 1},
+                        bytes(dest), std::vector<scipp::index>{16, 1},
+                        std::vector<scipp::index>{4, 2}, elem_size));
+  EXPECT_EQ(plan.size(), 0);
+}
+
+TEST_F(BlockCopyPlanTest, many_inputs_large_enough_for_threading) {
+  const scipp::index n = 100000;
+  std::vector<double> a(n);
+  std::vector<double> b(n);
+  std::iota(a.begin(), a.end(), 0.0);
+  std::iota(b.begin(), b.end(), n);
+  std::vector<double> out(2 * n);
+  BlockCopyPlan plan;
+  // Interleave a and b in blocks of 1000 elements.
+  const std::vector<scipp::index> shape{n / 1000, 1000};
+  const std::vector<scipp::index> out_strides{2000, 1};
+  const std::vector<scipp::index> in_strides{1000, 1};
+  EXPECT_TRUE(plan.add(bytes(a), in_strides, bytes(out), out_strides, shape,
+                       elem_size));
+  EXPECT_TRUE(plan.add(bytes(b), in_strides, bytes(out) + 1000 * elem_size,
+                       out_strides, shape, elem_size));
+  EXPECT_EQ(plan.size(), 2 * n / 1000);
+  plan.execute();
+  for (scipp::index i = 0; i < n; ++i) {
+    EXPECT_EQ(out[(i / 1000) * 2000 + i % 1000], a[i]);
+    EXPECT_EQ(out[(i / 1000) * 2000 + 1000 + i % 1000], b[i]);
+  }
+}
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+#include "scipp/core/categorical_string.h"
+#include "scipp/core/dtype.h"
+#include "scipp/core/element/comparison.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+class CategoricalStringTest : public ::testing::Test {
+protected:
+  CategoricalDictionary dict;
+  auto encode(const std::string_view str) { return dict.encode(str); }
+};
+
+TEST_F(CategoricalStringTest, default_is_empty) {
+  EXPECT_EQ(categorical_string().str(), "");
+  EXPECT_EQ(categorical_string(), encode(""));
+  EXPECT_EQ(dict.size(), 0);
+}
+
+TEST_F(CategoricalStringTest, str) {
+  const auto a = encode("abc");
+  EXPECT_EQ(a.str(), "abc");
+  EXPECT_EQ(static_cast<const std::string &>(a), "abc");
+  EXPECT_EQ(static_cast<std::string_view>(a), "abc");
+}
+
+TEST_F(CategoricalStringTest, equal_strings_share_code) {
+  const std::string str("bank1");
+  const auto a = encode(str);
+  const auto b = encode("bank1");
+  EXPECT_EQ(a.code(), b.code());
+  EXPECT_EQ(a, b);
+  EXPECT_FALSE(a != b);
+  EXPECT_EQ(dict.size(), 1);
+}
+
+TEST_F(CategoricalStringTest, different_strings_differ) {
+  const auto a = encode("bank1");
+  const auto b = encode("bank2");
+  EXPECT_NE(a.code(), b.code());
+  EXPECT_NE(a, b);
+  EXPECT_FALSE(a == b);
+}
+
+TEST_F(CategoricalStringTest, equal_strings_from_different_dictionaries) {
+  CategoricalDictionary other;
+  const auto a = encode("bank1");
+  const auto b = other.encode("bank1");
+  EXPECT_NE(a.code(), b.code());
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(std::hash<categorical_string>{}(a),
+            std::hash<categorical_string>{}(b));
+  EXPECT_NE(a, other.encode("bank2"));
+}
+
+TEST_F(CategoricalStringTest, order_is_lexicographic) {
+  // Encode in reverse order to make it unlikely that codes happen to be
+  // ordered like the strings.
+  std::vector<categorical_string> strings{encode("d"), encode("c"),
+                                          encode("b"), encode("a")};
+  std::sort(strings.begin(), strings.end());
+  EXPECT_EQ(strings, (std::vector<categorical_string>{
+                         encode("a"), encode("b"), encode("c"), encode("d")}));
+  EXPECT_TRUE(encode("a") < encode("b"));
+  EXPECT_TRUE(encode("b") > encode("a"));
+  EXPECT_TRUE(encode("a") <= encode("a"));
+  EXPECT_TRUE(encode("a") >= encode("a"));
+  EXPECT_FALSE(encode("a") < encode("a"));
+}
+
+TEST_F(CategoricalStringTest, hash) {
+  std::unordered_set<categorical_string> set{encode("a"), encode("b"),
+                                             encode("a")};
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_EQ(set.count(encode("a")), 1);
+  EXPECT_EQ(set.count(encode("c")), 0);
+}
+
+TEST_F(CategoricalStringTest, dtype) {
+  EXPECT_NE(dtype<categorical_string>, dtype<std::string>);
+  EXPECT_FALSE(is_span(dtype<categorical_string>));
+  EXPECT_TRUE(is_span(dtype<scipp::span<const categorical_string>>));
+}
+
+TEST_F(CategoricalStringTest, element_equal) {
+  EXPECT_TRUE(element::equal(encode("a"), encode("a")));
+  EXPECT_FALSE(element::equal(encode("a"), encode("b")));
+}
@@ -9,6 +9,7 @@
 
 using scipp::core::element_array;
 using scipp::core::init_for_overwrite;
+using scipp::core::read_only;
 
 static auto make_element_array() {
   std::vector<double> v{1.1, 2.2, 3.3};
@@ -180,3 +181,57 @@ TEST(ElementArrayTest, resize_default_init) {
   x.resize(0, init_for_overwrite);
   check_empty_element_array(x);
 }
+
+TEST(ElementArrayTest, external_wraps_memory_without_copy) {
+  auto owner = std::make_shared<std::vector<float>>(3, 1.5f);
+  element_array<float> x(owner->data(), 3, owner);
+  ASSERT_TRUE(x.is_external());
+  ASSERT_EQ(x.size(), 3);
+  ASSERT_EQ(x.data(), owner->data());
+  const auto moved = std::move(x);
+  ASSERT_TRUE(moved.is_external());
+  ASSERT_EQ(moved.data(), owner->data());
+}
+
+TEST(ElementArrayTest, external_keeps_owner_alive) {
+  auto owner = std::make_shared<std::vector<float>>(3, 1.5f);
+  std::weak_ptr<std::vector<float>> weak = owner;
+  auto x = std::make_unique<element_array<float>>(owner->data(), 3, owner);
+  owner.reset();
+  ASSERT_FALSE(weak.expired());
+  ASSERT_EQ(x->data()[2], 1.5f);
+  x.reset();
+  ASSERT_TRUE(weak.expired());
+}
+
+TEST(ElementArrayTest, external_reset_releases_owner) {
+  auto owner = std::make_shared<std::vector<float>>(3, 1.5f);
+  std::weak_ptr<std::vector<float>> weak = owner;
+  element_array<float> x(owner->data(), 3, owner);
+  owner.reset();
+  x.reset();
+  ASSERT_TRUE(weak.expired());
+  ASSERT_FALSE(x.is_external());
+}
+
+TEST(ElementArrayTest, copy_of_external_owns_data) {
+  auto owner = std::make_shared<std::vector<float>>(3, 1.5f);
+  const element_array<float> x(owner->data(), 3, owner);
+  const element_array<float> copy(x);
+  ASSERT_FALSE(copy.is_external());
+  ASSERT_NE(copy.data(), x.data());
+  ASSERT_TRUE(std::equal(copy.begin(), copy.end(), x.begin(), x.end()));
+}
+
+TEST(ElementArrayTest, read_only_external) {
+  auto owner = std::make_shared<const std::vector<float>>(3, 1.5f);
+  const element_array<float> x(owner->data(), 3, owner, read_only);
+  ASSERT_TRUE(x.is_external());
+  ASSERT_TRUE(x.is_read_only());
+  ASSERT_EQ(x.data(), owner->data());
+  const element_array<float> copy(x);
+  ASSERT_FALSE(copy.is_read_only());
+  auto writable = std::make_shared<std::vector<float>>(3, 1.5f);
+  ASSERT_FALSE(
+      element_array<float>(writable->data(), 3, writable).is_read_only());
+}
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <limits>
+#include <thread>
+
+#include "scipp/core/execution_config.h"
+#include "scipp/core/parallel.h"
+
+using namespace scipp;
+using namespace scipp::core::parallel;
+
+class ExecutionConfigTest : public ::testing::Test {
+protected:
+  ~ExecutionConfigTest() override { set_execution_config(original); }
+  ExecutionConfig original = execution_config();
+};
+
+TEST_F(ExecutionConfigTest, max_threads_defaults_to_available_cores) {
+  set_max_threads(0);
+  EXPECT_GE(max_threads(), 1);
+}
+
+TEST_F(ExecutionConfigTest, set_max_threads) {
+  set_max_threads(3);
+  EXPECT_EQ(max_threads(), 3);
+  EXPECT_EQ(execution_config().max_threads, 3);
+}
+
+TEST_F(ExecutionConfigTest, set_increments_version) {
+  const auto version = execution_config_version();
+  set_execution_config(execution_config());
+  EXPECT_GT(execution_config_version(), version);
+}
+
+TEST_F(ExecutionConfigTest, negative_values_throw) {
+  EXPECT_THROW(set_max_threads(-1), std::invalid_argument);
+  ExecutionConfig config;
+  config.min_bytes_per_task = -1;
+  EXPECT_THROW(set_execution_config(config), std::invalid_argument);
+  config = ExecutionConfig{};
+  config.tasks_per_thread = 0;
+  EXPECT_THROW(set_execution_config(config), std::invalid_argument);
+}
+
+TEST_F(ExecutionConfigTest, grainsize_respects_min_bytes_per_task) {
+  set_execution_config({4, 8000, 2});
+  EXPECT_EQ(min_items_per_task(8), 1000);
+  EXPECT_EQ(min_items_per_task(80), 100);
+  EXPECT_EQ(grainsize(10, 8), 1000);
+  EXPECT_EQ(grainsize(10, 80), 100);
+}
+
+TEST_F(ExecutionConfigTest, grainsize_splits_large_ranges_per_thread) {
+  set_execution_config({4, 8000, 2});
+  // 4 threads with 2 tasks each
+  EXPECT_EQ(grainsize(80000, 8), 10000);
+  EXPECT_EQ(grainsize(80001, 8), 10001);
+  set_execution_config({8, 8000, 2});
+  EXPECT_EQ(grainsize(80000, 8), 5000);
+}
+
+TEST_F(ExecutionConfigTest, grainsize_of_expensive_items) {
+  set_execution_config({4, 8000, 2});
+  const auto large = std::numeric_limits<scipp::index>::max();
+  EXPECT_EQ(min_items_per_task(large), 1);
+  EXPECT_EQ(grainsize(3, large), 1);
+  EXPECT_EQ(grainsize(80, large), 10);
+}
+
+TEST_F(ExecutionConfigTest, single_thread_runs_inline) {
+  set_max_threads(1);
+  const auto caller = std::this_thread::get_id();
+  scipp::index calls = 0;
+  parallel_for(blocked_range(0, 1000, 1), [&](const auto &range) {
+    ++calls;
+    EXPECT_EQ(std::this_thread::get_id(), caller);
+    EXPECT_EQ(range.begin(), 0);
+    EXPECT_EQ(range.end(), 1000);
+  });
+  EXPECT_EQ(calls, 1);
+}
+
+TEST_F(ExecutionConfigTest, config_can_change_while_running) {
+  std::atomic<bool> done{false};
+  std::thread reconfigure([&]() {
+    for (scipp::index i = 0; !done; ++i)
+      set_max_threads(2 + i % 3);
+  });
+  for (scipp::index i = 0; i < 200; ++i) {
+    std::atomic<scipp::index> sum{0};
+    parallel_for(blocked_range(0, 1000, 10), [&](const auto &range) {
+      for (auto j = range.begin(); j != range.end(); ++j)
+        sum += j;
+    });
+    EXPECT_EQ(sum, 999 * 1000 / 2);
+  }
+  done = true;
+  reconfigure.join();
+}
@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "scipp/core/dtype.h"
+#include "scipp/core/float16.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+TEST(Float16Test, default_init_is_zero) {
+  EXPECT_EQ(float16{}.bits(), 0);
+  EXPECT_EQ(float(float16{}), 0.0f);
+}
+
+TEST(Float16Test, exact_values) {
+  for (const float x : {0.0f, 1.0f, -2.0f, 0.5f, 1024.0f, 65504.0f, -65504.0f})
+    EXPECT_EQ(float(float16(x)), x);
+  EXPECT_EQ(float16(1.0f).bits(), 0x3c00);
+  EXPECT_EQ(float16(-2.0f).bits(), 0xc000);
+}
+
+TEST(Float16Test, round_trip_all_bit_patterns) {
+  for (uint32_t bits = 0; bits <= 0xffff; ++bits) {
+    const auto x = float16::from_bits(static_cast<uint16_t>(bits));
+    if (isnan(x))
+      EXPECT_TRUE(std::isnan(float(x)));
+    else
+      EXPECT_EQ(float16(float(x)).bits(), bits);
+  }
+}
+
+TEST(Float16Test, rounds_to_nearest_even) {
+  // 2049 is halfway between 2048 and 2050, 2051 between 2050 and 2052.
+  EXPECT_EQ(float(float16(2049.0f)), 2048.0f);
+  EXPECT_EQ(float(float16(2051.0f)), 2052.0f);
+  EXPECT_EQ(float(float16(2049.5f)), 2050.0f);
+}
+
+TEST(Float16Test, overflow_and_underflow) {
+  EXPECT_TRUE(std::isinf(float(float16(65520.0f))));
+  EXPECT_EQ(float(float16(65519.0f)), 65504.0f);
+  EXPECT_EQ(float(float16(1e-8f)), 0.0f);
+  EXPECT_TRUE(std::signbit(float(float16(-1e-8f))));
+  // Smallest subnormal.
+  EXPECT_EQ(float(float16(std::ldexp(1.0f, -24))), std::ldexp(1.0f, -24));
+}
+
+TEST(Float16Test, special_values) {
+  const float inf = std::numeric_limits<float>::infinity();
+  EXPECT_EQ(float(float16(inf)), inf);
+  EXPECT_EQ(float(float16(-inf)), -inf);
+  EXPECT_TRUE(isnan(float16(std::numeric_limits<float>::quiet_NaN())));
+  EXPECT_TRUE(isnan(std::numeric_limits<float16>::quiet_NaN()));
+  EXPECT_FALSE(isnan(std::numeric_limits<float16>::infinity()));
+  EXPECT_EQ(float(std::numeric_limits<float16>::max()), 65504.0f);
+  EXPECT_EQ(float(std::numeric_limits<float16>::lowest()), -65504.0f);
+  EXPECT_EQ(float(std::numeric_limits<float16>::epsilon()),
+            std::ldexp(1.0f, -10));
+}
+
+TEST(Float16Test, widens_on_compute) {
+  const float16 a(1.5f);
+  const float16 b(2.25f);
+  EXPECT_EQ(a + b, 3.75f);
+  EXPECT_EQ(1.0 + a, 2.5);
+  EXPECT_TRUE(a < b);
+  EXPECT_EQ(static_cast<int64_t>(float16(-3.0f)), -3);
+  EXPECT_EQ(float(float16(int64_t{7})), 7.0f);
+}
+
+TEST(Float16Test, hash_matches_equality) {
+  EXPECT_EQ(std::hash<float16>{}(float16(0.0f)),
+            std::hash<float16>{}(float16(-0.0f)));
+}
+
+TEST(Float16Test, dtype) {
+  EXPECT_TRUE(is_float(dtype<float16>));
+  EXPECT_FALSE(is_int(dtype<float16>));
+  EXPECT_TRUE(is_span(dtype<scipp::span<const float16>>));
+  EXPECT_FALSE(canHaveVariances<float16>());
+  for (const auto type : {dtype<int8_t>, dtype<int16_t>, dtype<uint8_t>,
+                          dtype<uint16_t>, dtype<uint32_t>, dtype<uint64_t>})
+    EXPECT_TRUE(is_int(type));
+}
@@ -175,6 +175,18 @@ TEST_F(MultiIndexTest, 2d_transpose) {
   check(MultiIndex<1>(yx, make_strides(yx, xy)), {0, 3, 1, 4, 2, 5});
 }
 
+TEST_F(MultiIndexTest, prefers_tiling) {
+  EXPECT_FALSE(MultiIndex(yx, make_strides(yx, yx)).prefers_tiling());
+  EXPECT_FALSE(MultiIndex(yx, make_strides(yx, yx), make_strides(yx, x))
+                   .prefers_tiling());
+  EXPECT_FALSE(MultiIndex(xz, make_strides(xz, xyz)).prefers_tiling());
+  EXPECT_TRUE(MultiIndex(yx, make_strides(yx, yx), make_strides(yx, xy))
+                  .prefers_tiling());
+  EXPECT_TRUE(MultiIndex(xy, make_strides(xy, xy), make_strides(xy, yx))
+                  .prefers_tiling());
+  EXPECT_FALSE(MultiIndex(x, make_strides(x, xy)).prefers_tiling());
+}
+
 TEST_F(MultiIndexTest, slice_and_broadcast) {
   check(MultiIndex(xz, make_strides(xz, yx)), {0, 0, 0, 0, 1, 1, 1, 1});
   check(MultiIndex(xz, make_strides(xz, xy)), {0, 0, 0, 0, 3, 3, 3, 3});
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "scipp/core/small_flat_map.h"
+
+using namespace scipp;
+
+using Map = core::small_flat_map<std::string, int, 2>;
+
+namespace {
+std::vector<std::string> keys(const Map &map) {
+  std::vector<std::string> out;
+  for (const auto &[key, value] : map)
+    out.push_back(key);
+  return out;
+}
+} // namespace
+
+TEST(SmallFlatMapTest, empty) {
+  Map map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_EQ(map.find("a"), map.end());
+  EXPECT_FALSE(map.contains("a"));
+  EXPECT_THROW(static_cast<void>(map.at("a")), std::out_of_range);
+}
+
+TEST(SmallFlatMapTest, preserves_insertion_order) {
+  Map map{{"c", 1}, {"a", 2}};
+  map.emplace("b", 3);
+  map["d"] = 4;
+  EXPECT_EQ(keys(map), (std::vector<std::string>{"c", "a", "b", "d"}));
+  map.erase("a");
+  EXPECT_EQ(keys(map), (std::vector<std::string>{"c", "b", "d"}));
+}
+
+TEST(SmallFlatMapTest, insert_does_not_overwrite) {
+  Map map{{"a", 1}, {"a", 2}};
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(map.at("a"), 1);
+  EXPECT_FALSE(map.emplace("a", 3).second);
+  EXPECT_FALSE(map.try_emplace("a", 3).second);
+  EXPECT_FALSE(map.insert({"a", 3}).second);
+  EXPECT_EQ(map.at("a"), 1);
+}
+
+TEST(SmallFlatMapTest, insert_or_assign) {
+  Map map;
+  EXPECT_TRUE(map.insert_or_assign("a", 1).second);
+  EXPECT_FALSE(map.insert_or_assign("a", 2).second);
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(map.at("a"), 2);
+}
+
+TEST(SmallFlatMapTest, operator_bracket_inserts_default) {
+  Map map;
+  EXPECT_EQ(map["a"], 0);
+  EXPECT_EQ(map.size(), 1);
+  map["a"] += 2;
+  EXPECT_EQ(map.at("a"), 2);
+}
+
+TEST(SmallFlatMapTest, erase) {
+  Map map{{"a", 1}, {"b", 2}};
+  EXPECT_EQ(map.erase("c"), 0);
+  EXPECT_EQ(map.erase("a"), 1);
+  EXPECT_FALSE(map.contains("a"));
+  EXPECT_EQ(map.count("b"), 1);
+  map.erase(map.find("b"));
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(SmallFlatMapTest, grows_beyond_inline_capacity) {
+  Map map;
+  for (int i = 0; i < 10; ++i)
+    map.emplace(std::to_string(i), i);
+  EXPECT_EQ(map.size(), 10);
+  for (int i = 0; i < 10; ++i)
+    EXPECT_EQ(map.at(std::to_string(i)), i);
+}
+
+TEST(SmallFlatMapTest, reserve_keeps_references_valid) {
+  Map map{{"a", 1}};
+  map.reserve(10);
+  const auto &a = map.at("a");
+  for (int i = 0; i < 9; ++i)
+    map.emplace(std::to_string(i), i);
+  EXPECT_EQ(&a, &map.at("a"));
+}
+
+TEST(SmallFlatMapTest, comparison_ignores_order) {
+  const Map a{{"a", 1}, {"b", 2}};
+  const Map b{{"b", 2}, {"a", 1}};
+  const Map c{{"a", 1}, {"b", 3}};
+  const Map d{{"a", 1}};
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+  EXPECT_NE(a, d);
+  EXPECT_NE(d, a);
+}
+
+TEST(SmallFlatMapTest, inserter) {
+  const std::vector<std::pair<std::string, int>> items{{"a", 1}, {"b", 2}};
+  Map map;
+  std::copy(items.begin(), items.end(), std::inserter(map, map.end()));
+  EXPECT_EQ(map, Map(items.begin(), items.end()));
+  EXPECT_EQ(keys(map), (std::vector<std::string>{"a", "b"}));
+}
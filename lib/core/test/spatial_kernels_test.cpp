@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "scipp/core/except.h"
+#include "scipp/core/spatial_kernels.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+namespace {
+// Large enough to be split into multiple tasks.
+constexpr scipp::index n_elem = 100003;
+
+std::vector<Eigen::Vector3d> make_vectors(const scipp::index n,
+                                          const double offset) {
+  std::vector<Eigen::Vector3d> vectors;
+  for (scipp::index i = 0; i < n; ++i)
+    vectors.emplace_back(i + offset, 2.0 - 0.5 * i, offset * i);
+  return vectors;
+}
+
+std::vector<Eigen::Matrix3d> make_matrices(const scipp::index n) {
+  std::vector<Eigen::Matrix3d> matrices;
+  for (scipp::index i = 0; i < n; ++i) {
+    Eigen::Matrix3d m;
+    m << 1.0 + i, 2.0, 3.0, -4.0, 5.0 * i, 6.0, 7.0, 8.0, 9.0 - i;
+    matrices.push_back(m);
+  }
+  return matrices;
+}
+
+std::vector<Eigen::Affine3d> make_affines(const scipp::index n) {
+  std::vector<Eigen::Affine3d> affines;
+  for (const auto &m : make_matrices(n)) {
+    Eigen::Affine3d affine(m);
+    affine.translation() << m(0, 0), -2.0, 0.5;
+    affines.push_back(affine);
+  }
+  return affines;
+}
+
+template <class T> scipp::span<const T> as_span(const std::vector<T> &v) {
+  return {v.data(), v.size()};
+}
+} // namespace
+
+TEST(SpatialKernelsTest, matrix_times_vector) {
+  const auto a = make_matrices(n_elem);
+  const auto b = make_vectors(n_elem, 1.5);
+  std::vector<Eigen::Vector3d> out(n_elem);
+  spatial_kernels::multiply(as_span(a), as_span(b), out);
+  for (scipp::index i = 0; i < n_elem; ++i)
+    EXPECT_TRUE(out[i].isApprox(a[i] * b[i]));
+}
+
+TEST(SpatialKernelsTest, broadcast_matrix_times_vector) {
+  const auto a = make_matrices(1);
+  const auto b = make_vectors(n_elem, 1.5);
+  std::vector<Eigen::Vector3d> out(n_elem);
+  spatial_kernels::multiply(as_span(a), as_span(b), out);
+  for (scipp::index i = 0; i < n_elem; ++i)
+    EXPECT_TRUE(out[i].isApprox(a[0] * b[i]));
+}
+
+TEST(SpatialKernelsTest, affine_times_vector) {
+  const auto a = make_affines(n_elem);
+  const auto b = make_vectors(n_elem, 1.5);
+  std::vector<Eigen::Vector3d> out(n_elem);
+  spatial_kernels::multiply(as_span(a), as_span(b), out);
+  for (scipp::index i = 0; i < n_elem; ++i)
+    EXPECT_TRUE(out[i].isApprox(a[i] * b[i]));
+}
+
+TEST(SpatialKernelsTest, broadcast_affine_times_vector) {
+  const auto a = make_affines(1);
+  const auto b = make_vectors(n_elem, 1.5);
+  std::vector<Eigen::Vector3d> out(n_elem);
+  spatial_kernels::multiply(as_span(a), as_span(b), out);
+  for (scipp::index i = 0; i < n_elem; ++i)
+    EXPECT_TRUE(out[i].isApprox(a[0] * b[i]));
+}
+
+TEST(SpatialKernelsTest, empty) {
+  const auto a = make_matrices(1);
+  const std::vector<Eigen::Vector3d> b;
+  std::vector<Eigen::Vector3d> out;
+  EXPECT_NO_THROW(spatial_kernels::multiply(as_span(a), as_span(b), out));
+}
+
+TEST(SpatialKernelsTest, size_mismatch_throws) {
+  const auto a = make_matrices(2);
+  const auto b = make_vectors(3, 1.5);
+  std::vector<Eigen::Vector3d> out(3);
+  EXPECT_THROW(spatial_kernels::multiply(as_span(a), as_span(b), out),
+               except::SizeError);
+  EXPECT_THROW(spatial_kernels::multiply(as_span(make_matrices(1)), as_span(b),
+                                         scipp::span(out).subspan(1)),
+               except::SizeError);
+}
@@ -5,6 +5,7 @@
 #include <chrono>
 #include <sstream>
 
+#include "scipp/core/except.h"
 #include "scipp/core/string.h"
 #include "scipp/units/except.h"
 #include "scipp/units/unit.h"
@@ -54,3 +55,8 @@ TEST_F(ISODateTest, invalid_unit) {
   EXPECT_THROW(to_iso_date(get_time<chrono::minutes>(), units::m),
                scipp::except::UnitError);
 }
+
+TEST(StringTest, dtype_from_name) {
+  EXPECT_EQ(core::dtype_from_name(core::to_string(dtype<void>)), dtype<void>);
+  EXPECT_THROW(core::dtype_from_name("not a dtype"), except::TypeError);
+}
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include "scipp/dataset/arg_reduction.h"
+#include "scipp/variable/reduction.h"
+
+#include "dataset_operations_common.h"
+
+namespace scipp::dataset {
+
+DataArray argmin(const DataArray &a, const Dim dim) {
+  return apply_to_data_and_drop_dim(
+      a, [](auto &&..._) { return argmin(_...); }, dim, a.masks());
+}
+
+Dataset argmin(const Dataset &d, const Dim dim) {
+  return apply_to_items(
+      d, [](auto &&..._) { return argmin(_...); }, dim);
+}
+
+DataArray argmax(const DataArray &a, const Dim dim) {
+  return apply_to_data_and_drop_dim(
+      a, [](auto &&..._) { return argmax(_...); }, dim, a.masks());
+}
+
+Dataset argmax(const Dataset &d, const Dim dim) {
+  return apply_to_items(
+      d, [](auto &&..._) { return argmax(_...); }, dim);
+}
+
+/// Return the k largest unmasked elements along `dim`, in descending order.
+///
+/// Coords, masks, and attrs depending on `dim` are dropped since the output
+/// elements are not aligned with them.
+DataArray topk(const DataArray &a, const scipp::index k, const Dim dim) {
+  return apply_to_data_and_drop_dim(
+      a,
+      [k](const Variable &var, const Dim dim_, const Masks &masks) {
+        return topk(var, k, dim_, masks);
+      },
+      dim, a.masks());
+}
+
+Dataset topk(const Dataset &d, const scipp::index k, const Dim dim) {
+  return apply_to_items(
+      d, [k](const DataArray &a, const Dim dim_) { return topk(a, k, dim_); },
+      dim);
+}
+
+} // namespace scipp::dataset
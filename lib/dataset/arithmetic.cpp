@@ -2,7 +2,11 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <unordered_map>
+
 #include "scipp/core/element/arithmetic.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/small_flat_map.h"
 #include "scipp/dataset/dataset.h"
 #include "scipp/dataset/except.h"
 #include "scipp/dataset/util.h"
@@ -25,20 +29,6 @@ template <class T, class Op> void dry_run_op(T &&a, const Variable &b, Op op) {
   variable::dry_run::transform_in_place(a.data(), b, op, "binary_arithmetic");
 }
 
-template <class T, class Op> void dry_run_op(T &&a, const DataArray &b, Op op) {
-  expect::coords_are_superset(a, b, "");
-  dry_run_op(a, b.data(), op);
-}
-
-template <class Op, class A, class B>
-auto &apply(const Op &op, A &a, const B &b) {
-  for (const auto &item : b)
-    dry_run_op(a[item.name()], item, op);
-  for (const auto &item : b)
-    op(a[item.name()], item);
-  return a;
-}
-
 template <typename T> bool are_same(const T &a, const T &b) {
   return a.get() == b.get();
 }
@@ -60,196 +50,377 @@ bool have_common_underlying<DataArray, DataArray>(const DataArray &a,
   return are_same(a.data().data_handle(), b.data().data_handle());
 }
 
-template <class Op, class A, class B>
-decltype(auto) apply_with_delay(const Op &op, A &&a, const B &b) {
-  for (auto &&item : a)
-    dry_run_op(item, b, op);
+// Dataset operations are implemented as a batch of operations on pairs of
+// items. Items are DataArray, or Variable for the non-dataset operand. A batch
+// holding a single operand broadcasts it to all items.
+
+const Variable &data_of(const DataArray &item) { return item.data(); }
+const Variable &data_of(const Variable &var) { return var; }
+
+template <class T>
+const T &operand(const std::vector<T> &batch, const scipp::index i) {
+  return batch.size() == 1 ? batch.front() : batch[i];
+}
+
+std::vector<DataArray> items_of(const Dataset &ds) {
+  return {ds.begin(), ds.end()};
+}
+
+std::vector<DataArray> items_of(Dataset &ds) { return {ds.begin(), ds.end()}; }
+
+/// Return the batch without coords. Coords are validated once for the entire
+/// batch, the operations on individual items must not check them again.
+auto without_coords(const std::vector<DataArray> &batch) {
+  std::vector<DataArray> out;
+  out.reserve(batch.size());
+  for (const auto &item : batch)
+    out.emplace_back(item.data(), Coords::holder_type{},
+                     item.masks().items(), item.attrs().items(), item.name());
+  return out;
+}
+
+const auto &without_coords(const std::vector<Variable> &batch) {
+  return batch;
+}
+
+/// Add coords of `item` to `coords`. Coords that are present already are
+/// compared unless they are the same variable, which is the case for the coords
+/// of all items of a dataset, so each coord is compared at most once per
+/// operand instead of once per item.
+void merge_coords(core::small_flat_map<Dim, Variable> &coords,
+                  const DataArray &item, const std::string_view opname) {
+  for (const auto &[dim, coord] : item.coords()) {
+    if (const auto it = coords.find(dim); it == coords.end())
+      coords.emplace(dim, coord);
+    else if (!it->second.is_same(coord))
+      expect::matching_coord(dim, it->second, coord, opname);
+  }
+}
+
+void merge_coords(core::small_flat_map<Dim, Variable> &, const Variable &,
+                  const std::string_view) {}
+
+/// Equivalent to `expect::coords_are_superset` for all pairs of items, but
+/// each pair of coord variables is compared only once.
+template <class B>
+void coords_are_superset(const std::vector<DataArray> &a,
+                         const std::vector<B> &b,
+                         const std::string_view opname) {
+  if constexpr (std::is_same_v<B, DataArray>) {
+    core::small_flat_map<Dim, std::pair<Variable, Variable>> checked;
+    for (scipp::index i = 0; i < scipp::size(a); ++i) {
+      for (const auto &[dim, coord] : operand(b, i).coords()) {
+        const auto &a_coord = a[i].coords()[dim];
+        if (a_coord.is_same(coord))
+          continue;
+        if (const auto it = checked.find(dim);
+            it != checked.end() && it->second.first.is_same(a_coord) &&
+            it->second.second.is_same(coord))
+          continue;
+        if (a_coord != coord)
+          throw except::CoordMismatchError(dim, a_coord, coord, opname);
+        checked.insert_or_assign(dim, std::pair{a_coord, coord});
+      }
+    }
+  }
+}
+
+void add_buffers(std::vector<const void *> &out, const Variable &var) {
+  out.push_back(var.data_handle().get());
+}
+
+void add_buffers(std::vector<const void *> &out, const DataArray &item) {
+  add_buffers(out, item.data());
+  for (const auto &[name, mask] : item.masks())
+    add_buffers(out, mask);
+}
+
+/// Return true if no in-place operation on an item of `a` writes to a buffer
+/// that is accessed by the operation on any other item, i.e., if the batch can
+/// be processed concurrently.
+template <class B>
+bool are_independent(const std::vector<DataArray> &a,
+                     const std::vector<B> &b) {
+  std::unordered_map<const void *, scipp::index> written;
+  std::vector<const void *> buffers;
+  for (scipp::index i = 0; i < scipp::size(a); ++i) {
+    buffers.clear();
+    add_buffers(buffers, a[i]);
+    for (const auto *buffer : buffers)
+      if (const auto [it, inserted] = written.emplace(buffer, i);
+          !inserted && it->second != i)
+        return false;
+  }
+  for (scipp::index i = 0; i < scipp::size(b); ++i) {
+    buffers.clear();
+    add_buffers(buffers, b[i]);
+    for (const auto *buffer : buffers)
+      if (const auto it = written.find(buffer);
+          it != written.end() && (b.size() == 1 || it->second != i))
+        return false;
+  }
+  return true;
+}
+
+/// Call `func` for all items in [0, size) as a single parallel task set. This
+/// balances work across items. Operations on large items can still use nested
+/// parallelism.
+template <class F> void for_each_item(const scipp::index size, const F &func) {
+  if (size == 1)
+    return func(0);
+  core::parallel::parallel_for(core::parallel::blocked_range(0, size, 1),
+                               [&](const auto &range) {
+                                 for (auto i = range.begin(); i != range.end();
+                                      ++i)
+                                   func(i);
+                               });
+}
+
+template <class Op, class B>
+void apply_in_place(const Op &op, std::vector<DataArray> &a,
+                    const std::vector<B> &b, const std::string_view opname) {
+  coords_are_superset(a, b, opname);
+  for (scipp::index i = 0; i < scipp::size(a); ++i)
+    dry_run_op(a[i], data_of(operand(b, i)), op);
+  // Only if all items checked for dry-run does modification go-ahead
+  const auto &rhs = without_coords(b);
+  if (are_independent(a, rhs))
+    return for_each_item(scipp::size(a), [&](const scipp::index i) {
+      op(a[i], operand(rhs, i));
+    });
   // For `b` referencing data in `a` we delay operation. The alternative would
   // be to make a deep copy of `other` before starting the iteration over items.
-  DataArray delayed;
-  // Note the inefficiency here: We are comparing some or all of the coords for
-  // each item. This could be improved by implementing the operations for
-  // internal items of Dataset instead of DataArray.
-  for (auto &&item : a) {
-    if (have_common_underlying(item, b))
-      delayed = item;
+  std::vector<scipp::index> delayed;
+  for (scipp::index i = 0; i < scipp::size(a); ++i) {
+    if (rhs.size() == 1 && have_common_underlying(a[i], rhs.front()))
+      delayed.push_back(i);
     else
-      op(item, b);
+      op(a[i], operand(rhs, i));
   }
-  if (delayed.is_valid())
-    op(delayed, b);
-  return std::forward<A>(a);
+  for (const auto i : delayed)
+    op(a[i], rhs.front());
 }
 
-template <class Op, class A, class B>
-auto apply_with_broadcast(const Op &op, const A &a, const B &b) {
-  Dataset res;
+template <class Op>
+auto &apply(const Op &op, Dataset &a, const Dataset &b,
+            const std::string_view opname) {
+  std::vector<DataArray> lhs;
   for (const auto &item : b)
-    if (const auto it = a.find(item.name()); it != a.end())
-      res.setData(item.name(), op(*it, item));
-  return res;
+    lhs.emplace_back(a[item.name()]);
+  apply_in_place(op, lhs, items_of(b), opname);
+  return a;
 }
 
-template <class Op, class A>
-auto apply_with_broadcast(const Op &op, const A &a, const DataArray &b) {
-  Dataset res;
-  for (const auto &item : a)
-    res.setData(item.name(), op(item, b));
-  return res;
+template <class Op, class B>
+auto &apply_with_delay(const Op &op, Dataset &a, const B &b,
+                       const std::string_view opname) {
+  auto lhs = items_of(a);
+  apply_in_place(op, lhs, std::vector<B>{b}, opname);
+  return a;
 }
 
-template <class Op, class B>
-auto apply_with_broadcast(const Op &op, const DataArray &a, const B &b) {
-  Dataset res;
+/// Apply `op` to all pairs of items and return the results as items of a new
+/// dataset named `names`.
+template <class Op, class A, class B>
+Dataset apply_batched(const Op &op, const std::vector<std::string> &names,
+                      const std::vector<A> &a, const std::vector<B> &b,
+                      const std::string_view opname) {
+  core::small_flat_map<Dim, Variable> coords;
+  for (const auto &item : a)
+    merge_coords(coords, item, opname);
   for (const auto &item : b)
-    res.setData(item.name(), op(a, item));
+    merge_coords(coords, item, opname);
+  const auto &lhs = without_coords(a);
+  const auto &rhs = without_coords(b);
+  std::vector<DataArray> out(names.size());
+  for_each_item(scipp::size(names), [&](const scipp::index i) {
+    out[i] = op(operand(lhs, i), operand(rhs, i));
+  });
+  Dataset res;
+  for (scipp::index i = 0; i < scipp::size(names); ++i)
+    res.setData(names[i], out[i]);
+  for (auto &&[dim, coord] : coords)
+    res.setCoord(dim, std::move(coord));
   return res;
 }
 
-template <class Op, class A>
-auto apply_with_broadcast(const Op &op, const A &a, const Variable &b) {
-  Dataset res;
-  for (const auto &item : a)
-    res.setData(item.name(), op(item, b));
-  return res;
+std::vector<std::string> names_of(const std::vector<DataArray> &items) {
+  std::vector<std::string> names;
+  names.reserve(items.size());
+  for (const auto &item : items)
+    names.emplace_back(item.name());
+  return names;
 }
 
-template <class Op, class B>
-auto apply_with_broadcast(const Op &op, const Variable &a, const B &b) {
-  Dataset res;
+template <class Op>
+auto apply_with_broadcast(const Op &op, const Dataset &a, const Dataset &b,
+                          const std::string_view opname) {
+  std::vector<DataArray> lhs;
+  std::vector<DataArray> rhs;
   for (const auto &item : b)
-    res.setData(item.name(), op(a, item));
-  return res;
+    if (const auto it = a.find(item.name()); it != a.end()) {
+      lhs.emplace_back(*it);
+      rhs.emplace_back(item);
+    }
+  if (lhs.empty())
+    return Dataset{};
+  return apply_batched(op, names_of(rhs), lhs, rhs, opname);
+}
+
+template <class Op, class B>
+auto apply_with_broadcast(const Op &op, const Dataset &a, const B &b,
+                          const std::string_view opname) {
+  const auto lhs = items_of(a);
+  if (lhs.empty())
+    return Dataset{};
+  return apply_batched(op, names_of(lhs), lhs, std::vector<B>{b}, opname);
+}
+
+template <class Op, class A>
+auto apply_with_broadcast(const Op &op, const A &a, const Dataset &b,
+                          const std::string_view opname) {
+  const auto rhs = items_of(b);
+  if (rhs.empty())
+    return Dataset{};
+  return apply_batched(op, names_of(rhs), std::vector<A>{a}, rhs, opname);
 }
 
 } // namespace
 
 Dataset &Dataset::operator+=(const DataArray &other) {
-  return apply_with_delay(core::element::add_equals, *this, other);
+  return apply_with_delay(core::element::add_equals, *this, other,
+                          "add_equals");
 }
 
 Dataset &Dataset::operator-=(const DataArray &other) {
-  return apply_with_delay(core::element::subtract_equals, *this, other);
+  return apply_with_delay(core::element::subtract_equals, *this, other,
+                          "subtract_equals");
 }
 
 Dataset &Dataset::operator*=(const DataArray &other) {
-  return apply_with_delay(core::element::multiply_equals, *this, other);
+  return apply_with_delay(core::element::multiply_equals, *this, other,
+                          "multiply_equals");
 }
 
 Dataset &Dataset::operator/=(const DataArray &other) {
-  return apply_with_delay(core::element::divide_equals, *this, other);
+  return apply_with_delay(core::element::divide_equals, *this, other,
+                          "divide_equals");
 }
 
 Dataset &Dataset::operator+=(const Variable &other) {
-  return apply_with_delay(core::element::add_equals, *this, other);
+  return apply_with_delay(core::element::add_equals, *this, other,
+                          "add_equals");
 }
 
 Dataset &Dataset::operator-=(const Variable &other) {
-  return apply_with_delay(core::element::subtract_equals, *this, other);
+  return apply_with_delay(core::element::subtract_equals, *this, other,
+                          "subtract_equals");
 }
 
 Dataset &Dataset::operator*=(const Variable &other) {
-  return apply_with_delay(core::element::multiply_equals, *this, other);
+  return apply_with_delay(core::element::multiply_equals, *this, other,
+                          "multiply_equals");
 }
 
 Dataset &Dataset::operator/=(const Variable &other) {
-  return apply_with_delay(core::element::divide_equals, *this, other);
+  return apply_with_delay(core::element::divide_equals, *this, other,
+                          "divide_equals");
 }
 
 Dataset &Dataset::operator+=(const Dataset &other) {
-  return apply(core::element::add_equals, *this, other);
+  return apply(core::element::add_equals, *this, other, "add_equals");
 }
 
 Dataset &Dataset::operator-=(const Dataset &other) {
-  return apply(core::element::subtract_equals, *this, other);
+  return apply(core::element::subtract_equals, *this, other, "subtract_equals");
 }
 
 Dataset &Dataset::operator*=(const Dataset &other) {
-  return apply(core::element::multiply_equals, *this, other);
+  return apply(core::element::multiply_equals, *this, other, "multiply_equals");
 }
 
 Dataset &Dataset::operator/=(const Dataset &other) {
-  return apply(core::element::divide_equals, *this, other);
+  return apply(core::element::divide_equals, *this, other, "divide_equals");
 }
 
 Dataset operator+(const Dataset &lhs, const Dataset &rhs) {
-  return apply_with_broadcast(core::element::add, lhs, rhs);
+  return apply_with_broadcast(core::element::add, lhs, rhs, "add");
 }
 
 Dataset operator+(const Dataset &lhs, const DataArray &rhs) {
-  return apply_with_broadcast(core::element::add, lhs, rhs);
+  return apply_with_broadcast(core::element::add, lhs, rhs, "add");
 }
 
 Dataset operator+(const DataArray &lhs, const Dataset &rhs) {
-  return apply_with_broadcast(core::element::add, lhs, rhs);
+  return apply_with_broadcast(core::element::add, lhs, rhs, "add");
 }
 
 Dataset operator+(const Dataset &lhs, const Variable &rhs) {
-  return apply_with_broadcast(core::element::add, lhs, rhs);
+  return apply_with_broadcast(core::element::add, lhs, rhs, "add");
 }
 
 Dataset operator+(const Variable &lhs, const Dataset &rhs) {
-  return apply_with_broadcast(core::element::add, lhs, rhs);
+  return apply_with_broadcast(core::element::add, lhs, rhs, "add");
 }
 
 Dataset operator-(const Dataset &lhs, const Dataset &rhs) {
-  return apply_with_broadcast(core::element::subtract, lhs, rhs);
+  return apply_with_broadcast(core::element::subtract, lhs, rhs, "subtract");
 }
 
 Dataset operator-(const Dataset &lhs, const DataArray &rhs) {
-  return apply_with_broadcast(core::element::subtract, lhs, rhs);
+  return apply_with_broadcast(core::element::subtract, lhs, rhs, "subtract");
 }
 
 Dataset operator-(const DataArray &lhs, const Dataset &rhs) {
-  return apply_with_broadcast(core::element::subtract, lhs, rhs);
+  return apply_with_broadcast(core::element::subtract, lhs, rhs, "subtract");
 }
 
 Dataset operator-(const Dataset &lhs, const Variable &rhs) {
-  return apply_with_broadcast(core::element::subtract, lhs, rhs);
+  return apply_with_broadcast(core::element::subtract, lhs, rhs, "subtract");
 }
 
 Dataset operator-(const Variable &lhs, const Dataset &rhs) {
-  return apply_with_broadcast(core::element::subtract, lhs, rhs);
+  return apply_with_broadcast(core::element::subtract, lhs, rhs, "subtract");
 }
 
 Dataset operator*(const Dataset &lhs, const Dataset &rhs) {
-  return apply_with_broadcast(core::element::multiply, lhs, rhs);
+  return apply_with_broadcast(core::element::multiply, lhs, rhs, "multiply");
 }
 
 Dataset operator*(const Dataset &lhs, const DataArray &rhs) {
-  return apply_with_broadcast(core::element::multiply, lhs, rhs);
+  return apply_with_broadcast(core::element::multiply, lhs, rhs, "multiply");
 }
 
 Dataset operator*(const DataArray &lhs, const Dataset &rhs) {
-  return apply_with_broadcast(core::element::multiply, lhs, rhs);
+  return apply_with_broadcast(core::element::multiply, lhs, rhs, "multiply");
 }
 
 Dataset operator*(const Dataset &lhs, const Variable &rhs) {
-  return apply_with_broadcast(core::element::multiply, lhs, rhs);
+  return apply_with_broadcast(core::element::multiply, lhs, rhs, "multiply");
 }
 
 Dataset operator*(const Variable &lhs, const Dataset &rhs) {
-  return apply_with_broadcast(core::element::multiply, lhs, rhs);
+  return apply_with_broadcast(core::element::multiply, lhs, rhs, "multiply");
 }
 
 Dataset operator/(const Dataset &lhs, const Dataset &rhs) {
-  return apply_with_broadcast(core::element::divide, lhs, rhs);
+  return apply_with_broadcast(core::element::divide, lhs, rhs, "divide");
 }
 
 Dataset operator/(const Dataset &lhs, const DataArray &rhs) {
-  return apply_with_broadcast(core::element::divide, lhs, rhs);
+  return apply_with_broadcast(core::element::divide, lhs, rhs, "divide");
 }
 
 Dataset operator/(const DataArray &lhs, const Dataset &rhs) {
-  return apply_with_broadcast(core::element::divide, lhs, rhs);
+  return apply_with_broadcast(core::element::divide, lhs, rhs, "divide");
 }
 
 Dataset operator/(const Dataset &lhs, const Variable &rhs) {
-  return apply_with_broadcast(core::element::divide, lhs, rhs);
+  return apply_with_broadcast(core::element::divide, lhs, rhs, "divide");
 }
 
 Dataset operator/(const Variable &lhs, const Dataset &rhs) {
-  return apply_with_broadcast(core::element::divide, lhs, rhs);
+  return apply_with_broadcast(core::element::divide, lhs, rhs, "divide");
 }
 
 } // namespace scipp::dataset
@@ -0,0 +1,641 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "scipp/core/string.h"
+#include "scipp/core/tag_util.h"
+#include "scipp/dataset/arrow.h"
+#include "scipp/dataset/bins.h"
+#include "scipp/dataset/except.h"
+#include "scipp/units/string.h"
+#include "scipp/variable/creation.h"
+#include "scipp/variable/string_array_model.h"
+#include "scipp/variable/util.h"
+#include "scipp/variable/variable_factory.h"
+
+namespace scipp::dataset {
+
+namespace {
+
+using Metadata = std::vector<std::pair<std::string, std::string>>;
+
+constexpr auto default_dim = "row";
+constexpr auto default_bin_dim = "event";
+
+/// Encode key-value pairs as specified by the Arrow C data interface: The
+/// number of pairs followed by length-prefixed keys and values.
+std::string encode_metadata(const Metadata &metadata) {
+  std::string out;
+  const auto append_int = [&out](const int32_t value) {
+    out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+  };
+  append_int(static_cast<int32_t>(metadata.size()));
+  for (const auto &[key, value] : metadata) {
+    append_int(static_cast<int32_t>(key.size()));
+    out += key;
+    append_int(static_cast<int32_t>(value.size()));
+    out += value;
+  }
+  return out;
+}
+
+Metadata decode_metadata(const char *metadata) {
+  Metadata out;
+  if (metadata == nullptr)
+    return out;
+  const auto read_int = [&metadata]() {
+    int32_t value;
+    std::memcpy(&value, metadata, sizeof(value));
+    metadata += sizeof(value);
+    return value;
+  };
+  const auto read_string = [&metadata, &read_int]() {
+    const auto size = read_int();
+    std::string value(metadata, size);
+    metadata += size;
+    return value;
+  };
+  const auto n = read_int();
+  for (int32_t i = 0; i < n; ++i) {
+    auto key = read_string();
+    auto value = read_string();
+    out.emplace_back(std::move(key), std::move(value));
+  }
+  return out;
+}
+
+std::optional<std::string> find(const Metadata &metadata,
+                                const std::string_view key) {
+  for (const auto &[k, value] : metadata)
+    if (k == key)
+      return value;
+  return std::nullopt;
+}
+
+std::vector<std::string> split(const std::string &str) {
+  std::vector<std::string> out;
+  if (str.empty())
+    return out;
+  std::string::size_type begin = 0;
+  for (auto end = str.find(','); end != std::string::npos;
+       begin = end + 1, end = str.find(',', begin))
+    out.push_back(str.substr(begin, end - begin));
+  out.push_back(str.substr(begin));
+  return out;
+}
+
+template <class Range, class ToString>
+std::string join(const Range &items, const ToString &to_string) {
+  std::string out;
+  for (const auto &item : items)
+    out += (out.empty() ? "" : ",") + to_string(item);
+  return out;
+}
+
+units::Unit parse_unit(const std::string &unit) {
+  return unit == "None" ? units::none : units::Unit(unit);
+}
+
+struct SchemaHolder {
+  std::string format;
+  std::string name;
+  std::string metadata;
+  std::vector<ArrowSchema> children;
+  std::vector<ArrowSchema *> child_pointers;
+};
+
+struct ArrayHolder {
+  /// Keep the exported memory alive, e.g., the exported variable.
+  std::vector<std::shared_ptr<const void>> owners;
+  std::vector<const void *> buffers;
+  std::vector<ArrowArray> children;
+  std::vector<ArrowArray *> child_pointers;
+};
+
+template <class T> void release_children(std::vector<T> &children) {
+  for (auto &child : children)
+    if (child.release != nullptr)
+      child.release(&child);
+  children.clear();
+}
+
+void release_schema(ArrowSchema *schema) {
+  auto *holder = static_cast<SchemaHolder *>(schema->private_data);
+  release_children(holder->children);
+  delete holder;
+  schema->release = nullptr;
+}
+
+void release_array(ArrowArray *array) {
+  auto *holder = static_cast<ArrayHolder *>(array->private_data);
+  release_children(holder->children);
+  delete holder;
+  array->release = nullptr;
+}
+
+/// Children exported so far, released if the export of the parent fails.
+struct Children {
+  Children() = default;
+  Children(const Children &) = delete;
+  Children &operator=(const Children &) = delete;
+  ~Children() {
+    release_children(arrays);
+    release_children(schemas);
+  }
+  std::vector<ArrowArray> arrays;
+  std::vector<ArrowSchema> schemas;
+};
+
+void make_schema(ArrowSchema &schema, std::string format, std::string name,
+                 const Metadata &metadata, Children *children = nullptr) {
+  auto holder = std::make_unique<SchemaHolder>();
+  holder->format = std::move(format);
+  holder->name = std::move(name);
+  holder->metadata = metadata.empty() ? "" : encode_metadata(metadata);
+  if (children)
+    std::swap(holder->children, children->schemas);
+  for (auto &child : holder->children)
+    holder->child_pointers.push_back(&child);
+  schema.format = holder->format.c_str();
+  schema.name = holder->name.c_str();
+  schema.metadata = metadata.empty() ? nullptr : holder->metadata.data();
+  schema.flags = 0;
+  schema.n_children = scipp::size(holder->children);
+  schema.children = holder->child_pointers.data();
+  schema.dictionary = nullptr;
+  schema.release = release_schema;
+  schema.private_data = holder.release();
+}
+
+void make_array(ArrowArray &array, const scipp::index length,
+                std::vector<const void *> buffers,
+                std::vector<std::shared_ptr<const void>> owners,
+                Children *children = nullptr) {
+  auto holder = std::make_unique<ArrayHolder>();
+  holder->owners = std::move(owners);
+  holder->buffers = std::move(buffers);
+  if (children)
+    std::swap(holder->children, children->arrays);
+  for (auto &child : holder->children)
+    holder->child_pointers.push_back(&child);
+  array.length = length;
+  array.null_count = 0;
+  array.offset = 0;
+  array.n_buffers = scipp::size(holder->buffers);
+  array.n_children = scipp::size(holder->children);
+  array.buffers = holder->buffers.data();
+  array.children = holder->child_pointers.data();
+  array.dictionary = nullptr;
+  array.release = release_array;
+  array.private_data = holder.release();
+}
+
+const units::Unit &ms() {
+  static const units::Unit unit{llnl::units::precise::ms};
+  return unit;
+}
+
+std::string arrow_format(const Variable &var) {
+  const auto type = var.dtype();
+  if (type == dtype<double>)
+    return "g";
+  if (type == dtype<float>)
+    return "f";
+  if (type == dtype<core::float16>)
+    return "e";
+  if (type == dtype<int64_t>)
+    return "l";
+  if (type == dtype<int32_t>)
+    return "i";
+  if (type == dtype<int16_t>)
+    return "s";
+  if (type == dtype<int8_t>)
+    return "c";
+  if (type == dtype<uint64_t>)
+    return "L";
+  if (type == dtype<uint32_t>)
+    return "I";
+  if (type == dtype<uint16_t>)
+    return "S";
+  if (type == dtype<uint8_t>)
+    return "C";
+  if (type == dtype<bool>)
+    return "b";
+  if (type == dtype<std::string> || type == dtype<std::string_view>)
+    return "U";
+  if (type == dtype<core::time_point>) {
+    const auto unit = var.unit();
+    if (unit == units::ns)
+      return "tsn:";
+    if (unit == units::us)
+      return "tsu:";
+    if (unit == ms())
+      return "tsm:";
+    if (unit == units::s)
+      return "tss:";
+    throw except::UnitError("Cannot export datetimes with unit " +
+                            to_string(unit) + " to Arrow.");
+  }
+  throw except::TypeError("Cannot export dtype " + to_string(type) +
+                          " to Arrow.");
+}
+
+/// Export strings as large utf8. The characters are shared with `var` if they
+/// are stored consecutively, as is the case for string_view elements created
+/// from strings or imported from Arrow.
+template <class T>
+void export_strings(const Variable &var, ArrowArray &array) {
+  const auto values = var.values<T>();
+  const auto size = values.size();
+  auto offsets = std::make_shared<std::vector<int64_t>>(size + 1, 0);
+  const char *begin =
+      size == 0 ? nullptr : std::string_view(values[0]).data();
+  bool shared = std::is_same_v<T, std::string_view> && begin != nullptr;
+  int64_t total = 0;
+  scipp::index i = 0;
+  for (const std::string_view str : values) {
+    shared = shared && str.data() == begin + total;
+    total += scipp::size(str);
+    (*offsets)[++i] = total;
+  }
+  if (shared) {
+    const auto *data = offsets->data();
+    return make_array(array, size, {nullptr, data, begin},
+                      {std::move(offsets), std::make_shared<Variable>(var)});
+  }
+  auto chars = std::make_shared<std::string>();
+  chars->reserve(total);
+  for (const std::string_view str : values)
+    chars->append(str);
+  const auto *data = offsets->data();
+  const auto *chars_data = chars->data();
+  make_array(array, size, {nullptr, data, chars_data},
+             {std::move(offsets), std::move(chars)});
+}
+
+template <class T> struct ExportValues {
+  static void apply(const Variable &var, ArrowArray &array,
+                    const bool variances) {
+    const auto size = var.dims().volume();
+    if constexpr (std::is_same_v<T, bool>) {
+      auto bits = std::make_shared<std::vector<uint8_t>>((size + 7) / 8, 0);
+      scipp::index i = 0;
+      for (const bool value : var.values<bool>()) {
+        if (value)
+          (*bits)[i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+        ++i;
+      }
+      const auto *data = bits->data();
+      make_array(array, size, {nullptr, data}, {std::move(bits)});
+    } else if constexpr (std::is_same_v<T, std::string> ||
+                         std::is_same_v<T, std::string_view>) {
+      export_strings<T>(var, array);
+    } else {
+      const T *data =
+          variances ? var.variances<T>().data() : var.values<T>().data();
+      make_array(array, size, {nullptr, data},
+                 {std::make_shared<Variable>(var)});
+    }
+  }
+};
+
+/// Export the values, or the variances, of a dense variable.
+void export_dense(const Variable &var, ArrowArray &array, ArrowSchema &schema,
+                  const std::string &name, Metadata metadata,
+                  const bool variances = false) {
+  if (var.has_variances() && !variances &&
+      find(metadata, "scipp:role") != "data")
+    throw except::VariancesError(
+        "Cannot export variances to Arrow, only the data of binned variables "
+        "may have variances.");
+  if (!is_contiguous(var))
+    return export_dense(copy(var), array, schema, name, std::move(metadata),
+                        variances);
+  auto format = arrow_format(var);
+  metadata.insert(metadata.begin(), {"scipp:unit", to_string(var.unit())});
+  core::CallDType<double, float, core::float16, int64_t, int32_t, int16_t,
+                  int8_t, uint64_t, uint32_t, uint16_t, uint8_t, bool,
+                  core::time_point, std::string,
+                  std::string_view>::apply<ExportValues>(var.dtype(), var,
+                                                         array, variances);
+  try {
+    make_schema(schema, std::move(format), name, metadata);
+  } catch (...) {
+    array.release(&array);
+    throw;
+  }
+}
+
+bool has_contiguous_bins(const Variable &indices) {
+  const auto values = indices.values<scipp::index_pair>();
+  for (scipp::index i = 1; i < values.size(); ++i)
+    if (values[i].first != values[i - 1].second)
+      return false;
+  return true;
+}
+
+void export_bins(const Variable &var, ArrowArray &array, ArrowSchema &schema) {
+  if (var.dims().ndim() != 1)
+    throw except::DimensionError(
+        "Only binned variables with a single dimension can be exported to "
+        "Arrow, got " +
+        to_string(var.dims()) + ". Use `flatten` to combine the dims first.");
+  const auto &[indices, dim, buffer] = var.constituents<DataArray>();
+  if (!has_contiguous_bins(indices))
+    return export_bins(copy(var), array, schema);
+  const auto size = var.dims().volume();
+  auto offsets = std::make_shared<std::vector<int64_t>>(size + 1, 0);
+  scipp::index i = 0;
+  for (const auto &[begin, end] : indices.values<scipp::index_pair>()) {
+    if (i == 0)
+      (*offsets)[0] = begin;
+    (*offsets)[++i] = end;
+  }
+
+  Children fields;
+  const auto add_field = [&](const Variable &field, const std::string &name,
+                             const std::string &role,
+                             const bool variances = false) {
+    if (field.dims().ndim() != 1)
+      throw except::DimensionError("Cannot export bin content with dims " +
+                                   to_string(field.dims()) + " to Arrow.");
+    auto &field_array = fields.arrays.emplace_back();
+    auto &field_schema = fields.schemas.emplace_back();
+    field_array.release = nullptr;
+    field_schema.release = nullptr;
+    export_dense(field, field_array, field_schema, name, {{"scipp:role", role}},
+                 variances);
+  };
+  for (const auto &[key, coord] : buffer.coords())
+    add_field(coord, key.name(), "coord");
+  add_field(buffer.data(), "data", "data");
+  if (buffer.has_variances())
+    add_field(buffer.data(), "variances", "variances", true);
+  for (const auto &[name, mask] : buffer.masks())
+    add_field(mask, name, "mask");
+  for (const auto &[key, attr] : buffer.attrs())
+    add_field(attr, key.name(), "attr");
+
+  Children content;
+  auto &content_array = content.arrays.emplace_back();
+  auto &content_schema = content.schemas.emplace_back();
+  content_array.release = nullptr;
+  content_schema.release = nullptr;
+  make_array(content_array, buffer.dims()[dim], {nullptr}, {}, &fields);
+  make_schema(content_schema, "+s", "", {}, &fields);
+  const auto *data = offsets->data();
+  make_array(array, size, {nullptr, data}, {std::move(offsets)}, &content);
+  try {
+    make_schema(schema, "+L", "",
+                {{"scipp:dims", var.dims().label(0).name()},
+                 {"scipp:bin_dim", dim.name()}},
+                &content);
+  } catch (...) {
+    array.release(&array);
+    throw;
+  }
+}
+
+void expect_no_nulls(const ArrowArray &array) {
+  if (array.n_buffers > 0 && array.buffers[0] != nullptr &&
+      array.null_count != 0)
+    throw std::invalid_argument(
+        "Cannot import Arrow array with null values, fill them first.");
+}
+
+Dimensions import_dims(const Metadata &metadata, const scipp::index length) {
+  const auto labels = find(metadata, "scipp:dims");
+  const auto shape = find(metadata, "scipp:shape");
+  if (!labels || !shape)
+    return Dimensions(Dim(default_dim), length);
+  Dimensions dims;
+  const auto sizes = split(*shape);
+  for (const auto &label : split(*labels))
+    dims.addInner(Dim(label), std::stoll(sizes.at(dims.ndim())));
+  if (dims.volume() != length)
+    throw except::DimensionError("Arrow array of length " +
+                                 std::to_string(length) +
+                                 " does not match dims " + to_string(dims));
+  return dims;
+}
+
+template <class T>
+Variable wrap_values(const Dimensions &dims, const units::Unit &unit,
+                     const ArrowArray &array,
+                     const std::shared_ptr<const void> &owner) {
+  // Datetimes are stored as int64, which matches the layout of time_point.
+  // ElementArrayModel copies read-only arrays on non-const access.
+  const auto *data = static_cast<const T *>(array.buffers[1]) +
+                     (array.buffers[1] == nullptr ? 0 : array.offset);
+  core::element_array<T> values(data, dims.volume(), owner,
+                                core::read_only);
+  return Variable(dims, std::make_shared<variable::ElementArrayModel<T>>(
+                            dims.volume(), unit, std::move(values)));
+}
+
+Variable unpack_bits(const Dimensions &dims, const units::Unit &unit,
+                     const ArrowArray &array) {
+  const auto *bits = static_cast<const uint8_t *>(array.buffers[1]);
+  core::element_array<bool> values(dims.volume(), core::init_for_overwrite);
+  for (scipp::index i = 0; i < values.size(); ++i) {
+    const auto bit = array.offset + i;
+    values.data()[i] = (bits[bit / 8] >> (bit % 8)) & 1;
+  }
+  return Variable(dims, std::make_shared<variable::ElementArrayModel<bool>>(
+                            dims.volume(), unit, std::move(values)));
+}
+
+/// Create string_view elements viewing the characters of `array` in place.
+template <class Offset>
+Variable wrap_strings(const Dimensions &dims, const units::Unit &unit,
+                      const ArrowArray &array,
+                      const std::shared_ptr<const void> &owner) {
+  const auto size = dims.volume();
+  const auto *offsets = static_cast<const Offset *>(array.buffers[1]);
+  // The buffer is held as const by StringArrayModel and never written.
+  auto *chars = const_cast<char *>(static_cast<const char *>(array.buffers[2]));
+  const auto begin = size == 0 ? 0 : offsets[array.offset];
+  const auto end = size == 0 ? 0 : offsets[array.offset + size];
+  auto buffer = std::make_shared<variable::StringArrayModel::buffer_type>(
+      chars + begin, end - begin, owner);
+  core::element_array<std::string_view> views(size, core::init_for_overwrite);
+  for (scipp::index i = 0; i < size; ++i) {
+    const auto first = offsets[array.offset + i];
+    const auto last = offsets[array.offset + i + 1];
+    views.data()[i] = std::string_view(chars + first, last - first);
+  }
+  return Variable(dims, variable::StringArrayModel::make(
+                            std::move(views), std::move(buffer), unit));
+}
+
+Variable import_dense(const ArrowArray &array, const ArrowSchema &schema,
+                      const Dimensions &dims,
+                      const std::shared_ptr<const void> &owner) {
+  expect_no_nulls(array);
+  const std::string_view format(schema.format);
+  const auto metadata = decode_metadata(schema.metadata);
+  const auto unit_of = [&metadata](const DType type) {
+    const auto unit = find(metadata, "scipp:unit");
+    return unit ? parse_unit(*unit) : variable::default_unit_for(type);
+  };
+  if (format == "g")
+    return wrap_values<double>(dims, unit_of(dtype<double>), array, owner);
+  if (format == "f")
+    return wrap_values<float>(dims, unit_of(dtype<float>), array, owner);
+  if (format == "e")
+    return wrap_values<core::float16>(dims, unit_of(dtype<core::float16>),
+                                      array, owner);
+  if (format == "l")
+    return wrap_values<int64_t>(dims, unit_of(dtype<int64_t>), array, owner);
+  if (format == "i")
+    return wrap_values<int32_t>(dims, unit_of(dtype<int32_t>), array, owner);
+  if (format == "s")
+    return wrap_values<int16_t>(dims, unit_of(dtype<int16_t>), array, owner);
+  if (format == "c")
+    return wrap_values<int8_t>(dims, unit_of(dtype<int8_t>), array, owner);
+  if (format == "L")
+    return wrap_values<uint64_t>(dims, unit_of(dtype<uint64_t>), array,
+                                 owner);
+  if (format == "I")
+    return wrap_values<uint32_t>(dims, unit_of(dtype<uint32_t>), array,
+                                 owner);
+  if (format == "S")
+    return wrap_values<uint16_t>(dims, unit_of(dtype<uint16_t>), array,
+                                 owner);
+  if (format == "C")
+    return wrap_values<uint8_t>(dims, unit_of(dtype<uint8_t>), array, owner);
+  if (format == "b")
+    return unpack_bits(dims, unit_of(dtype<bool>), array);
+  if (format == "u")
+    return wrap_strings<int32_t>(dims, unit_of(dtype<std::string_view>),
+                                 array, owner);
+  if (format == "U")
+    return wrap_strings<int64_t>(dims, unit_of(dtype<std::string_view>),
+                                 array, owner);
+  // Timezones are ignored since Arrow stores timestamps relative to UTC.
+  if (format.substr(0, 2) == "ts" && format.size() >= 4 && format[3] == ':') {
+    const auto unit = format[2] == 'n'   ? units::ns
+                      : format[2] == 'u' ? units::us
+                      : format[2] == 'm' ? ms()
+                                         : units::s;
+    return wrap_values<core::time_point>(dims, unit, array, owner);
+  }
+  throw except::TypeError("Cannot import Arrow array with format '" +
+                          std::string(format) + "'.");
+}
+
+template <class Offset>
+Variable import_bins(const ArrowArray &array, const ArrowSchema &schema,
+                     const std::shared_ptr<const void> &owner) {
+  expect_no_nulls(array);
+  if (array.n_children != 1 || std::string_view(schema.children[0]->format) !=
+                                   std::string_view("+s"))
+    throw except::TypeError(
+        "Can only import Arrow lists with elements of type struct.");
+  const auto metadata = decode_metadata(schema.metadata);
+  const Dim dim(find(metadata, "scipp:dims").value_or(default_dim));
+  const Dim bin_dim(find(metadata, "scipp:bin_dim").value_or(default_bin_dim));
+  const auto &content = *array.children[0];
+  const auto &content_schema = *schema.children[0];
+  expect_no_nulls(content);
+
+  // Offsets refer to elements of the struct, which may itself be a slice of
+  // its fields.
+  const auto *offsets = static_cast<const Offset *>(array.buffers[1]);
+  auto indices =
+      makeVariable<scipp::index_pair>(Dims{dim}, Shape{array.length});
+  auto index = indices.values<scipp::index_pair>().begin();
+  for (scipp::index i = 0; i < array.length; ++i, ++index)
+    *index = {content.offset + offsets[array.offset + i],
+              content.offset + offsets[array.offset + i + 1]};
+
+  std::optional<Variable> data;
+  std::optional<Variable> variances;
+  std::vector<std::pair<std::string, Variable>> masks;
+  std::vector<std::pair<Dim, Variable>> coords;
+  std::vector<std::pair<Dim, Variable>> attrs;
+  std::optional<scipp::index> size;
+  for (scipp::index i = 0; i < content.n_children; ++i) {
+    const auto &field = *content.children[i];
+    const auto &field_schema = *content_schema.children[i];
+    if (size && *size != field.length)
+      throw except::DimensionError(
+          "All fields of imported Arrow struct must have the same length.");
+    size = field.length;
+    const std::string name(field_schema.name ? field_schema.name : "");
+    const auto role = find(decode_metadata(field_schema.metadata), "scipp:role")
+                          .value_or(name == "data" ? "data" : "coord");
+    auto var = import_dense(field, field_schema,
+                            Dimensions(bin_dim, field.length), owner);
+    if (role == "data")
+      data = std::move(var);
+    else if (role == "variances")
+      variances = std::move(var);
+    else if (role == "mask")
+      masks.emplace_back(name, var.as_const());
+    else if (role == "attr")
+      attrs.emplace_back(Dim(name), var.as_const());
+    else
+      coords.emplace_back(Dim(name), var.as_const());
+  }
+  if (!data)
+    data = variable::ones(Dimensions(bin_dim, size.value_or(0)),
+                          units::counts, dtype<float>);
+  if (variances)
+    data->setVariances(*variances);
+  DataArray buffer(data->as_const());
+  for (const auto &[name, mask] : masks)
+    buffer.masks().set(name, mask);
+  for (const auto &[key, coord] : coords)
+    buffer.coords().set(key, coord);
+  for (const auto &[key, attr] : attrs)
+    buffer.attrs().set(key, attr);
+  return make_bins(std::move(indices), bin_dim, std::move(buffer));
+}
+
+} // namespace
+
+void to_arrow(const Variable &var, ArrowArray &array, ArrowSchema &schema) {
+  if (var.dtype() == dtype<bucket<DataArray>>)
+    return export_bins(var, array, schema);
+  const auto &dims = var.dims();
+  export_dense(var, array, schema, "",
+               {{"scipp:dims",
+                 join(dims.labels(), [](const Dim dim) { return dim.name(); })},
+                {"scipp:shape", join(dims.shape(), [](const scipp::index size) {
+                   return std::to_string(size);
+                 })}});
+}
+
+Variable from_arrow(ArrowArray &array, const ArrowSchema &schema) {
+  if (array.release == nullptr)
+    throw std::invalid_argument("Cannot import released Arrow array.");
+  // Move the array into `owner`, which is kept alive by the imported
+  // buffers and releases the array once the last of them is destroyed.
+  const auto owner =
+      std::shared_ptr<ArrowArray>(new ArrowArray(array), [](ArrowArray *ptr) {
+        if (ptr->release != nullptr)
+          ptr->release(ptr);
+        delete ptr;
+      });
+  array.release = nullptr;
+  const std::string_view format(schema.format);
+  if (format == "+L")
+    return import_bins<int64_t>(*owner, schema, owner).as_const();
+  if (format == "+l")
+    return import_bins<int32_t>(*owner, schema, owner).as_const();
+  return import_dense(*owner, schema,
+                      import_dims(decode_metadata(schema.metadata),
+                                  owner->length),
+                      owner)
+      .as_const();
+}
+
+} // namespace scipp::dataset
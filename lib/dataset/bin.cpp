@@ -7,6 +7,7 @@
 
 #include "scipp/core/element/bin.h"
 #include "scipp/core/element/cumulative.h"
+#include "scipp/core/execution_config.h"
 
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/bin_detail.h"
@@ -23,6 +24,7 @@
 #include "scipp/dataset/bins.h"
 #include "scipp/dataset/bins_view.h"
 #include "scipp/dataset/except.h"
+#include "scipp/dataset/util.h"
 
 #include "bin_detail.h"
 #include "bins_util.h"
@@ -180,7 +182,7 @@ template <class T, class Meta> auto extract_unbinned(T &array, Meta meta) {
   const auto dim = array.dims().inner();
   using Key = typename std::decay_t<decltype(meta(array))>::key_type;
   std::vector<Key> to_extract;
-  std::unordered_map<Key, Variable> extracted;
+  core::small_flat_map<Key, Variable> extracted;
   const auto view = meta(array);
   // WARNING: Do not use `view` while extracting, `extract` invalidates it!
   std::copy_if(
@@ -581,8 +583,10 @@ DataArray bin(const DataArray &array, const std::vector<Variable> &edges,
     // Pretend existing binning along outermost binning dim to enable threading
     const auto dim = data.dims().inner();
     const auto size = std::max(scipp::index(1), data.dims()[dim]);
-    // TODO automatic setup with reasonable bin count
-    const auto stride = std::max(scipp::index(1), size / 24);
+    // Every pretended bin is processed by one task.
+    const auto stride = core::parallel::grainsize(
+        size, std::max(scipp::index(1),
+                       size_of(array, SizeofTag::ViewOnly) / size));
     auto begin = make_range(0, size, stride,
                             groups.empty() ? edges.front().dims().inner()
                                            : groups.front().dims().inner());
@@ -0,0 +1,670 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "scipp/core/eigen.h"
+#include "scipp/core/except.h"
+#include "scipp/core/spatial_transforms.h"
+#include "scipp/core/string.h"
+#include "scipp/core/tag_util.h"
+#include "scipp/dataset/binary_io.h"
+#include "scipp/dataset/bins.h"
+#include "scipp/units/string.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/categorical_string_model.h"
+#include "scipp/variable/string_array_model.h"
+#include "scipp/variable/structures.h"
+#include "scipp/variable/util.h"
+
+#include "bins_util.h"
+
+namespace scipp::dataset::binary_io {
+
+namespace {
+
+constexpr char magic[8] = {'S', 'C', 'I', 'P', 'P', 'B', 'I', 'N'};
+constexpr uint32_t format_version = 1;
+/// Written in native byte order to detect files from other machines.
+constexpr uint32_t byte_order_mark = 0x01020304;
+/// Size of magic, version, byte order mark, and header size.
+constexpr uint64_t prefix_size = 24;
+/// Alignment of buffers relative to the start of the file. Mapped files start
+/// at a page boundary, so this is also the alignment in memory.
+constexpr uint64_t alignment = 64;
+
+uint64_t aligned(const uint64_t n) {
+  return (n + alignment - 1) / alignment * alignment;
+}
+
+enum class Kind : uint8_t { Dense, Binned, Variable, DataArray, Dataset };
+
+/// Dtypes of dense variables. Elements of all types other than strings are
+/// stored as their bytes in memory.
+using SupportedTypes =
+    core::CallDType<double, float, core::float16, int64_t, int32_t, int16_t,
+                    int8_t, uint64_t, uint32_t, uint16_t, uint8_t, bool,
+                    core::time_point, Eigen::Vector3d, Eigen::Matrix3d,
+                    Eigen::Affine3d, core::Quaternion, core::Translation,
+                    std::string, std::string_view, core::categorical_string>;
+
+template <class... Ts>
+bool supports(core::CallDType<Ts...>, const DType type) {
+  return ((type == dtype<Ts>) || ...);
+}
+
+template <class T>
+constexpr bool is_string_v =
+    std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> ||
+    std::is_same_v<T, core::categorical_string>;
+
+/// Builds the header of a file and records the buffers to write after it.
+class HeaderWriter {
+public:
+  void u8(const uint8_t value) { m_header.push_back(static_cast<char>(value)); }
+  void u64(const uint64_t value) {
+    m_header.append(reinterpret_cast<const char *>(&value), sizeof(value));
+  }
+  void str(const std::string &value) {
+    u64(value.size());
+    m_header.append(value);
+  }
+  /// Record a buffer of `size` bytes, which is written by `write`.
+  void buffer(const uint64_t size, std::function<void(std::ostream &)> write) {
+    u64(m_end);
+    u64(size);
+    m_buffers.push_back({m_end, size, std::move(write)});
+    m_end = aligned(m_end + size);
+  }
+  /// Record a buffer with the memory at `data`, kept alive by `owner`.
+  void buffer(const void *data, const uint64_t size, const Variable &owner) {
+    buffer(size, [data, size, owner](std::ostream &out) {
+      out.write(static_cast<const char *>(data),
+                static_cast<std::streamsize>(size));
+    });
+  }
+
+  /// Write to a temporary file, which replaces `filename` once complete.
+  /// Truncating `filename` instead would invalidate mappings of the file,
+  /// e.g., of an object loaded from `filename` that is saved to it again.
+  void write(const std::string &filename) const {
+    const auto temporary = temporary_filename(filename);
+    try {
+      write_to(temporary);
+      std::filesystem::rename(temporary, filename);
+    } catch (...) {
+      std::error_code ec;
+      std::filesystem::remove(temporary, ec);
+      throw;
+    }
+  }
+
+private:
+  struct Buffer {
+    /// Offset relative to the first buffer.
+    uint64_t offset;
+    uint64_t size;
+    std::function<void(std::ostream &)> write;
+  };
+
+  static std::string temporary_filename(const std::string &filename) {
+    std::random_device random;
+    return filename + ".tmp" + std::to_string(random());
+  }
+
+  void write_to(const std::string &filename) const {
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out)
+      throw std::runtime_error("Failed to open '" + filename +
+                               "' for writing.");
+    out.write(magic, sizeof(magic));
+    out.write(reinterpret_cast<const char *>(&format_version),
+              sizeof(format_version));
+    out.write(reinterpret_cast<const char *>(&byte_order_mark),
+              sizeof(byte_order_mark));
+    const uint64_t header_size = m_header.size();
+    out.write(reinterpret_cast<const char *>(&header_size),
+              sizeof(header_size));
+    out.write(m_header.data(), static_cast<std::streamsize>(header_size));
+    uint64_t position = prefix_size + header_size;
+    const auto data_start = aligned(position);
+    const std::vector<char> padding(alignment, 0);
+    for (const auto &buffer : m_buffers) {
+      const auto begin = data_start + buffer.offset;
+      out.write(padding.data(), static_cast<std::streamsize>(begin - position));
+      buffer.write(out);
+      position = begin + buffer.size;
+    }
+    if (!out)
+      throw std::runtime_error("Failed to write '" + filename + "'.");
+  }
+
+  std::string m_header;
+  std::vector<Buffer> m_buffers;
+  uint64_t m_end{0};
+};
+
+void write_dims(HeaderWriter &header, const Dimensions &dims) {
+  header.u64(dims.ndim());
+  for (const auto &dim : dims.labels()) {
+    header.str(dim.name());
+    header.u64(dims[dim]);
+  }
+}
+
+/// Offsets of the characters of all elements and the concatenated
+/// characters, which are written as two buffers.
+template <class T>
+void write_strings(HeaderWriter &header, const Variable &var) {
+  const auto values = var.values<T>();
+  std::vector<int64_t> offsets(values.size() + 1, 0);
+  for (scipp::index i = 0; i < values.size(); ++i)
+    offsets[i + 1] = offsets[i] + std::string_view(values[i]).size();
+  const auto total = static_cast<uint64_t>(offsets.back());
+  const auto size = offsets.size() * sizeof(int64_t);
+  header.buffer(size, [offsets = std::move(offsets)](std::ostream &out) {
+    out.write(reinterpret_cast<const char *>(offsets.data()),
+              static_cast<std::streamsize>(offsets.size() * sizeof(int64_t)));
+  });
+  header.buffer(total, [var](std::ostream &out) {
+    for (const auto &value : var.values<T>()) {
+      const std::string_view str(value);
+      out.write(str.data(), static_cast<std::streamsize>(str.size()));
+    }
+  });
+}
+
+template <class T> struct WriteValues {
+  static void apply(HeaderWriter &header, const Variable &var) {
+    if constexpr (is_string_v<T>) {
+      write_strings<T>(header, var);
+    } else {
+      const auto size = var.dims().volume() * sizeof(T);
+      header.buffer(var.values<T>().data(), size, var);
+      if constexpr (core::canHaveVariances<T>())
+        if (var.has_variances())
+          header.buffer(var.variances<T>().data(), size, var);
+    }
+  }
+};
+
+void write_object(HeaderWriter &header, const Variable &var);
+void write_object(HeaderWriter &header, const DataArray &da);
+void write_object(HeaderWriter &header, const Dataset &dataset);
+
+template <class T>
+void write_bins(HeaderWriter &header, const Variable &var) {
+  const auto compact = compact_buffer<T>(var);
+  const auto &[indices, dim, buffer] = compact.template constituents<T>();
+  const auto contiguous = is_contiguous(indices) ? indices : copy(indices);
+  header.str(dim.name());
+  write_dims(header, contiguous.dims());
+  header.buffer(contiguous.template values<scipp::index_pair>().data(),
+                contiguous.dims().volume() * sizeof(scipp::index_pair),
+                contiguous);
+  write_object(header, buffer);
+}
+
+void write_variable(HeaderWriter &header, const Variable &var) {
+  if (var.dtype() == dtype<bucket<Variable>>) {
+    header.u8(static_cast<uint8_t>(Kind::Binned));
+    header.u8(static_cast<uint8_t>(Kind::Variable));
+    return write_bins<Variable>(header, var);
+  }
+  if (var.dtype() == dtype<bucket<DataArray>>) {
+    header.u8(static_cast<uint8_t>(Kind::Binned));
+    header.u8(static_cast<uint8_t>(Kind::DataArray));
+    return write_bins<DataArray>(header, var);
+  }
+  if (var.dtype() == dtype<bucket<Dataset>>) {
+    header.u8(static_cast<uint8_t>(Kind::Binned));
+    header.u8(static_cast<uint8_t>(Kind::Dataset));
+    return write_bins<Dataset>(header, var);
+  }
+  if (!supports(SupportedTypes{}, var.dtype()))
+    throw except::TypeError("Saving variables with dtype " +
+                            core::to_string(var.dtype()) +
+                            " is not supported.");
+  if (!is_contiguous(var))
+    return write_variable(header, copy(var));
+  header.u8(static_cast<uint8_t>(Kind::Dense));
+  header.str(core::to_string(var.dtype()));
+  write_dims(header, var.dims());
+  header.u8(var.unit() != units::none);
+  if (var.unit() != units::none)
+    header.str(units::to_string(var.unit()));
+  header.u8(var.has_variances());
+  SupportedTypes::apply<WriteValues>(var.dtype(), header, var);
+}
+
+template <class Mapping>
+void write_mapping(HeaderWriter &header, const Mapping &mapping) {
+  header.u64(mapping.size());
+  for (const auto &[key, var] : mapping) {
+    if constexpr (std::is_same_v<std::decay_t<decltype(key)>, Dim>)
+      header.str(key.name());
+    else
+      header.str(key);
+    write_variable(header, var);
+  }
+}
+
+void write_item(HeaderWriter &header, const DataArray &da) {
+  header.str(da.name());
+  write_variable(header, da.data());
+  write_mapping(header, da.masks());
+  write_mapping(header, da.attrs());
+}
+
+void write_object(HeaderWriter &header, const Variable &var) {
+  write_variable(header, var);
+}
+
+void write_object(HeaderWriter &header, const DataArray &da) {
+  write_item(header, da);
+  write_mapping(header, da.coords());
+}
+
+void write_object(HeaderWriter &header, const Dataset &dataset) {
+  // Coords of items are the coords of the dataset and are not repeated.
+  write_mapping(header, dataset.coords());
+  header.u64(dataset.size());
+  for (const auto &item : dataset)
+    write_item(header, item);
+}
+
+template <class T>
+void write_file(const std::string &filename, const T &obj, const Kind kind) {
+  HeaderWriter header;
+  header.u8(static_cast<uint8_t>(kind));
+  write_object(header, obj);
+  header.write(filename);
+}
+
+/// Read-only memory mapping of a complete file. Pages are mapped
+/// copy-on-write, such that variables using the memory can be modified
+/// without modifying the file.
+class Mapping {
+public:
+  explicit Mapping(const std::string &filename) {
+#ifdef _WIN32
+    m_file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                         nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                         nullptr);
+    if (m_file == INVALID_HANDLE_VALUE)
+      throw std::runtime_error("Failed to open '" + filename + "'.");
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(m_file, &size)) {
+      CloseHandle(m_file);
+      throw std::runtime_error("Failed to get size of '" + filename + "'.");
+    }
+    m_size = static_cast<uint64_t>(size.QuadPart);
+    if (m_size == 0) {
+      CloseHandle(m_file);
+      throw std::runtime_error("'" + filename + "' is empty.");
+    }
+    m_mapping =
+        CreateFileMappingA(m_file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (m_mapping != nullptr)
+      m_data = MapViewOfFile(m_mapping, FILE_MAP_COPY, 0, 0, 0);
+    if (m_data == nullptr) {
+      if (m_mapping != nullptr)
+        CloseHandle(m_mapping);
+      CloseHandle(m_file);
+      throw std::runtime_error("Failed to map '" + filename + "'.");
+    }
+#else
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+      throw std::runtime_error("Failed to open '" + filename + "'.");
+    struct stat info {};
+    if (fstat(fd, &info) != 0) {
+      close(fd);
+      throw std::runtime_error("Failed to get size of '" + filename + "'.");
+    }
+    m_size = static_cast<uint64_t>(info.st_size);
+    if (m_size == 0) {
+      close(fd);
+      throw std::runtime_error("'" + filename + "' is empty.");
+    }
+    m_data = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after closing the file.
+    close(fd);
+    if (m_data == MAP_FAILED)
+      throw std::runtime_error("Failed to map '" + filename + "'.");
+#endif
+  }
+  Mapping(const Mapping &) = delete;
+  Mapping &operator=(const Mapping &) = delete;
+  ~Mapping() {
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_mapping);
+    CloseHandle(m_file);
+#else
+    munmap(m_data, m_size);
+#endif
+  }
+
+  char *data() const noexcept { return static_cast<char *>(m_data); }
+  uint64_t size() const noexcept { return m_size; }
+
+private:
+  void *m_data{nullptr};
+  uint64_t m_size{0};
+#ifdef _WIN32
+  HANDLE m_file{INVALID_HANDLE_VALUE};
+  HANDLE m_mapping{nullptr};
+#endif
+};
+
+/// Provides the header and buffers of a file, either mapped or read.
+class Source {
+public:
+  Source(const std::string &filename, const ReadMode mode) {
+    std::string_view prefix;
+    std::string buffer;
+    if (mode == ReadMode::Map) {
+      m_mapping = std::make_shared<Mapping>(filename);
+      m_size = m_mapping->size();
+      prefix = std::string_view(m_mapping->data(),
+                                std::min(m_size, prefix_size));
+    } else {
+      m_file = std::make_unique<std::ifstream>(filename, std::ios::binary);
+      if (!*m_file)
+        throw std::runtime_error("Failed to open '" + filename + "'.");
+      m_file->seekg(0, std::ios::end);
+      m_size = static_cast<uint64_t>(m_file->tellg());
+      m_file->seekg(0);
+      buffer.resize(std::min(m_size, prefix_size));
+      m_file->read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      prefix = buffer;
+    }
+    uint32_t version{0};
+    uint32_t bom{0};
+    uint64_t header_size{0};
+    if (prefix.size() < prefix_size ||
+        std::memcmp(prefix.data(), magic, sizeof(magic)) != 0)
+      throw std::runtime_error("'" + filename +
+                               "' is not a file written by scipp.io.save.");
+    std::memcpy(&version, prefix.data() + 8, sizeof(version));
+    std::memcpy(&bom, prefix.data() + 12, sizeof(bom));
+    std::memcpy(&header_size, prefix.data() + 16, sizeof(header_size));
+    if (bom != byte_order_mark)
+      throw std::runtime_error("'" + filename +
+                               "' was written on a machine with different "
+                               "byte order.");
+    if (version != format_version)
+      throw std::runtime_error("Unsupported version " +
+                               std::to_string(version) + " of '" + filename +
+                               "'.");
+    if (prefix_size + header_size > m_size)
+      throw std::runtime_error("'" + filename + "' is truncated.");
+    m_data_start = aligned(prefix_size + header_size);
+    if (m_mapping) {
+      m_header = std::string_view(m_mapping->data() + prefix_size, header_size);
+    } else {
+      m_header_storage.resize(header_size);
+      m_file->read(m_header_storage.data(),
+                   static_cast<std::streamsize>(header_size));
+      m_header = m_header_storage;
+    }
+  }
+
+  uint8_t u8() {
+    const auto bytes = take(1);
+    return static_cast<uint8_t>(bytes[0]);
+  }
+  uint64_t u64() {
+    uint64_t value;
+    std::memcpy(&value, take(sizeof(value)).data(), sizeof(value));
+    return value;
+  }
+  std::string str() { return std::string(take(u64())); }
+
+  /// Return the elements of the next buffer in the header.
+  template <class T> element_array<T> array(const scipp::index size) {
+    const auto offset = m_data_start + u64();
+    const auto bytes = u64();
+    if (bytes != size * sizeof(T) || offset + bytes > m_size)
+      throw std::runtime_error("Invalid buffer in file.");
+    if (m_mapping)
+      return element_array<T>(reinterpret_cast<T *>(m_mapping->data() + offset),
+                              size, m_mapping);
+    element_array<T> out(size, core::init_for_overwrite);
+    m_file->seekg(static_cast<std::streamoff>(offset));
+    m_file->read(reinterpret_cast<char *>(out.data()),
+                 static_cast<std::streamsize>(bytes));
+    if (!*m_file)
+      throw std::runtime_error("Failed to read buffer from file.");
+    return out;
+  }
+
+private:
+  std::string_view take(const uint64_t n) {
+    if (n > m_header.size())
+      throw std::runtime_error("Invalid header in file.");
+    const auto out = m_header.substr(0, n);
+    m_header.remove_prefix(n);
+    return out;
+  }
+
+  std::shared_ptr<Mapping> m_mapping;
+  std::unique_ptr<std::ifstream> m_file;
+  uint64_t m_size{0};
+  uint64_t m_data_start{0};
+  std::string m_header_storage;
+  std::string_view m_header;
+};
+
+Dimensions read_dims(Source &source) {
+  Dimensions dims;
+  const auto ndim = source.u64();
+  for (uint64_t i = 0; i < ndim; ++i) {
+    const Dim dim(source.str());
+    dims.addInner(dim, static_cast<scipp::index>(source.u64()));
+  }
+  return dims;
+}
+
+template <class T> struct ReadValues {
+  static Variable apply(Source &source, const Dimensions &dims,
+                        const units::Unit &unit, const bool variances) {
+    const auto size = dims.volume();
+    if constexpr (is_string_v<T>) {
+      const auto offsets = source.array<int64_t>(size + 1);
+      const auto *o = offsets.data();
+      for (scipp::index i = 0; i < size; ++i)
+        if (o[0] != 0 || o[i + 1] < o[i])
+          throw std::runtime_error("Invalid string offsets in file.");
+      auto chars = std::make_shared<variable::StringArrayModel::buffer_type>(
+          source.array<char>(o[size]));
+      element_array<std::string_view> views(size, core::init_for_overwrite);
+      for (scipp::index i = 0; i < size; ++i)
+        views.data()[i] =
+            std::string_view(chars->data() + o[i], o[i + 1] - o[i]);
+      if constexpr (std::is_same_v<T, std::string_view>) {
+        return Variable(dims, variable::StringArrayModel::make(
+                                  std::move(views), std::move(chars), unit));
+      } else if constexpr (std::is_same_v<T, core::categorical_string>) {
+        // Codes are only valid in the writing process, the file stores the
+        // strings.
+        return Variable(dims, variable::CategoricalStringArrayModel::make(
+                                  {views.data(), static_cast<size_t>(size)},
+                                  unit));
+      } else {
+        element_array<T> values(views.begin(), views.end());
+        return Variable(dims, std::make_shared<variable::ElementArrayModel<T>>(
+                                  size, unit, std::move(values)));
+      }
+    } else if constexpr (core::is_structured(dtype<T>)) {
+      // The buffer holds `count` doubles per element.
+      constexpr auto count = sizeof(T) / sizeof(double);
+      return variable::make_structures<T, double>(
+          dims, unit,
+          source.array<double>(size * static_cast<scipp::index>(count)));
+    } else {
+      auto values = source.array<T>(size);
+      std::optional<element_array<T>> vars;
+      if (variances)
+        vars = source.array<T>(size);
+      return Variable(dims,
+                      std::make_shared<variable::ElementArrayModel<T>>(
+                          size, unit, std::move(values), std::move(vars)));
+    }
+  }
+};
+
+Variable read_variable(Source &source);
+DataArray read_data_array(Source &source);
+Dataset read_dataset(Source &source);
+
+Variable read_bins(Source &source) {
+  const auto kind = static_cast<Kind>(source.u8());
+  const Dim dim(source.str());
+  const auto dims = read_dims(source);
+  // Indices are copied, they are small compared to the buffer.
+  const auto stored = source.array<scipp::index_pair>(dims.volume());
+  auto indices = makeVariable<scipp::index_pair>(dims, units::none);
+  std::copy(stored.begin(), stored.end(),
+            indices.values<scipp::index_pair>().begin());
+  if (kind == Kind::Variable)
+    return make_bins(std::move(indices), dim, read_variable(source));
+  if (kind == Kind::DataArray)
+    return make_bins(std::move(indices), dim, read_data_array(source));
+  if (kind == Kind::Dataset)
+    return make_bins(std::move(indices), dim, read_dataset(source));
+  throw std::runtime_error("Invalid header in file.");
+}
+
+Variable read_variable(Source &source) {
+  const auto kind = static_cast<Kind>(source.u8());
+  if (kind == Kind::Binned)
+    return read_bins(source);
+  if (kind != Kind::Dense)
+    throw std::runtime_error("Invalid header in file.");
+  const auto type = core::dtype_from_name(source.str());
+  const auto dims = read_dims(source);
+  const auto unit = source.u8() ? units::Unit(source.str()) : units::none;
+  const bool variances = source.u8();
+  return SupportedTypes::apply<ReadValues>(type, source, dims, unit,
+                                           variances);
+}
+
+template <class Map> Map read_mapping(Source &source) {
+  Map out;
+  const auto size = source.u64();
+  for (uint64_t i = 0; i < size; ++i) {
+    typename Map::key_type key(source.str());
+    out.emplace(std::move(key), read_variable(source));
+  }
+  return out;
+}
+
+/// Read a data array without coords.
+DataArray read_item(Source &source) {
+  auto name = source.str();
+  auto data = read_variable(source);
+  auto masks = read_mapping<Masks::holder_type>(source);
+  auto attrs = read_mapping<Attrs::holder_type>(source);
+  return DataArray(std::move(data), {}, std::move(masks), std::move(attrs),
+                   name);
+}
+
+DataArray read_data_array(Source &source) {
+  auto da = read_item(source);
+  for (auto &&[dim, coord] : read_mapping<Coords::holder_type>(source))
+    da.coords().set(dim, std::move(coord));
+  return da;
+}
+
+Dataset read_dataset(Source &source) {
+  const auto coords = read_mapping<Coords::holder_type>(source);
+  Dataset out;
+  const auto size = source.u64();
+  for (uint64_t i = 0; i < size; ++i) {
+    auto item = read_item(source);
+    const auto name = item.name();
+    out.setData(name, std::move(item));
+  }
+  for (const auto &[dim, coord] : coords)
+    out.setCoord(dim, coord);
+  return out;
+}
+
+std::string kind_name(const Kind kind) {
+  if (kind == Kind::Variable)
+    return "Variable";
+  if (kind == Kind::DataArray)
+    return "DataArray";
+  if (kind == Kind::Dataset)
+    return "Dataset";
+  throw std::runtime_error("Invalid header in file.");
+}
+
+void check_kind(Source &source, const Kind kind) {
+  const auto found = static_cast<Kind>(source.u8());
+  if (found != kind)
+    throw std::runtime_error("Attempt to read " + kind_name(kind) +
+                             ", found " + kind_name(found) + ".");
+}
+} // namespace
+
+void write(const std::string &filename, const Variable &obj) {
+  write_file(filename, obj, Kind::Variable);
+}
+
+void write(const std::string &filename, const DataArray &obj) {
+  write_file(filename, obj, Kind::DataArray);
+}
+
+void write(const std::string &filename, const Dataset &obj) {
+  write_file(filename, obj, Kind::Dataset);
+}
+
+std::string object_type(const std::string &filename) {
+  Source source(filename, ReadMode::Read);
+  return kind_name(static_cast<Kind>(source.u8()));
+}
+
+Variable read_variable(const std::string &filename, const ReadMode mode) {
+  Source source(filename, mode);
+  check_kind(source, Kind::Variable);
+  return read_variable(source);
+}
+
+DataArray read_data_array(const std::string &filename, const ReadMode mode) {
+  Source source(filename, mode);
+  check_kind(source, Kind::DataArray);
+  return read_data_array(source);
+}
+
+Dataset read_dataset(const std::string &filename, const ReadMode mode) {
+  Source source(filename, mode);
+  check_kind(source, Kind::Dataset);
+  return read_dataset(source);
+}
+
+} // namespace scipp::dataset::binary_io
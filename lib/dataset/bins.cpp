@@ -311,12 +311,26 @@ Variable histogram(const Variable &data, const Variable &binEdges) {
   const Dim dummy = Dim::InternalHistogram;
   if (indices.dims().contains(hist_dim))
     indices.rename(hist_dim, dummy);
-  const auto masked = masked_data(buffer, dim);
-  auto hist = variable::transform_subspan(
-      buffer.dtype(), hist_dim, binEdges.dims()[hist_dim] - 1,
-      subspan_view(buffer.meta()[hist_dim], dim, indices),
-      subspan_view(masked, dim, indices), binEdges, element::histogram,
-      "histogram");
+  // Masked events are skipped, instead of histogramming a copy of the buffer
+  // with masked values replaced by zero.
+  const auto mask = irreducible_mask(buffer.masks(), dim);
+  const auto hist_ = [&](const auto &... args) {
+    return variable::transform_subspan(
+        buffer.dtype(), hist_dim, binEdges.dims()[hist_dim] - 1,
+        subspan_view(buffer.meta()[hist_dim], dim, indices),
+        subspan_view(buffer.data(), dim, indices), binEdges, args...,
+        "histogram");
+  };
+  const bool linspace = is_linspace_edges(binEdges, hist_dim);
+  Variable hist;
+  if (mask.is_valid())
+    hist = linspace ? hist_(subspan_view(mask, dim, indices),
+                            element::masked_histogram_linspace)
+                    : hist_(subspan_view(mask, dim, indices),
+                            element::masked_histogram);
+  else
+    hist = linspace ? hist_(element::histogram_linspace)
+                    : hist_(element::histogram);
   if (hist.dims().contains(dummy))
     return sum(hist, dummy);
   else
@@ -24,4 +24,17 @@ Variable hide_masked(const Variable &data, const Masks &masks,
   return make_bins_no_validate(indices, buffer_dim, buffer);
 }
 
+/// Return `var`, or a copy with a compact buffer if the buffer of `var` is
+/// much larger than the bins, e.g., due to over-allocation or if `var` is a
+/// slice. Used for avoiding writing unused parts of buffers to files.
+template <class T> Variable compact_buffer(const Variable &var) {
+  const auto &[indices, dim, buffer] = var.constituents<T>();
+  scipp::index size = 0;
+  for (const auto &[begin, end] : indices.template values<scipp::index_pair>())
+    size += end - begin;
+  if (static_cast<double>(buffer.dims()[dim]) > 1.5 * static_cast<double>(size))
+    return copy(var);
+  return var;
+}
+
 } // namespace scipp::dataset
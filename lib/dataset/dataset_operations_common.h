@@ -4,7 +4,7 @@
 /// @author Simon Heybrock
 #pragma once
 
-#include <unordered_map>
+#include <algorithm>
 
 #include "scipp/dataset/dataset.h"
 #include "scipp/dataset/except.h"
@@ -14,7 +14,7 @@ namespace scipp::dataset {
 
 template <class T1, class T2>
 auto union_(const T1 &a, const T2 &b, const std::string_view opname) {
-  std::unordered_map<typename T1::key_type, typename T1::mapped_type> out;
+  core::small_flat_map<typename T1::key_type, typename T1::mapped_type> out;
 
   for (const auto &[key, item] : a)
     out.emplace(key, item);
@@ -31,7 +31,7 @@ auto union_(const T1 &a, const T2 &b, const std::string_view opname) {
 /// Return intersection of maps, i.e., all items with matching names that
 /// have matching content.
 template <class Map> auto intersection(const Map &a, const Map &b) {
-  std::unordered_map<typename Map::key_type, Variable> out;
+  core::small_flat_map<typename Map::key_type, Variable> out;
   for (const auto &[key, item] : a)
     if (const auto it = b.find(key);
         it != b.end() && equals_nan(it->second, item))
@@ -41,7 +41,7 @@ template <class Map> auto intersection(const Map &a, const Map &b) {
 
 /// Return a copy of map-like objects such as CoordView.
 template <class T> auto copy_map(const T &map) {
-  std::unordered_map<typename T::key_type, typename T::mapped_type> out;
+  core::small_flat_map<typename T::key_type, typename T::mapped_type> out;
   for (const auto &[key, item] : map)
     out.emplace(key, copy(item));
   return out;
@@ -56,13 +56,13 @@ DataArray apply_or_copy_dim_impl(const DataArray &a, Func func, const Dim dim,
       if (!coord.dims().contains(dim))
         coords_.emplace(d, share ? coord : copy(coord));
   };
-  std::unordered_map<Dim, Variable> coords;
+  typename Coords::holder_type coords;
   copy_independent(coords, a.coords(), true);
 
-  std::unordered_map<Dim, Variable> attrs;
+  typename Attrs::holder_type attrs;
   copy_independent(attrs, a.attrs(), true);
 
-  std::unordered_map<std::string, Variable> masks;
+  typename Masks::holder_type masks;
   copy_independent(masks, a.masks(), false);
 
   if constexpr (ApplyToData) {
@@ -89,6 +89,34 @@ DataArray apply_to_data_and_drop_dim(const DataArray &a, Func func,
                                       std::forward<Args>(args)...);
 }
 
+/// As `apply_to_data_and_drop_dim`, but for operations dropping all of `dims`,
+/// such as reductions along multiple dimensions.
+template <class Func, class... Args>
+DataArray apply_to_data_and_drop_dims(const DataArray &a, Func func,
+                                      const scipp::span<const Dim> dims,
+                                      Args &&...args) {
+  const auto copy_independent = [dims](auto &coords_, const auto &view,
+                                       const bool share) {
+    for (auto &&[key, item] : view)
+      if (std::none_of(dims.begin(), dims.end(), [&item](const Dim dim) {
+            return item.dims().contains(dim);
+          }))
+        coords_.emplace(key, share ? item : copy(item));
+  };
+  typename Coords::holder_type coords;
+  copy_independent(coords, a.coords(), true);
+
+  typename Attrs::holder_type attrs;
+  copy_independent(attrs, a.attrs(), true);
+
+  typename Masks::holder_type masks;
+  copy_independent(masks, a.masks(), false);
+
+  return DataArray(func(a.data(), dims, std::forward<Args>(args)...),
+                   std::move(coords), std::move(masks), std::move(attrs),
+                   a.name());
+}
+
 /// Helper for creating operations that return an object with a dropped
 /// dimension or different dimension extent.
 ///
@@ -129,7 +157,7 @@ Dataset apply_to_items(const Dataset &d, Func func, Args &&...args) {
 /// If `func` returns an invalid object it will not be inserted into the output
 /// map. This can be used to drop/filter items.
 template <class T, class Func> auto transform_map(const T &map, Func func) {
-  std::unordered_map<typename T::key_type, typename T::mapped_type> out;
+  core::small_flat_map<typename T::key_type, typename T::mapped_type> out;
   for (const auto &[key, item] : map) {
     auto transformed = func(item);
     if (transformed.is_valid())
@@ -173,9 +201,55 @@ template <class T, class Func> DataArray transform(const T &a, Func func) {
                            const Masks &masks);
 [[nodiscard]] Variable any(const Variable &var, const Dim dim,
                            const Masks &masks);
+// Reductions along all of the given dims in a single pass.
+[[nodiscard]] Variable mean(const Variable &var,
+                            const scipp::span<const Dim> dims,
+                            const Masks &masks);
+[[nodiscard]] Variable nanmean(const Variable &var,
+                               const scipp::span<const Dim> dims,
+                               const Masks &masks);
+[[nodiscard]] Variable sum(const Variable &var,
+                           const scipp::span<const Dim> dims,
+                           const Masks &masks);
+[[nodiscard]] Variable nansum(const Variable &var,
+                              const scipp::span<const Dim> dims,
+                              const Masks &masks);
+[[nodiscard]] Variable max(const Variable &var,
+                           const scipp::span<const Dim> dims,
+                           const Masks &masks);
+[[nodiscard]] Variable nanmax(const Variable &var,
+                              const scipp::span<const Dim> dims,
+                              const Masks &masks);
+[[nodiscard]] Variable min(const Variable &var,
+                           const scipp::span<const Dim> dims,
+                           const Masks &masks);
+[[nodiscard]] Variable nanmin(const Variable &var,
+                              const scipp::span<const Dim> dims,
+                              const Masks &masks);
+[[nodiscard]] Variable all(const Variable &var,
+                           const scipp::span<const Dim> dims,
+                           const Masks &masks);
+[[nodiscard]] Variable any(const Variable &var,
+                           const scipp::span<const Dim> dims,
+                           const Masks &masks);
+// Selection-based reductions, Dim::Invalid selects all dims.
+[[nodiscard]] Variable median(const Variable &var, const Dim dim,
+                              const Masks &masks);
+[[nodiscard]] Variable nanmedian(const Variable &var, const Dim dim,
+                                 const Masks &masks);
+[[nodiscard]] Variable quantile(const Variable &var, const double q,
+                                const Dim dim, const Masks &masks);
+[[nodiscard]] Variable argmin(const Variable &var, const Dim dim,
+                              const Masks &masks);
+[[nodiscard]] Variable argmax(const Variable &var, const Dim dim,
+                              const Masks &masks);
+[[nodiscard]] Variable topk(const Variable &var, const scipp::index k,
+                            const Dim dim, const Masks &masks);
 
 [[nodiscard]] Variable
 masked_data(const DataArray &array, const Dim dim,
             const std::optional<Variable> &fill_value = std::nullopt);
 
+[[nodiscard]] bool is_linspace_edges(const Variable &edges, const Dim dim);
+
 } // namespace scipp::dataset
@@ -2,6 +2,7 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <limits>
 #include <numeric>
 
 #include "scipp/core/bucket.h"
@@ -32,6 +33,13 @@ namespace scipp::dataset {
 
 namespace {
 
+/// Slicing has a significant overhead, so each slice counts as a large item
+/// and the range is split based on the number of threads only.
+scipp::index grainsize_for_slices(const scipp::index size) {
+  return core::parallel::grainsize(size,
+                                   std::numeric_limits<scipp::index>::max());
+}
+
 template <class Slices, class Data>
 auto copy_impl(const Slices &slices, const Data &data, const Dim slice_dim,
                const AttrPolicy attrPolicy = AttrPolicy::Keep) {
@@ -55,8 +63,10 @@ auto copy_impl(const Slices &slices, const Data &data, const Dim slice_dim,
           out.slice(out_slice), attrPolicy);
     }
   };
-  core::parallel::parallel_for(core::parallel::blocked_range(0, slices.size()),
-                               copy_slice);
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, slices.size(),
+                                    grainsize_for_slices(slices.size())),
+      copy_slice);
   return out;
 }
 
@@ -108,42 +118,53 @@ T GroupBy<T>::makeReductionOutput(const Dim reductionDim,
 }
 
 namespace {
-template <class Op, class Groups>
-void reduce_(Op op, const Dim reductionDim, const Variable &out_data,
-             const DataArray &data, const Dim dim, const Groups &groups,
-             const FillValue fill) {
+/// Apply `op` to each group. If given, `masked_op` is used instead if there are
+/// masks, skipping masked elements without creating a masked copy of the data.
+template <class Op, class MaskedOp, class Groups>
+void reduce_(Op op, MaskedOp masked_op, const Dim reductionDim,
+             const Variable &out_data, const DataArray &data, const Dim dim,
+             const Groups &groups, const FillValue fill) {
   const auto mask_replacement =
       special_like(Variable(data.data(), Dimensions{}), fill);
   auto mask = irreducible_mask(data.masks(), reductionDim);
+  constexpr bool has_masked_op = !std::is_same_v<MaskedOp, std::nullptr_t>;
+  const bool use_masked_op = has_masked_op && !is_bins(data.data());
   const auto process = [&](const auto &range) {
     // Apply to each group, storing result in output slice
     for (scipp::index group = range.begin(); group != range.end(); ++group) {
       auto out_slice = out_data.slice({dim, group});
       for (const auto &slice : groups[group]) {
         const auto data_slice = data.data().slice(slice);
-        if (mask.is_valid())
-          op(out_slice, where(mask.slice(slice), mask_replacement, data_slice));
-        else
+        if (!mask.is_valid()) {
           op(out_slice, data_slice);
+        } else if (use_masked_op) {
+          if constexpr (has_masked_op)
+            masked_op(out_slice, data_slice, mask.slice(slice));
+        } else {
+          op(out_slice, where(mask.slice(slice), mask_replacement, data_slice));
+        }
       }
     }
   };
-  core::parallel::parallel_for(core::parallel::blocked_range(0, groups.size()),
-                               process);
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, groups.size(),
+                                    grainsize_for_slices(groups.size())),
+      process);
 }
 } // namespace
 
 template <class T>
-template <class Op>
-T GroupBy<T>::reduce(Op op, const Dim reductionDim,
-                     const FillValue fill) const {
+template <class Op, class MaskedOp>
+T GroupBy<T>::reduce(Op op, const Dim reductionDim, const FillValue fill,
+                     MaskedOp masked_op) const {
   auto out = makeReductionOutput(reductionDim, fill);
   if constexpr (std::is_same_v<T, Dataset>) {
     for (const auto &item : m_data)
-      reduce_(op, reductionDim, out[item.name()].data(), item, dim(), groups(),
-              fill);
+      reduce_(op, masked_op, reductionDim, out[item.name()].data(), item, dim(),
+              groups(), fill);
   } else {
-    reduce_(op, reductionDim, out.data(), m_data, dim(), groups(), fill);
+    reduce_(op, masked_op, reductionDim, out.data(), m_data, dim(), groups(),
+            fill);
   }
   return out;
 }
@@ -167,12 +188,14 @@ template <class T> T GroupBy<T>::concat(const Dim reductionDim) const {
 
 /// Reduce each group using `sum` and return combined data.
 template <class T> T GroupBy<T>::sum(const Dim reductionDim) const {
-  return reduce(variable::sum_into, reductionDim, FillValue::ZeroNotBool);
+  return reduce(variable::sum_into, reductionDim, FillValue::ZeroNotBool,
+                variable::masked_sum_into);
 }
 
 /// Reduce each group using `nansum` and return combined data.
 template <class T> T GroupBy<T>::nansum(const Dim reductionDim) const {
-  return reduce(variable::nansum_into, reductionDim, FillValue::ZeroNotBool);
+  return reduce(variable::nansum_into, reductionDim, FillValue::ZeroNotBool,
+                variable::masked_nansum_into);
 }
 
 /// Reduce each group using `all` and return combined data.
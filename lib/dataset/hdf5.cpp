@@ -0,0 +1,770 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <map>
+#include <memory>
+
+#include "scipp/core/eigen.h"
+#include "scipp/core/except.h"
+#include "scipp/core/spatial_transforms.h"
+#include "scipp/core/string.h"
+#include "scipp/core/tag_util.h"
+#include "scipp/dataset/bins.h"
+#include "scipp/dataset/hdf5.h"
+#include "scipp/units/string.h"
+#include "scipp/variable/astype.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/creation.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/util.h"
+
+#include "bins_util.h"
+#include "hdf5_detail.h"
+
+namespace scipp::dataset::hdf5 {
+
+using namespace detail;
+
+namespace {
+
+#ifdef SCIPP_VERSION
+constexpr auto version = SCIPP_VERSION;
+#else
+constexpr auto version = "unknown version";
+#endif
+
+/// Elements of type T are stored as arrays of `value_type` with trailing dims
+/// given by `shape`. Matrices are stored in row-major order, as NumPy shows
+/// them, i.e., transposed compared to Eigen's memory layout.
+template <class T> struct Layout {
+  using value_type = T;
+  static Shape shape() { return {}; }
+};
+template <> struct Layout<std::string_view> : Layout<std::string> {};
+template <> struct Layout<core::categorical_string> : Layout<std::string> {};
+template <> struct Layout<core::time_point> : Layout<int64_t> {};
+template <> struct Layout<Eigen::Vector3d> : Layout<double> {
+  static Shape shape() { return {3}; }
+};
+template <> struct Layout<core::Translation> : Layout<Eigen::Vector3d> {};
+template <> struct Layout<core::Quaternion> : Layout<double> {
+  static Shape shape() { return {4}; }
+};
+template <> struct Layout<Eigen::Matrix3d> : Layout<double> {
+  static Shape shape() { return {3, 3}; }
+};
+template <> struct Layout<Eigen::Affine3d> : Layout<double> {
+  static Shape shape() { return {4, 4}; }
+};
+
+template <class T>
+constexpr bool is_matrix_v = std::is_same_v<T, Eigen::Matrix3d> ||
+                             std::is_same_v<T, Eigen::Affine3d>;
+
+template <class T>
+constexpr int matrix_size = std::is_same_v<T, Eigen::Matrix3d> ? 3 : 4;
+
+const Eigen::Matrix3d &matrix(const Eigen::Matrix3d &x) { return x; }
+const Eigen::Matrix4d &matrix(const Eigen::Affine3d &x) { return x.matrix(); }
+Eigen::Matrix3d &matrix(Eigen::Matrix3d &x) { return x; }
+Eigen::Matrix4d &matrix(Eigen::Affine3d &x) { return x.matrix(); }
+
+template <class T> hid_t native_type() {
+  if constexpr (std::is_same_v<T, double>)
+    return H5T_NATIVE_DOUBLE;
+  else if constexpr (std::is_same_v<T, float>)
+    return H5T_NATIVE_FLOAT;
+  else if constexpr (std::is_same_v<T, int64_t>)
+    return H5T_NATIVE_INT64;
+  else if constexpr (std::is_same_v<T, int32_t>)
+    return H5T_NATIVE_INT32;
+  else if constexpr (std::is_same_v<T, int16_t>)
+    return H5T_NATIVE_INT16;
+  else if constexpr (std::is_same_v<T, int8_t>)
+    return H5T_NATIVE_INT8;
+  else if constexpr (std::is_same_v<T, uint64_t>)
+    return H5T_NATIVE_UINT64;
+  else if constexpr (std::is_same_v<T, uint32_t>)
+    return H5T_NATIVE_UINT32;
+  else if constexpr (std::is_same_v<T, uint16_t>)
+    return H5T_NATIVE_UINT16;
+  else
+    return H5T_NATIVE_UINT8;
+}
+
+template <class T> Handle memory_type() {
+  if constexpr (std::is_same_v<T, bool>)
+    return bool_type();
+  else if constexpr (std::is_same_v<T, core::float16>)
+    return float16_type();
+  else if constexpr (std::is_same_v<T, std::string>)
+    return string_type();
+  else
+    return Handle(H5Tcopy(native_type<T>()), H5Tclose, "copy type");
+}
+
+/// Dtypes of dense variables with native support for writing.
+using WritableTypes =
+    core::CallDType<double, float, core::float16, int64_t, int32_t, int16_t,
+                    int8_t, uint64_t, uint32_t, uint16_t, uint8_t, bool,
+                    core::time_point, std::string, std::string_view,
+                    core::categorical_string, Eigen::Vector3d, Eigen::Matrix3d,
+                    Eigen::Affine3d, core::Quaternion, core::Translation>;
+/// Dtypes of dense variables with native support for reading. Elements of
+/// dtype string_view are stored with dtype string.
+using ReadableTypes =
+    core::CallDType<double, float, core::float16, int64_t, int32_t, int16_t,
+                    int8_t, uint64_t, uint32_t, uint16_t, uint8_t, bool,
+                    core::time_point, std::string, core::categorical_string,
+                    Eigen::Vector3d, Eigen::Matrix3d, Eigen::Affine3d,
+                    core::Quaternion, core::Translation>;
+
+template <class... Ts>
+bool supports(core::CallDType<Ts...>, const DType type) {
+  return ((type == dtype<Ts>) || ...);
+}
+
+Filters make_filters(const WriteOptions &options) {
+  if (options.compression_level < 0 || options.compression_level > 9)
+    throw std::invalid_argument("Compression level must be in [0, 9], got " +
+                                std::to_string(options.compression_level) +
+                                ".");
+  if (options.chunk_bytes < 0)
+    throw std::invalid_argument("Chunk size must not be negative.");
+  return {options.compression == Compression::Gzip
+              ? options.compression_level
+              : -1,
+          options.shuffle, static_cast<hsize_t>(options.chunk_bytes)};
+}
+
+/// Name of a group holding an item of a mapping, which is valid in HDF5
+/// (without '.' and '/') and ASCII. Equivalent to
+/// `scipp.io.hdf5.collection_element_name`.
+std::string element_name(const std::string &name, const scipp::index index) {
+  auto number = std::to_string(index);
+  if (number.size() < 3)
+    number.insert(0, 3 - number.size(), '0');
+  std::string out = "elem_" + number + "_";
+  for (size_t i = 0; i < name.size(); ++i) {
+    const auto c = static_cast<unsigned char>(name[i]);
+    const size_t extra = c >= 0xf0 ? 3 : c >= 0xe0 ? 2 : c >= 0xc0 ? 1 : 0;
+    uint32_t code = extra == 0 ? c : c & (0x3fu >> extra);
+    for (size_t k = 1; k <= extra && i + 1 < name.size(); ++k)
+      code = (code << 6) | (static_cast<unsigned char>(name[++i]) & 0x3fu);
+    if (code == '.' || code == '/' || code > 0x7f)
+      out += "&#" + std::to_string(code) + ";";
+    else
+      out += static_cast<char>(code);
+  }
+  return out;
+}
+
+Shape file_shape(const Dimensions &dims, const Shape &inner) {
+  Shape shape(dims.shape().begin(), dims.shape().end());
+  shape.insert(shape.end(), inner.begin(), inner.end());
+  return shape;
+}
+
+void write_header(const hid_t group, const std::string &type) {
+  write_attribute(group, "scipp-version", version);
+  write_attribute(group, "scipp-type", type);
+}
+
+void check_header(const hid_t group, const std::string &type) {
+  if (!has_attribute(group, "scipp-version"))
+    throw std::runtime_error(
+        "This does not look like an HDF5 file/group written by scipp.");
+  const auto found = read_string_attribute(group, "scipp-type");
+  if (found != type)
+    throw std::runtime_error("Attempt to read " + type + ", found " + found +
+                             ".");
+}
+
+void write_metadata(const hid_t values, const Dimensions &dims,
+                    const std::string &type, const units::Unit &unit) {
+  std::vector<std::string> labels;
+  for (const auto &dim : dims.labels())
+    labels.emplace_back(dim.name());
+  write_attribute(values, "dims", labels);
+  const auto shape = dims.shape();
+  write_attribute(values, "shape",
+                  std::vector<scipp::index>(shape.begin(), shape.end()));
+  write_attribute(values, "dtype", type);
+  if (unit != units::none)
+    write_attribute(values, "unit", units::to_string(unit));
+}
+
+template <class T>
+Handle write_elements(const hid_t group, const std::string &name,
+                      const Dimensions &dims,
+                      const ElementArrayView<const T> &elements,
+                      const Filters &filters) {
+  const auto type = memory_type<typename Layout<T>::value_type>();
+  const auto shape = file_shape(dims, Layout<T>::shape());
+  if constexpr (std::is_same_v<T, std::string>) {
+    std::vector<const char *> data;
+    for (const auto &str : elements)
+      data.push_back(str.c_str());
+    return write_dataset(group, name, type, shape, data.data(), filters);
+  } else if constexpr (std::is_same_v<T, core::categorical_string>) {
+    // Characters are owned by the dictionaries and null-terminated.
+    std::vector<const char *> data;
+    for (const auto &str : elements)
+      data.push_back(str.str().c_str());
+    return write_dataset(group, name, type, shape, data.data(), filters);
+  } else if constexpr (std::is_same_v<T, std::string_view>) {
+    // Views are not null-terminated.
+    const std::vector<std::string> strings(elements.begin(), elements.end());
+    std::vector<const char *> data;
+    for (const auto &str : strings)
+      data.push_back(str.c_str());
+    return write_dataset(group, name, type, shape, data.data(), filters);
+  } else if constexpr (is_matrix_v<T>) {
+    constexpr auto n = matrix_size<T>;
+    std::vector<double> data;
+    data.reserve(elements.size() * n * n);
+    for (const auto &element : elements)
+      for (int row = 0; row < n; ++row)
+        for (int col = 0; col < n; ++col)
+          data.push_back(matrix(element)(row, col));
+    return write_dataset(group, name, type, shape, data.data(), filters);
+  } else {
+    return write_dataset(group, name, type, shape, elements.data(), filters);
+  }
+}
+
+template <class T> struct WriteValues {
+  static Handle apply(const hid_t group, const Variable &var,
+                      const Filters &filters) {
+    auto values = write_elements<T>(group, "values", var.dims(),
+                                    var.values<T>(), filters);
+    if constexpr (core::canHaveVariances<T>()) {
+      if (var.has_variances()) {
+        write_elements<T>(group, "variances", var.dims(), var.variances<T>(),
+                          filters);
+        write_reference_attribute(values, "variances", group, "variances");
+      }
+    }
+    return values;
+  }
+};
+
+/// Write the begin or end indices of bins as a variable of dtype int64.
+void write_indices(const hid_t group, const Variable &indices,
+                   const hsize_t offset, const Filters &filters) {
+  write_header(group, "Variable");
+  const auto *data = reinterpret_cast<const scipp::index *>(
+      indices.values<scipp::index_pair>().data());
+  const auto type = memory_type<int64_t>();
+  const auto values = write_dataset(group, "values", type,
+                                    file_shape(indices.dims(), {}), data,
+                                    filters, 2, offset);
+  write_metadata(values, indices.dims(), "int64", units::none);
+}
+
+void write_variable(hid_t group, const Variable &var, const Filters &filters);
+void write_data_array(hid_t group, const DataArray &da, const Filters &filters,
+                      const std::pair<hid_t, std::map<std::string, std::string>>
+                          *coord_links = nullptr);
+void write_dataset(hid_t group, const Dataset &dataset, const Filters &filters);
+
+void write_object(const hid_t group, const Variable &var,
+                  const Filters &filters) {
+  write_variable(group, var, filters);
+}
+void write_object(const hid_t group, const DataArray &da,
+                  const Filters &filters) {
+  write_data_array(group, da, filters);
+}
+void write_object(const hid_t group, const Dataset &dataset,
+                  const Filters &filters) {
+  write_dataset(group, dataset, filters);
+}
+
+template <class T>
+Handle write_bins(const hid_t group, const Variable &var,
+                  const Filters &filters) {
+  const auto compact = compact_buffer<T>(var);
+  const auto &[indices, dim, buffer] = compact.template constituents<T>();
+  auto values = create_group(group, "values");
+  const auto contiguous = is_contiguous(indices) ? indices : copy(indices);
+  write_indices(create_group(values, "begin"), contiguous, 0, filters);
+  write_indices(create_group(values, "end"), contiguous, 1, filters);
+  const auto data = create_group(values, "data");
+  write_attribute(data, "dim", dim.name());
+  write_object(data, buffer, filters);
+  return values;
+}
+
+Handle write_values(const hid_t group, const Variable &var,
+                    const Filters &filters) {
+  if (var.dtype() == dtype<bucket<Variable>>)
+    return write_bins<Variable>(group, var, filters);
+  if (var.dtype() == dtype<bucket<DataArray>>)
+    return write_bins<DataArray>(group, var, filters);
+  if (var.dtype() == dtype<bucket<Dataset>>)
+    return write_bins<Dataset>(group, var, filters);
+  if (!supports(WritableTypes{}, var.dtype()))
+    throw except::TypeError("Writing variables with dtype " +
+                            core::to_string(var.dtype()) +
+                            " to HDF5 is not supported.");
+  if (!is_contiguous(var))
+    return write_values(group, copy(var), filters);
+  return WritableTypes::apply<WriteValues>(var.dtype(), group, var, filters);
+}
+
+void write_variable(const hid_t group, const Variable &var,
+                    const Filters &filters) {
+  write_header(group, "Variable");
+  const auto values = write_values(group, var, filters);
+  write_metadata(values, var.dims(),
+                 core::to_string(var.dtype() == dtype<std::string_view>
+                                     ? dtype<std::string>
+                                     : var.dtype()),
+                 var.unit());
+}
+
+std::string key_name(const Dim dim) { return dim.name(); }
+const std::string &key_name(const std::string &name) { return name; }
+
+/// Write the items of `mapping` into groups and return the names of the
+/// groups by item name. Items in `links` are not written, but linked to the
+/// existing group given by the name of the item.
+template <class Mapping>
+std::map<std::string, std::string> write_mapping(
+    const hid_t group, const Mapping &mapping, const Filters &filters,
+    const std::pair<hid_t, std::map<std::string, std::string>> *links =
+        nullptr) {
+  std::map<std::string, std::string> groups;
+  scipp::index i = 0;
+  for (const auto &[key, var] : mapping) {
+    const std::string name = key_name(key);
+    const auto element = element_name(name, i++);
+    groups.emplace(name, element);
+    if (links) {
+      if (const auto it = links->second.find(name); it != links->second.end()) {
+        link(links->first, it->second, group, element);
+        continue;
+      }
+    }
+    const auto item = create_group(group, element);
+    write_variable(item, var, filters);
+    write_attribute(item, "name", name);
+  }
+  return groups;
+}
+
+void write_data_array(
+    const hid_t group, const DataArray &da, const Filters &filters,
+    const std::pair<hid_t, std::map<std::string, std::string>> *coord_links) {
+  write_header(group, "DataArray");
+  write_attribute(group, "name", da.name());
+  write_variable(create_group(group, "data"), da.data(), filters);
+  write_mapping(create_group(group, "coords"), da.coords(), filters,
+                coord_links);
+  write_mapping(create_group(group, "masks"), da.masks(), filters);
+  write_mapping(create_group(group, "attrs"), da.attrs(), filters);
+}
+
+void write_dataset(const hid_t group, const Dataset &dataset,
+                   const Filters &filters) {
+  write_header(group, "Dataset");
+  // Coords of items are links to the coords of the dataset, such that they
+  // are stored only once.
+  const auto coords = create_group(group, "coords");
+  const std::pair<hid_t, std::map<std::string, std::string>> links{
+      coords, write_mapping(coords, dataset.coords(), filters)};
+  const auto entries = create_group(group, "entries");
+  scipp::index i = 0;
+  for (const auto &item : dataset)
+    write_data_array(create_group(entries, element_name(item.name(), i++)),
+                     item, filters, &links);
+}
+
+Handle open_values(const hid_t group) {
+  return Handle(H5Oopen(group, "values", H5P_DEFAULT), H5Oclose,
+                "open 'values'");
+}
+
+Dimensions read_dims(const hid_t group) {
+  const auto values = open_values(group);
+  const auto labels = read_strings_attribute(values, "dims");
+  const auto shape = read_index_attribute(values, "shape");
+  if (labels.size() != shape.size())
+    throw std::runtime_error("HDF5: dims and shape of variable do not match.");
+  Dimensions dims;
+  for (size_t i = 0; i < labels.size(); ++i)
+    dims.addInner(Dim(labels[i]), shape[i]);
+  return dims;
+}
+
+/// Return the ranges of `slices` that apply to a variable with `dims` in an
+/// object with `sizes`. Ranges of bin-edges are extended by one.
+std::vector<Slice> ranges_for(const Dimensions &dims, const Sizes &sizes,
+                              const std::vector<Slice> &slices) {
+  std::vector<Slice> ranges;
+  for (const auto &slice : slices) {
+    if (!dims.contains(slice.dim()))
+      continue;
+    const bool edges = sizes.contains(slice.dim()) &&
+                       dims[slice.dim()] == sizes[slice.dim()] + 1;
+    ranges.emplace_back(slice.dim(), slice.begin(), slice.end() + edges);
+  }
+  return ranges;
+}
+
+template <class T>
+void read_elements(const hid_t dataset, ElementArrayView<T> elements,
+                   const Shape &begin, const Shape &count, Reader &reader) {
+  const auto type = memory_type<typename Layout<T>::value_type>();
+  const auto inner = Layout<T>::shape();
+  auto first = begin;
+  auto size = count;
+  first.insert(first.end(), inner.size(), 0);
+  size.insert(size.end(), inner.begin(), inner.end());
+  if constexpr (std::is_same_v<T, std::string>) {
+    // Variable-length strings are read immediately.
+    std::vector<char *> data(elements.size());
+    reader.read(dataset, type, data.data(), first, size);
+    for (scipp::index i = 0; i < elements.size(); ++i)
+      elements[i] = data[i] == nullptr ? "" : data[i];
+    reclaim(type, data.size(), data.data());
+  } else if constexpr (is_matrix_v<T>) {
+    constexpr auto n = matrix_size<T>;
+    auto data = std::make_shared<std::vector<double>>(elements.size() * n * n);
+    reader.read(dataset, type, data->data(), first, size);
+    reader.defer([data, elements]() mutable {
+      auto it = data->begin();
+      for (auto &element : elements)
+        for (int row = 0; row < matrix_size<T>; ++row)
+          for (int col = 0; col < matrix_size<T>; ++col)
+            matrix(element)(row, col) = *it++;
+    });
+  } else {
+    reader.read(dataset, type, elements.data(), first, size);
+  }
+}
+
+template <class T> struct ReadValues {
+  static Variable apply(const hid_t group, const Dimensions &dims,
+                        const units::Unit &unit, const Shape &begin,
+                        const Shape &count, const bool variances,
+                        Reader &reader) {
+    Variable var = variable::empty(dims, unit, dtype<T>, variances);
+    read_elements(open_dataset(group, "values"), var.values<T>(), begin,
+                  count, reader);
+    if constexpr (core::canHaveVariances<T>())
+      if (variances)
+        read_elements(open_dataset(group, "variances"), var.variances<T>(),
+                      begin, count, reader);
+    return var;
+  }
+};
+
+/// Read as strings, which `astype` encodes in a new dictionary.
+template <> struct ReadValues<core::categorical_string> {
+  static Variable apply(const hid_t group, const Dimensions &dims,
+                        const units::Unit &unit, const Shape &begin,
+                        const Shape &count, const bool, Reader &reader) {
+    return astype(ReadValues<std::string>::apply(group, dims, unit, begin,
+                                                 count, false, reader),
+                  dtype<core::categorical_string>);
+  }
+};
+
+Variable read_variable_group(hid_t group, const std::vector<Slice> &ranges,
+                             Reader &reader);
+DataArray read_data_array_group(hid_t group, const std::vector<Slice> &ranges,
+                                Reader &reader);
+Dataset read_dataset_group(hid_t group, const std::vector<Slice> &ranges,
+                           Reader &reader);
+
+template <class T>
+Variable read_bins(const hid_t values, const std::vector<Slice> &ranges,
+                   Reader &reader) {
+  auto begin = read_variable_group(open_group(values, "begin"), ranges, reader);
+  auto end = read_variable_group(open_group(values, "end"), ranges, reader);
+  reader.finish();
+  const auto data = open_group(values, "data");
+  const Dim dim{read_string_attribute(data, "dim")};
+  std::vector<Slice> buffer_ranges;
+  if (!ranges.empty()) {
+    // Read only the range of the buffer referred to by the selected bins.
+    auto b = begin.values<int64_t>();
+    auto e = end.values<int64_t>();
+    int64_t lo = std::numeric_limits<int64_t>::max();
+    int64_t hi = 0;
+    for (scipp::index i = 0; i < b.size(); ++i)
+      if (b[i] < e[i]) {
+        lo = std::min(lo, b[i]);
+        hi = std::max(hi, e[i]);
+      }
+    lo = std::min(lo, hi);
+    for (scipp::index i = 0; i < b.size(); ++i) {
+      b[i] = std::max<int64_t>(b[i] - lo, 0);
+      e[i] = std::max<int64_t>(e[i] - lo, 0);
+    }
+    buffer_ranges.emplace_back(dim, lo, hi);
+  }
+  auto indices = zip(begin, end);
+  if constexpr (std::is_same_v<T, Variable>)
+    return make_bins(std::move(indices), dim,
+                     read_variable_group(data, buffer_ranges, reader));
+  else if constexpr (std::is_same_v<T, DataArray>)
+    return make_bins(std::move(indices), dim,
+                     read_data_array_group(data, buffer_ranges, reader));
+  else
+    return make_bins(std::move(indices), dim,
+                     read_dataset_group(data, buffer_ranges, reader));
+}
+
+Variable read_variable_group(const hid_t group,
+                             const std::vector<Slice> &ranges,
+                             Reader &reader) {
+  check_header(group, "Variable");
+  const auto values = open_values(group);
+  const auto type =
+      core::dtype_from_name(read_string_attribute(values, "dtype"));
+  if (type == dtype<bucket<Variable>>)
+    return read_bins<Variable>(values, ranges, reader);
+  if (type == dtype<bucket<DataArray>>)
+    return read_bins<DataArray>(values, ranges, reader);
+  if (type == dtype<bucket<Dataset>>)
+    return read_bins<Dataset>(values, ranges, reader);
+  if (!supports(ReadableTypes{}, type))
+    throw except::TypeError("Reading variables with dtype " +
+                            core::to_string(type) +
+                            " from HDF5 is not supported.");
+  auto dims = read_dims(group);
+  Shape begin(dims.ndim(), 0);
+  Shape count(dims.shape().begin(), dims.shape().end());
+  for (const auto &range : ranges) {
+    // Items of datasets may not depend on all dims.
+    if (!dims.contains(range.dim()))
+      continue;
+    const auto i = dims.index(range.dim());
+    begin[i] = range.begin();
+    count[i] = range.end() - range.begin();
+    dims.resize(range.dim(), range.end() - range.begin());
+  }
+  const auto unit = has_attribute(values, "unit")
+                        ? units::Unit(read_string_attribute(values, "unit"))
+                        : units::none;
+  return ReadableTypes::apply<ReadValues>(type, group, dims, unit, begin,
+                                          count, exists(group, "variances"),
+                                          reader);
+}
+
+template <class Map>
+Map read_mapping(const hid_t group, const Sizes &sizes,
+                 const std::vector<Slice> &ranges, Reader &reader) {
+  Map out;
+  for (const auto &name : members(group)) {
+    const auto item = open_group(group, name);
+    out.emplace(typename Map::key_type(read_string_attribute(item, "name")),
+                read_variable_group(
+                    item, ranges_for(read_dims(item), sizes, ranges), reader));
+  }
+  return out;
+}
+
+DataArray read_data_array_group(const hid_t group,
+                                const std::vector<Slice> &ranges,
+                                Reader &reader) {
+  check_header(group, "DataArray");
+  const auto data = open_group(group, "data");
+  const auto sizes = read_dims(data);
+  return DataArray(
+      read_variable_group(data, ranges, reader),
+      read_mapping<Coords::holder_type>(open_group(group, "coords"), sizes,
+                                        ranges, reader),
+      read_mapping<Masks::holder_type>(open_group(group, "masks"), sizes,
+                                       ranges, reader),
+      read_mapping<Attrs::holder_type>(open_group(group, "attrs"), sizes,
+                                       ranges, reader),
+      read_string_attribute(group, "name"));
+}
+
+Sizes dataset_sizes(const hid_t group) {
+  Sizes sizes;
+  const auto entries = open_group(group, "entries");
+  for (const auto &name : members(entries))
+    sizes = merge(sizes, read_dims(open_group(open_group(entries, name),
+                                              "data")));
+  if (!members(entries).empty())
+    return sizes;
+  const auto coords = open_group(group, "coords");
+  for (const auto &name : members(coords))
+    sizes = merge(sizes, read_dims(open_group(coords, name)));
+  return sizes;
+}
+
+Dataset read_dataset_group(const hid_t group, const std::vector<Slice> &ranges,
+                           Reader &reader) {
+  check_header(group, "Dataset");
+  const auto sizes = dataset_sizes(group);
+  // Coords of items are links to the coords of the dataset.
+  const auto coords = read_mapping<Coords::holder_type>(
+      open_group(group, "coords"), sizes, ranges, reader);
+  Dataset out;
+  const auto entries = open_group(group, "entries");
+  for (const auto &name : members(entries)) {
+    const auto entry = open_group(entries, name);
+    check_header(entry, "DataArray");
+    const auto data = open_group(entry, "data");
+    const auto item_sizes = read_dims(data);
+    auto masks = read_mapping<Masks::holder_type>(open_group(entry, "masks"),
+                                                  item_sizes, ranges, reader);
+    auto attrs = read_mapping<Attrs::holder_type>(open_group(entry, "attrs"),
+                                                  item_sizes, ranges, reader);
+    DataArray item(read_variable_group(data, ranges, reader), {},
+                   std::move(masks), std::move(attrs));
+    out.setData(read_string_attribute(entry, "name"), std::move(item));
+  }
+  for (const auto &[dim, coord] : coords)
+    out.setCoord(dim, coord);
+  return out;
+}
+
+/// Return `slices` as ranges, point slices are read as ranges of length 1
+/// and applied after reading.
+std::vector<Slice> as_ranges(const std::vector<Slice> &slices,
+                             const Sizes &sizes) {
+  std::vector<Slice> ranges;
+  for (const auto &slice : slices) {
+    core::expect::validSlice(sizes, slice);
+    if (slice.stride() != 1)
+      throw except::SliceError(
+          "Reading from HDF5 does not support slices with stride.");
+    ranges.emplace_back(slice.dim(), slice.begin(),
+                        slice.isRange() ? slice.end() : slice.begin() + 1);
+  }
+  return ranges;
+}
+
+std::string read_object_type(const hid_t file) {
+  if (!has_attribute(file, "scipp-version"))
+    throw std::runtime_error(
+        "This does not look like an HDF5 file/group written by scipp.");
+  return read_string_attribute(file, "scipp-type");
+}
+
+Sizes read_sizes(const hid_t file) {
+  const auto type = read_object_type(file);
+  if (type == "Variable")
+    return read_dims(file);
+  if (type == "DataArray")
+    return read_dims(open_group(file, "data"));
+  return dataset_sizes(file);
+}
+
+template <class T>
+T read_file(const std::string &filename, const std::vector<Slice> &slices) {
+  auto lock = lock_library();
+  const auto file = open_file(filename);
+  Reader reader(lock);
+  T out;
+  if constexpr (std::is_same_v<T, Variable>) {
+    check_header(file, "Variable");
+    out = read_variable_group(file, as_ranges(slices, read_dims(file)),
+                              reader);
+  } else if constexpr (std::is_same_v<T, DataArray>) {
+    check_header(file, "DataArray");
+    out = read_data_array_group(
+        file, as_ranges(slices, read_dims(open_group(file, "data"))), reader);
+  } else {
+    check_header(file, "Dataset");
+    out = read_dataset_group(file, as_ranges(slices, dataset_sizes(file)),
+                             reader);
+  }
+  reader.finish();
+  for (const auto &slice : slices)
+    if (!slice.isRange())
+      out = copy(out.slice(Slice(slice.dim(), 0)));
+  return out;
+}
+} // namespace
+
+void write(const std::string &filename, const Variable &obj,
+           const WriteOptions &options) {
+  const auto filters = make_filters(options);
+  const auto lock = lock_library();
+  write_variable(create_file(filename), obj, filters);
+}
+
+void write(const std::string &filename, const DataArray &obj,
+           const WriteOptions &options) {
+  const auto filters = make_filters(options);
+  const auto lock = lock_library();
+  write_data_array(create_file(filename), obj, filters);
+}
+
+void write(const std::string &filename, const Dataset &obj,
+           const WriteOptions &options) {
+  const auto filters = make_filters(options);
+  const auto lock = lock_library();
+  write_dataset(create_file(filename), obj, filters);
+}
+
+std::string object_type(const std::string &filename) {
+  const auto lock = lock_library();
+  return read_object_type(open_file(filename));
+}
+
+Sizes sizes(const std::string &filename) {
+  const auto lock = lock_library();
+  return read_sizes(open_file(filename));
+}
+
+Variable read_coord(const std::string &filename, const Dim dim,
+                    const std::vector<Slice> &slices) {
+  auto lock = lock_library();
+  const auto file = open_file(filename);
+  if (read_object_type(file) == "Variable")
+    throw except::NotFoundError("Cannot read coord " + to_string(dim) +
+                                ", variables have no coords.");
+  const auto full = read_sizes(file);
+  const auto ranges = as_ranges(slices, full);
+  Dimensions dims(full.labels(), full.sizes());
+  for (const auto &range : ranges)
+    dims.resize(range.dim(), range.end() - range.begin());
+  const auto coords = open_group(file, "coords");
+  for (const auto &name : members(coords)) {
+    const auto item = open_group(coords, name);
+    if (read_string_attribute(item, "name") != dim.name())
+      continue;
+    Reader reader(lock);
+    auto coord = read_variable_group(
+        item, ranges_for(read_dims(item), full, ranges), reader);
+    reader.finish();
+    // Slice a data array without data to get the same coords and attrs as
+    // when slicing the full object.
+    DataArray da(broadcast(makeVariable<int32_t>(Values{0}), dims),
+                 {{dim, std::move(coord)}});
+    for (const auto &slice : slices)
+      if (!slice.isRange())
+        da = da.slice(Slice(slice.dim(), 0));
+    if (da.coords().contains(dim))
+      return copy(da.coords()[dim]);
+    break;
+  }
+  throw except::NotFoundError("Expected coords to contain " + to_string(dim) +
+                              ".");
+}
+
+Variable read_variable(const std::string &filename,
+                       const std::vector<Slice> &slices) {
+  return read_file<Variable>(filename, slices);
+}
+
+DataArray read_data_array(const std::string &filename,
+                          const std::vector<Slice> &slices) {
+  return read_file<DataArray>(filename, slices);
+}
+
+Dataset read_dataset(const std::string &filename,
+                     const std::vector<Slice> &slices) {
+  return read_file<Dataset>(filename, slices);
+}
+
+} // namespace scipp::dataset::hdf5
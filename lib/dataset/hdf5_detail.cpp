@@ -0,0 +1,521 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include <zlib.h>
+
+#include "scipp/core/parallel.h"
+
+#include "hdf5_detail.h"
+
+namespace scipp::dataset::hdf5::detail {
+
+namespace {
+/// Default size of chunks if compression is enabled, as recommended by the
+/// HDF5 documentation.
+constexpr hsize_t default_chunk_bytes = 1024 * 1024;
+
+hsize_t volume(const Shape &shape) {
+  return std::accumulate(shape.begin(), shape.end(), hsize_t{1},
+                         std::multiplies<>());
+}
+
+/// Advance the first `rank` dims of `index` within [first, last], in row-major
+/// order. Returns false once all indices were visited.
+bool increment(Shape &index, const Shape &first, const Shape &last,
+               const size_t rank) {
+  for (size_t i = rank; i-- > 0;) {
+    if (index[i] < last[i]) {
+      ++index[i];
+      return true;
+    }
+    index[i] = first[i];
+  }
+  return false;
+}
+
+/// Inverse of the HDF5 shuffle filter, which stores byte `j` of all elements
+/// consecutively, followed by byte `j + 1`. Trailing bytes are not shuffled.
+void unshuffle(const std::vector<unsigned char> &in,
+               std::vector<unsigned char> &out, const hsize_t element_size) {
+  const auto size = in.size() / element_size;
+  out.resize(in.size());
+  for (hsize_t j = 0; j < element_size; ++j)
+    for (hsize_t i = 0; i < size; ++i)
+      out[i * element_size + j] = in[j * size + i];
+  std::copy(in.begin() + size * element_size, in.end(),
+            out.begin() + size * element_size);
+}
+
+Handle space(const Shape &shape) {
+  return shape.empty()
+             ? Handle(H5Screate(H5S_SCALAR), H5Sclose, "create dataspace")
+             : Handle(H5Screate_simple(static_cast<int>(shape.size()),
+                                       shape.data(), nullptr),
+                      H5Sclose, "create dataspace");
+}
+
+Handle create_attribute(const hid_t loc, const std::string &name,
+                        const hid_t type, const Shape &shape) {
+  return Handle(H5Acreate2(loc, name.c_str(), type, space(shape),
+                           H5P_DEFAULT, H5P_DEFAULT),
+                H5Aclose, "create attribute '" + name + "'");
+}
+
+std::vector<std::string> read_strings(const hid_t attr,
+                                      const std::string &name) {
+  const Handle file_space(H5Aget_space(attr), H5Sclose, "get dataspace");
+  const auto size = H5Sget_simple_extent_npoints(file_space);
+  if (size <= 0)
+    return {};
+  const Handle file_type(H5Aget_type(attr), H5Tclose, "get type");
+  if (H5Tget_class(file_type) != H5T_STRING)
+    throw std::runtime_error("HDF5: attribute '" + name +
+                             "' does not hold strings.");
+  std::vector<std::string> out;
+  if (H5Tis_variable_str(file_type) > 0) {
+    const auto type = string_type();
+    std::vector<char *> data(size);
+    check(H5Aread(attr, type, data.data()), "read attribute '" + name + "'");
+    for (const auto *str : data)
+      out.emplace_back(str == nullptr ? "" : str);
+    reclaim(type, size, data.data());
+  } else {
+    const auto length = H5Tget_size(file_type);
+    const Handle type(H5Tcopy(file_type), H5Tclose, "copy type");
+    std::vector<char> data(size * length);
+    check(H5Aread(attr, type, data.data()), "read attribute '" + name + "'");
+    for (hssize_t i = 0; i < size; ++i) {
+      const auto *str = data.data() + i * length;
+      out.emplace_back(str, strnlen(str, length));
+    }
+  }
+  return out;
+}
+} // namespace
+
+LibraryLock lock_library() {
+  static std::mutex mutex;
+  return LibraryLock(mutex);
+}
+
+Handle::Handle(const hid_t id, const Close close, const std::string &what)
+    : m_id(id), m_close(close) {
+  if (m_id < 0)
+    throw std::runtime_error("HDF5: failed to " + what + ".");
+}
+
+Handle::Handle(Handle &&other) noexcept
+    : m_id(std::exchange(other.m_id, H5I_INVALID_HID)),
+      m_close(other.m_close) {}
+
+Handle &Handle::operator=(Handle &&other) noexcept {
+  std::swap(m_id, other.m_id);
+  std::swap(m_close, other.m_close);
+  return *this;
+}
+
+Handle::~Handle() {
+  if (m_id >= 0)
+    m_close(m_id);
+}
+
+void check(const herr_t status, const std::string &what) {
+  if (status < 0)
+    throw std::runtime_error("HDF5: failed to " + what + ".");
+}
+
+Handle create_file(const std::string &filename) {
+  return Handle(
+      H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT),
+      H5Fclose, "create file '" + filename + "'");
+}
+
+Handle open_file(const std::string &filename) {
+  return Handle(H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT),
+                H5Fclose, "open file '" + filename + "'");
+}
+
+Handle create_group(const hid_t loc, const std::string &name) {
+  return Handle(
+      H5Gcreate2(loc, name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT),
+      H5Gclose, "create group '" + name + "'");
+}
+
+Handle open_group(const hid_t loc, const std::string &name) {
+  return Handle(H5Gopen2(loc, name.c_str(), H5P_DEFAULT), H5Gclose,
+                "open group '" + name + "'");
+}
+
+Handle open_dataset(const hid_t loc, const std::string &name) {
+  return Handle(H5Dopen2(loc, name.c_str(), H5P_DEFAULT), H5Dclose,
+                "open dataset '" + name + "'");
+}
+
+bool exists(const hid_t loc, const std::string &name) {
+  const auto status = H5Lexists(loc, name.c_str(), H5P_DEFAULT);
+  check(status, "check existence of '" + name + "'");
+  return status > 0;
+}
+
+void link(const hid_t loc, const std::string &target, const hid_t dest,
+          const std::string &name) {
+  check(H5Lcreate_hard(loc, target.c_str(), dest, name.c_str(), H5P_DEFAULT,
+                       H5P_DEFAULT),
+        "create link '" + name + "'");
+}
+
+std::vector<std::string> members(const hid_t group) {
+  H5G_info_t info;
+  check(H5Gget_info(group, &info), "get group info");
+  std::vector<std::string> names;
+  for (hsize_t i = 0; i < info.nlinks; ++i) {
+    const auto get = [&](char *name, const size_t size) {
+      return H5Lget_name_by_idx(group, ".", H5_INDEX_NAME, H5_ITER_INC, i,
+                                name, size, H5P_DEFAULT);
+    };
+    const auto length = get(nullptr, 0);
+    if (length < 0)
+      throw std::runtime_error("HDF5: failed to get link name.");
+    std::string name(length, '\0');
+    get(name.data(), length + 1);
+    names.emplace_back(std::move(name));
+  }
+  return names;
+}
+
+Handle string_type() {
+  Handle type(H5Tcopy(H5T_C_S1), H5Tclose, "create string type");
+  check(H5Tset_size(type, H5T_VARIABLE), "create string type");
+  check(H5Tset_cset(type, H5T_CSET_UTF8), "create string type");
+  return type;
+}
+
+Handle bool_type() {
+  Handle type(H5Tenum_create(H5T_NATIVE_INT8), H5Tclose, "create bool type");
+  for (const int8_t value : {0, 1})
+    check(H5Tenum_insert(type, value == 0 ? "FALSE" : "TRUE", &value),
+          "create bool type");
+  return type;
+}
+
+Handle float16_type() {
+  Handle type(H5Tcopy(H5T_IEEE_F32LE), H5Tclose, "create float16 type");
+  check(H5Tset_fields(type, 15, 10, 5, 0, 10), "create float16 type");
+  check(H5Tset_size(type, 2), "create float16 type");
+  check(H5Tset_ebias(type, 15), "create float16 type");
+  return type;
+}
+
+bool has_attribute(const hid_t loc, const std::string &name) {
+  const auto status = H5Aexists(loc, name.c_str());
+  check(status, "check existence of attribute '" + name + "'");
+  return status > 0;
+}
+
+void write_attribute(const hid_t loc, const std::string &name,
+                     const std::string &value) {
+  const auto type = string_type();
+  const char *data = value.c_str();
+  check(H5Awrite(create_attribute(loc, name, type, {}), type, &data),
+        "write attribute '" + name + "'");
+}
+
+void write_attribute(const hid_t loc, const std::string &name,
+                     const std::vector<std::string> &values) {
+  const auto type = string_type();
+  std::vector<const char *> data;
+  for (const auto &value : values)
+    data.push_back(value.c_str());
+  // HDF5 rejects null buffers even if there is nothing to write.
+  const char *empty = nullptr;
+  check(H5Awrite(create_attribute(loc, name, type, {values.size()}), type,
+                 data.empty() ? &empty : data.data()),
+        "write attribute '" + name + "'");
+}
+
+void write_attribute(const hid_t loc, const std::string &name,
+                     const std::vector<scipp::index> &values) {
+  const int64_t empty = 0;
+  check(H5Awrite(create_attribute(loc, name, H5T_NATIVE_INT64,
+                                  {values.size()}),
+                 H5T_NATIVE_INT64, values.empty() ? &empty : values.data()),
+        "write attribute '" + name + "'");
+}
+
+void write_reference_attribute(const hid_t dataset, const std::string &attr,
+                               const hid_t loc, const std::string &name) {
+  hobj_ref_t ref;
+  check(H5Rcreate(&ref, loc, name.c_str(), H5R_OBJECT, -1),
+        "create reference to '" + name + "'");
+  check(H5Awrite(create_attribute(dataset, attr, H5T_STD_REF_OBJ, {}),
+                 H5T_STD_REF_OBJ, &ref),
+        "write attribute '" + attr + "'");
+}
+
+std::string read_string_attribute(const hid_t loc, const std::string &name) {
+  const Handle attr(H5Aopen(loc, name.c_str(), H5P_DEFAULT), H5Aclose,
+                    "open attribute '" + name + "'");
+  auto strings = read_strings(attr, name);
+  if (strings.size() != 1)
+    throw std::runtime_error("HDF5: attribute '" + name +
+                             "' is not a single string.");
+  return strings.front();
+}
+
+std::vector<std::string> read_strings_attribute(const hid_t loc,
+                                                const std::string &name) {
+  const Handle attr(H5Aopen(loc, name.c_str(), H5P_DEFAULT), H5Aclose,
+                    "open attribute '" + name + "'");
+  return read_strings(attr, name);
+}
+
+std::vector<scipp::index> read_index_attribute(const hid_t loc,
+                                               const std::string &name) {
+  const Handle attr(H5Aopen(loc, name.c_str(), H5P_DEFAULT), H5Aclose,
+                    "open attribute '" + name + "'");
+  const Handle file_space(H5Aget_space(attr), H5Sclose, "get dataspace");
+  const auto size = H5Sget_simple_extent_npoints(file_space);
+  // h5py writes empty lists as empty float arrays.
+  if (size <= 0)
+    return {};
+  std::vector<scipp::index> values(size);
+  check(H5Aread(attr, H5T_NATIVE_INT64, values.data()),
+        "read attribute '" + name + "'");
+  return values;
+}
+
+Shape chunk_shape(const Shape &shape, const hsize_t element_size,
+                  const hsize_t chunk_bytes) {
+  Shape chunk(shape);
+  for (size_t i = 0; i < chunk.size(); ++i) {
+    const auto inner = std::accumulate(chunk.begin() + i + 1, chunk.end(),
+                                       element_size, std::multiplies<>());
+    chunk[i] = std::clamp<hsize_t>(chunk_bytes / inner, 1, shape[i]);
+    if (inner <= chunk_bytes)
+      break;
+  }
+  return chunk;
+}
+
+Handle write_dataset(const hid_t loc, const std::string &name,
+                     const hid_t type, const Shape &shape, const void *data,
+                     const Filters &filters, const hsize_t memory_stride,
+                     const hsize_t memory_offset) {
+  const Handle dcpl(H5Pcreate(H5P_DATASET_CREATE), H5Pclose,
+                    "create property list");
+  const auto size = volume(shape);
+  const bool compress = filters.gzip_level >= 0 || filters.shuffle;
+  // Chunks must not be empty and scalars cannot be chunked.
+  if ((compress || filters.chunk_bytes > 0) && !shape.empty() && size > 0) {
+    const auto chunk = chunk_shape(
+        shape, H5Tget_size(type),
+        filters.chunk_bytes > 0 ? filters.chunk_bytes : default_chunk_bytes);
+    check(H5Pset_chunk(dcpl, static_cast<int>(chunk.size()), chunk.data()),
+          "set chunk shape");
+    if (filters.shuffle)
+      check(H5Pset_shuffle(dcpl), "enable shuffle filter");
+    if (filters.gzip_level >= 0) {
+      if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0)
+        throw std::runtime_error("HDF5: gzip compression is not available.");
+      check(H5Pset_deflate(dcpl, static_cast<unsigned>(filters.gzip_level)),
+            "enable gzip compression");
+    }
+  }
+  Handle dataset(H5Dcreate2(loc, name.c_str(), type, space(shape),
+                            H5P_DEFAULT, dcpl, H5P_DEFAULT),
+                 H5Dclose, "create dataset '" + name + "'");
+  if (size == 0)
+    return dataset;
+  const hsize_t memory_size = memory_offset + (size - 1) * memory_stride + 1;
+  const auto memory_space = space({memory_size});
+  check(H5Sselect_hyperslab(memory_space, H5S_SELECT_SET, &memory_offset,
+                            &memory_stride, &size, nullptr),
+        "select memory");
+  check(H5Dwrite(dataset, type, memory_space, H5S_ALL, H5P_DEFAULT, data),
+        "write dataset '" + name + "'");
+  return dataset;
+}
+
+Shape dataset_shape(const hid_t dataset) {
+  const Handle file_space(H5Dget_space(dataset), H5Sclose, "get dataspace");
+  Shape shape(H5Sget_simple_extent_ndims(file_space));
+  check(H5Sget_simple_extent_dims(file_space, shape.data(), nullptr),
+        "get shape");
+  return shape;
+}
+
+void reclaim(const hid_t type, const hsize_t size, void *data) {
+  if (size == 0)
+    return;
+#if H5_VERSION_GE(1, 12, 0)
+  check(H5Treclaim(type, space({size}), H5P_DEFAULT, data), "free memory");
+#else
+  check(H5Dvlen_reclaim(type, space({size}), H5P_DEFAULT, data),
+        "free memory");
+#endif
+}
+
+void Reader::read(const hid_t dataset, const hid_t type, void *out,
+                  const Shape &begin, const Shape &count) {
+  const auto shape = dataset_shape(dataset);
+  const auto first = begin.empty() ? Shape(shape.size(), 0) : begin;
+  const auto size = begin.empty() ? shape : count;
+  if (volume(size) == 0 || read_chunks(dataset, type, out, first, size))
+    return;
+  const Handle file_space(H5Dget_space(dataset), H5Sclose, "get dataspace");
+  if (!shape.empty())
+    check(H5Sselect_hyperslab(file_space, H5S_SELECT_SET, first.data(),
+                              nullptr, size.data(), nullptr),
+          "select hyperslab");
+  const auto memory_space =
+      space(shape.empty() ? Shape{} : Shape{volume(size)});
+  check(H5Dread(dataset, type, memory_space, file_space, H5P_DEFAULT, out),
+        "read dataset");
+}
+
+void Reader::defer(std::function<void()> callback) {
+  m_callbacks.emplace_back(std::move(callback));
+}
+
+bool Reader::read_chunks(const hid_t dataset, const hid_t type, void *out,
+                         const Shape &begin, const Shape &count) {
+  const Handle dcpl(H5Dget_create_plist(dataset), H5Pclose,
+                    "get property list");
+  const Handle file_type(H5Dget_type(dataset), H5Tclose, "get type");
+  // Raw chunks of variable-length types hold references into the heap.
+  if (H5Pget_layout(dcpl) != H5D_CHUNKED || H5Tequal(file_type, type) <= 0 ||
+      H5Tis_variable_str(type) > 0)
+    return false;
+  std::vector<H5Z_filter_t> filters;
+  for (int i = 0; i < H5Pget_nfilters(dcpl); ++i) {
+    unsigned flags;
+    size_t size = 0;
+    const auto filter = H5Pget_filter2(dcpl, static_cast<unsigned>(i), &flags,
+                                       &size, nullptr, 0, nullptr, nullptr);
+    if (filter != H5Z_FILTER_DEFLATE && filter != H5Z_FILTER_SHUFFLE)
+      return false;
+    filters.push_back(filter);
+  }
+  const auto shape = dataset_shape(dataset);
+  const auto rank = shape.size();
+  Shape chunk(rank);
+  check(H5Pget_chunk(dcpl, static_cast<int>(rank), chunk.data()),
+        "get chunk shape");
+  // The library fills unallocated chunks, leave this to the library.
+  hsize_t chunks = 1;
+  for (size_t i = 0; i < rank; ++i)
+    chunks *= (shape[i] + chunk[i] - 1) / chunk[i];
+  const Handle file_space(H5Dget_space(dataset), H5Sclose, "get dataspace");
+  hsize_t allocated = 0;
+  check(H5Dget_num_chunks(dataset, file_space, &allocated),
+        "get chunk count");
+  if (allocated != chunks)
+    return false;
+
+  m_datasets.push_back(
+      {chunk, begin, count, H5Tget_size(type), std::move(filters), out});
+  Shape first(rank);
+  Shape last(rank);
+  for (size_t i = 0; i < rank; ++i) {
+    first[i] = begin[i] / chunk[i];
+    last[i] = (begin[i] + count[i] - 1) / chunk[i];
+  }
+  Shape index(first);
+  do {
+    Chunk c{{}, 0, Shape(rank), m_datasets.size() - 1};
+    for (size_t i = 0; i < rank; ++i)
+      c.offset[i] = index[i] * chunk[i];
+    hsize_t size = 0;
+    check(H5Dget_chunk_storage_size(dataset, c.offset.data(), &size),
+          "get chunk size");
+    c.raw.resize(size);
+    check(H5Dread_chunk(dataset, H5P_DEFAULT, c.offset.data(), &c.filter_mask,
+                        c.raw.data()),
+          "read chunk");
+    m_chunks.emplace_back(std::move(c));
+  } while (increment(index, first, last, rank));
+  return true;
+}
+
+void Reader::decode(const Chunk &chunk) const {
+  const auto &dataset = m_datasets[chunk.dataset];
+  const auto element_size = dataset.element_size;
+  const auto bytes = volume(dataset.chunk) * element_size;
+  std::vector<unsigned char> data;
+  std::vector<unsigned char> buffer;
+  const auto *in = &chunk.raw;
+  // Filters are applied in the order of the pipeline when writing, undo them
+  // in reverse order. Set bits of the mask mark filters skipped for this chunk.
+  for (size_t i = dataset.filters.size(); i-- > 0;) {
+    if ((chunk.filter_mask & (1u << i)) != 0)
+      continue;
+    if (dataset.filters[i] == H5Z_FILTER_DEFLATE) {
+      buffer.resize(bytes);
+      uLongf length = bytes;
+      if (uncompress(buffer.data(), &length, in->data(), in->size()) != Z_OK ||
+          length != bytes)
+        throw std::runtime_error("HDF5: failed to decompress chunk.");
+    } else {
+      unshuffle(*in, buffer, element_size);
+    }
+    std::swap(data, buffer);
+    in = &data;
+  }
+  if (in->size() != bytes)
+    throw std::runtime_error("HDF5: unexpected size of chunk.");
+
+  // Copy the intersection of the chunk and the selection into the output,
+  // in runs along the innermost dim.
+  const auto rank = chunk.offset.size();
+  Shape lo(rank);
+  Shape hi(rank);
+  for (size_t i = 0; i < rank; ++i) {
+    lo[i] = std::max(chunk.offset[i], dataset.begin[i]);
+    hi[i] = std::min(chunk.offset[i] + dataset.chunk[i],
+                     dataset.begin[i] + dataset.count[i]) -
+            1;
+  }
+  const auto run = (hi[rank - 1] - lo[rank - 1] + 1) * element_size;
+  auto *out = static_cast<unsigned char *>(dataset.out);
+  Shape index(lo);
+  do {
+    hsize_t source = 0;
+    hsize_t target = 0;
+    for (size_t i = 0; i < rank; ++i) {
+      source = source * dataset.chunk[i] + index[i] - chunk.offset[i];
+      target = target * dataset.count[i] + index[i] - dataset.begin[i];
+    }
+    std::memcpy(out + target * element_size,
+                in->data() + source * element_size, run);
+  } while (increment(index, lo, hi, rank - 1));
+}
+
+void Reader::finish() {
+  // Decoding does not call the library, let other threads use it meanwhile.
+  m_lock.unlock();
+  try {
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, scipp::size(m_chunks), 1),
+        [&](const auto &range) {
+          for (auto i = range.begin(); i != range.end(); ++i)
+            decode(m_chunks[i]);
+        });
+  } catch (...) {
+    m_lock.lock();
+    throw;
+  }
+  m_lock.lock();
+  m_chunks.clear();
+  m_datasets.clear();
+  for (const auto &callback : m_callbacks)
+    callback();
+  m_callbacks.clear();
+}
+
+} // namespace scipp::dataset::hdf5::detail
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @brief Thin wrappers of the HDF5 C library used by scipp/dataset/hdf5.h.
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <hdf5.h>
+
+#include "scipp/common/index.h"
+
+namespace scipp::dataset::hdf5::detail {
+
+using Shape = std::vector<hsize_t>;
+using LibraryLock = std::unique_lock<std::mutex>;
+
+/// Lock the process-wide mutex serializing all calls into the HDF5 library.
+///
+/// The library must not be called concurrently unless it was built with
+/// thread-safety enabled, which is not the default. The public functions of
+/// scipp/dataset/hdf5.h hold the lock while they call the library or own a
+/// Handle, Reader::finish releases it while decoding chunks. Calls made via
+/// h5py are not covered by this lock, h5py uses its own copy of the library
+/// in typical installations.
+[[nodiscard]] LibraryLock lock_library();
+
+/// Owning wrapper of an HDF5 identifier, which is closed on destruction.
+class Handle {
+public:
+  using Close = herr_t (*)(hid_t);
+  Handle() = default;
+  Handle(hid_t id, Close close, const std::string &what);
+  Handle(const Handle &) = delete;
+  Handle(Handle &&other) noexcept;
+  Handle &operator=(const Handle &) = delete;
+  Handle &operator=(Handle &&other) noexcept;
+  ~Handle();
+
+  operator hid_t() const noexcept { return m_id; }
+
+private:
+  hid_t m_id{H5I_INVALID_HID};
+  Close m_close{nullptr};
+};
+
+void check(herr_t status, const std::string &what);
+
+Handle create_file(const std::string &filename);
+Handle open_file(const std::string &filename);
+Handle create_group(hid_t loc, const std::string &name);
+Handle open_group(hid_t loc, const std::string &name);
+Handle open_dataset(hid_t loc, const std::string &name);
+bool exists(hid_t loc, const std::string &name);
+/// Create a hard link `name` in `dest` to the object `target` in `loc`.
+void link(hid_t loc, const std::string &target, hid_t dest,
+          const std::string &name);
+/// Names of the links in `group` in alphabetical order.
+std::vector<std::string> members(hid_t group);
+
+/// Memory type of variable-length UTF-8 strings, as written by h5py.
+Handle string_type();
+/// Memory type of bool, an enum of int8 compatible with h5py.
+Handle bool_type();
+/// Memory type of IEEE half-precision floats, compatible with h5py.
+Handle float16_type();
+
+bool has_attribute(hid_t loc, const std::string &name);
+void write_attribute(hid_t loc, const std::string &name,
+                     const std::string &value);
+void write_attribute(hid_t loc, const std::string &name,
+                     const std::vector<std::string> &values);
+void write_attribute(hid_t loc, const std::string &name,
+                     const std::vector<scipp::index> &values);
+/// Write an attribute referring to the object `name` relative to `loc`.
+void write_reference_attribute(hid_t dataset, const std::string &attr,
+                               hid_t loc, const std::string &name);
+std::string read_string_attribute(hid_t loc, const std::string &name);
+std::vector<std::string> read_strings_attribute(hid_t loc,
+                                                const std::string &name);
+std::vector<scipp::index> read_index_attribute(hid_t loc,
+                                               const std::string &name);
+
+/// Storage options of datasets, see hdf5::WriteOptions.
+struct Filters {
+  int gzip_level{-1};
+  bool shuffle{false};
+  hsize_t chunk_bytes{0};
+};
+
+/// Shape of chunks of at most `chunk_bytes` spanning complete inner dims.
+Shape chunk_shape(const Shape &shape, hsize_t element_size,
+                  hsize_t chunk_bytes);
+
+/// Write the contiguous array of `shape` at `data` into the new dataset
+/// `name`. Memory elements are read with the given stride and offset (in
+/// elements), e.g., to write one half of an array of pairs.
+Handle write_dataset(hid_t loc, const std::string &name, hid_t type,
+                     const Shape &shape, const void *data,
+                     const Filters &filters, hsize_t memory_stride = 1,
+                     hsize_t memory_offset = 0);
+
+Shape dataset_shape(hid_t dataset);
+
+/// Free variable-length data read into `data` with the memory type `type`.
+void reclaim(hid_t type, hsize_t size, void *data);
+
+/// Reads (hyperslabs of) datasets into contiguous memory.
+///
+/// Chunks of datasets compressed using only the deflate and shuffle filters
+/// are read raw and decoded in parallel by `finish`. Any other dataset is read
+/// using the HDF5 library immediately. Calls of the library are serialized by
+/// `lock_library`, so decoding is the only part of reading that can scale with
+/// the number of threads, and overlap with reads from other threads. Queueing
+/// the chunks of all independent datasets, e.g., the data and coords of a data
+/// array, before calling `finish` maximizes parallelism.
+class Reader {
+public:
+  /// `lock` must be held by the caller and is released while decoding.
+  explicit Reader(LibraryLock &lock) : m_lock(lock) {}
+
+  /// Read the hyperslab of `dataset` given by `begin` and `count` into `out`.
+  /// If `begin` is empty the full dataset is read. `out` must stay valid
+  /// until `finish` returns.
+  void read(hid_t dataset, hid_t type, void *out, const Shape &begin = {},
+            const Shape &count = {});
+  /// Call `callback` in `finish` once all data has been read.
+  void defer(std::function<void()> callback);
+  /// Decode the queued chunks and call deferred callbacks.
+  void finish();
+
+private:
+  struct Chunk {
+    std::vector<unsigned char> raw;
+    uint32_t filter_mask;
+    Shape offset;
+    /// Index of the dataset in m_datasets.
+    size_t dataset;
+  };
+  struct Dataset {
+    Shape chunk;
+    Shape begin;
+    Shape count;
+    hsize_t element_size;
+    /// Filters in the order of the pipeline.
+    std::vector<H5Z_filter_t> filters;
+    void *out;
+  };
+  bool read_chunks(hid_t dataset, hid_t type, void *out, const Shape &begin,
+                   const Shape &count);
+  void decode(const Chunk &chunk) const;
+
+  LibraryLock &m_lock;
+  std::vector<Dataset> m_datasets;
+  std::vector<Chunk> m_chunks;
+  std::vector<std::function<void()>> m_callbacks;
+};
+
+} // namespace scipp::dataset::hdf5::detail
@@ -11,8 +11,10 @@
 #include "scipp/dataset/groupby.h"
 #include "scipp/dataset/histogram.h"
 #include "scipp/variable/arithmetic.h"
+#include "scipp/variable/reduction.h"
 #include "scipp/variable/shape.h"
 #include "scipp/variable/transform_subspan.h"
+#include "scipp/variable/util.h"
 
 #include "bins_util.h"
 #include "dataset_operations_common.h"
@@ -35,6 +37,13 @@ auto as_contiguous(const Variable &var, const Dim dim) {
 }
 } // namespace
 
+/// Return true if `edges` are linearly spaced along `dim`. This is O(1) for
+/// edges created by, e.g., `linspace`.
+bool is_linspace_edges(const Variable &edges, const Dim dim) {
+  return !edges.has_variances() && edges.dims().contains(dim) &&
+         all(islinspace(edges, dim)).value<bool>();
+}
+
 DataArray histogram(const DataArray &events, const Variable &binEdges) {
   using namespace scipp::core;
   auto dim = binEdges.dims().inner();
@@ -56,22 +65,50 @@ DataArray histogram(const DataArray &events, const Variable &binEdges) {
         dim, binEdges);
   } else if (!is_histogram(events, dim)) {
     const auto event_dim = events.coords().dim_of(dim);
+    const bool linspace = is_linspace_edges(binEdges, dim);
     result = apply_and_drop_dim(
         events,
-        [dim](const DataArray &events_, const Dim event_dim_,
-              const Variable &binEdges_) {
-          const auto data = masked_data(events_, event_dim_);
+        [dim, linspace](const DataArray &events_, const Dim event_dim_,
+                        const Variable &binEdges_) {
           // Warning: Don't try to move the `as_contiguous` into `subspan_view`
           // without special care: It may return a new variable which will go
           // out of scope, leading to subtle bugs. Here on the other hand the
           // returned temporary is kept alive until the end of the
           // full-expression.
-          return transform_subspan(
-              events_.dtype(), dim, binEdges_.dims()[dim] - 1,
-              subspan_view(as_contiguous(events_.coords()[dim], event_dim_),
-                           event_dim_),
-              subspan_view(as_contiguous(data, event_dim_), event_dim_),
-              binEdges_, element::histogram, "histogram");
+          const auto coord = [&]() {
+            return subspan_view(
+                as_contiguous(events_.coords()[dim], event_dim_), event_dim_);
+          };
+          const auto data = [&]() {
+            return subspan_view(as_contiguous(events_.data(), event_dim_),
+                                event_dim_);
+          };
+          // Masked events are skipped, instead of histogramming a copy of the
+          // data with masked values replaced by zero.
+          const auto nbin = binEdges_.dims()[dim] - 1;
+          if (const auto mask = irreducible_mask(events_.masks(), event_dim_);
+              mask.is_valid()) {
+            const auto mask_ = [&]() {
+              return subspan_view(as_contiguous(mask, event_dim_), event_dim_);
+            };
+            return linspace ? transform_subspan(
+                                  events_.dtype(), dim, nbin, coord(), data(),
+                                  binEdges_, mask_(),
+                                  element::masked_histogram_linspace,
+                                  "histogram")
+                            : transform_subspan(
+                                  events_.dtype(), dim, nbin, coord(), data(),
+                                  binEdges_, mask_(), element::masked_histogram,
+                                  "histogram");
+          }
+          return linspace
+                     ? transform_subspan(events_.dtype(), dim, nbin, coord(),
+                                         data(), binEdges_,
+                                         element::histogram_linspace,
+                                         "histogram")
+                     : transform_subspan(events_.dtype(), dim, nbin, coord(),
+                                         data(), binEdges_, element::histogram,
+                                         "histogram");
         },
         event_dim, binEdges);
   } else {
@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include "scipp/dataset/dataset.h"
+
+namespace scipp::dataset {
+
+SCIPP_DATASET_EXPORT DataArray argmin(const DataArray &a, const Dim dim);
+SCIPP_DATASET_EXPORT Dataset argmin(const Dataset &d, const Dim dim);
+
+SCIPP_DATASET_EXPORT DataArray argmax(const DataArray &a, const Dim dim);
+SCIPP_DATASET_EXPORT Dataset argmax(const Dataset &d, const Dim dim);
+
+SCIPP_DATASET_EXPORT DataArray topk(const DataArray &a, const scipp::index k,
+                                    const Dim dim);
+SCIPP_DATASET_EXPORT Dataset topk(const Dataset &d, const scipp::index k,
+                                  const Dim dim);
+
+} // namespace scipp::dataset
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @brief Exchange of variables with other libraries via the Arrow C data
+/// interface, see https://arrow.apache.org/docs/format/CDataInterface.html.
+#pragma once
+
+#include <cstdint>
+
+#include "scipp-dataset_export.h"
+#include "scipp/variable/variable.h"
+
+// Definitions from the Arrow C data interface, which are ABI-stable by design
+// and shared by all implementations that use the same include guard.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+  const char *format;
+  const char *name;
+  const char *metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema **children;
+  struct ArrowSchema *dictionary;
+  void (*release)(struct ArrowSchema *);
+  void *private_data;
+};
+
+struct ArrowArray {
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void **buffers;
+  struct ArrowArray **children;
+  struct ArrowArray *dictionary;
+  void (*release)(struct ArrowArray *);
+  void *private_data;
+};
+
+#endif // ARROW_C_DATA_INTERFACE
+
+namespace scipp::dataset {
+
+/// Export `var` into the uninitialized structs `array` and `schema`.
+///
+/// Contiguous numeric and datetime arrays are exported without copying, `var`
+/// is kept alive until the consumer calls `array.release`. Strings are shared
+/// if the characters of all elements are stored consecutively. Multi-
+/// dimensional arrays are exported flattened, dims and unit are stored in the
+/// schema metadata. Binned variables with elements of type DataArray are
+/// exported as a large list with the bin indices as offsets into a struct
+/// array with one field for each data, coord, mask, and attr of the buffer.
+/// Only 1-D binned variables are supported, others throw DimensionError.
+SCIPP_DATASET_EXPORT void to_arrow(const Variable &var, ArrowArray &array,
+                                   ArrowSchema &schema);
+
+/// Import a variable from `array` and `schema`, as created by `to_arrow` or
+/// another producer.
+///
+/// Takes ownership of `array`, the data of numeric, datetime, and string
+/// arrays is shared without copying, the returned variable is read-only.
+/// Shared buffers are never written, writing to the data through another
+/// handle of the variable's data copies it first.
+/// `schema` is not modified and must be released by the caller.
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable
+from_arrow(ArrowArray &array, const ArrowSchema &schema);
+
+} // namespace scipp::dataset
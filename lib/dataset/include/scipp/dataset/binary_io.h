@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @brief Native binary file format of scipp, see `scipp.io.save`.
+///
+/// A file consists of a header describing the structure of the stored object,
+/// i.e., dims, units, dtypes, and names of all variables, followed by the raw
+/// memory of all values, variances, bin indices, and string characters. Each
+/// buffer is aligned to 64 bytes, such that the file can be mapped into memory
+/// and buffers can be used in place. Files use the byte order of the machine
+/// that wrote them and are not meant for archiving, use HDF5 for this purpose.
+#pragma once
+
+#include <string>
+
+#include "scipp-dataset_export.h"
+#include "scipp/dataset/dataset.h"
+
+namespace scipp::dataset::binary_io {
+
+enum class ReadMode {
+  /// Map the file into memory. Variables use the mapped memory without copy,
+  /// pages are read from disk when first accessed. Modifying variables does
+  /// not modify the file.
+  Map,
+  /// Read all buffers into memory owned by variables.
+  Read
+};
+
+/// Write `obj` to the file `filename`, replacing any existing file.
+///
+/// The file is written in a single pass, buffers are written directly from
+/// the memory of contiguous variables. The data is written to a temporary file
+/// in the same directory, which replaces `filename` once complete, such that
+/// objects loaded from `filename` remain valid. Throws except::TypeError for
+/// dtypes without support, such as PyObject or Variable.
+SCIPP_DATASET_EXPORT void write(const std::string &filename,
+                                const Variable &obj);
+SCIPP_DATASET_EXPORT void write(const std::string &filename,
+                                const DataArray &obj);
+SCIPP_DATASET_EXPORT void write(const std::string &filename,
+                                const Dataset &obj);
+
+/// Return the type of the object stored in `filename`, "Variable",
+/// "DataArray", or "Dataset".
+[[nodiscard]] SCIPP_DATASET_EXPORT std::string
+object_type(const std::string &filename);
+
+/// Read the object stored in `filename`.
+///
+/// Only the header is parsed, buffers are used as stored. Variables of dtype
+/// string are an exception since their elements must be constructed, use
+/// dtype string_view to avoid this.
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable
+read_variable(const std::string &filename, ReadMode mode = ReadMode::Map);
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray
+read_data_array(const std::string &filename, ReadMode mode = ReadMode::Map);
+[[nodiscard]] SCIPP_DATASET_EXPORT Dataset
+read_dataset(const std::string &filename, ReadMode mode = ReadMode::Map);
+
+} // namespace scipp::dataset::binary_io
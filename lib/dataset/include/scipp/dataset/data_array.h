@@ -30,6 +30,17 @@ public:
                      typename Masks::holder_type masks = {},
                      typename Attrs::holder_type attrs = {},
                      std::string_view name = "");
+  /// Construct from other maps of names to variables, e.g.,
+  /// std::unordered_map. Items are inserted in the iteration order of the maps.
+  template <class CoordMap, class MaskMap = typename Masks::holder_type,
+            class AttrMap = typename Attrs::holder_type>
+  DataArray(Variable data, const CoordMap &coords, const MaskMap &masks = {},
+            const AttrMap &attrs = {}, std::string_view name = "")
+      : DataArray(std::move(data),
+                  typename Coords::holder_type(coords.begin(), coords.end()),
+                  typename Masks::holder_type(masks.begin(), masks.end()),
+                  typename Attrs::holder_type(attrs.begin(), attrs.end()),
+                  name) {}
 
   DataArray &operator=(const DataArray &other);
   DataArray &operator=(DataArray &&other);
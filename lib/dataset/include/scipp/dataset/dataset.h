@@ -258,8 +258,7 @@ SCIPP_DATASET_EXPORT Dataset operator/(const Variable &lhs, const Dataset &rhs);
 /// Union the masks of the two proxies.
 /// If any of the masks repeat they are OR'ed.
 /// The result is stored in a new map
-SCIPP_DATASET_EXPORT
-std::unordered_map<typename Masks::key_type, typename Masks::mapped_type>
+SCIPP_DATASET_EXPORT typename Masks::holder_type
 union_or(const Masks &currentMasks, const Masks &otherMasks);
 
 /// Union the masks of the two proxies.
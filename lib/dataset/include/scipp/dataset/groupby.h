@@ -64,8 +64,9 @@ public:
 
 private:
   T makeReductionOutput(const Dim reductionDim, const FillValue fill) const;
-  template <class Op>
-  T reduce(Op op, const Dim reductionDim, const FillValue fill) const;
+  template <class Op, class MaskedOp = std::nullptr_t>
+  T reduce(Op op, const Dim reductionDim, const FillValue fill,
+           MaskedOp masked_op = nullptr) const;
 
   T m_data;
   GroupByGrouping m_grouping;
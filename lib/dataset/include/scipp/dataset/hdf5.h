@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @brief Native reading and writing of HDF5 files in the layout used by
+/// `scipp.io.hdf5`.
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "scipp-dataset_export.h"
+#include "scipp/dataset/dataset.h"
+
+namespace scipp::dataset::hdf5 {
+
+enum class Compression { None, Gzip };
+
+/// Storage options of the HDF5 datasets holding values and variances.
+struct WriteOptions {
+  Compression compression{Compression::None};
+  /// Compression level, 0-9 for gzip.
+  int compression_level{4};
+  /// Apply the shuffle filter before compression, which typically improves
+  /// the compression ratio of numeric data.
+  bool shuffle{false};
+  /// Target size of chunks in bytes. If 0, datasets are stored contiguously
+  /// unless they are compressed, in which case chunks of 1 MiB are used.
+  scipp::index chunk_bytes{0};
+};
+
+/// Write `obj` to the file `filename`, replacing any existing file.
+///
+/// The memory of contiguous variables is written directly. Binned variables
+/// are written as begin and end indices and the buffer, the buffer is copied
+/// first if it is much larger than the bins, e.g., for slices. Throws
+/// except::TypeError for dtypes without native support, such as PyObject or
+/// Variable.
+SCIPP_DATASET_EXPORT void write(const std::string &filename,
+                                const Variable &obj,
+                                const WriteOptions &options = {});
+SCIPP_DATASET_EXPORT void write(const std::string &filename,
+                                const DataArray &obj,
+                                const WriteOptions &options = {});
+SCIPP_DATASET_EXPORT void write(const std::string &filename,
+                                const Dataset &obj,
+                                const WriteOptions &options = {});
+
+/// Return the type of the object stored in `filename`, "Variable",
+/// "DataArray", or "Dataset".
+[[nodiscard]] SCIPP_DATASET_EXPORT std::string
+object_type(const std::string &filename);
+
+/// Return the sizes of the object stored in `filename` without reading data.
+[[nodiscard]] SCIPP_DATASET_EXPORT Sizes sizes(const std::string &filename);
+
+/// Read the object stored in `filename`.
+///
+/// If `slices` are given only the selected hyperslabs are read from the file,
+/// the result is equivalent to slicing the full object. Chunks of compressed
+/// datasets are decompressed in parallel. Throws except::TypeError for
+/// dtypes without native support.
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable
+read_variable(const std::string &filename,
+              const std::vector<Slice> &slices = {});
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray
+read_data_array(const std::string &filename,
+                const std::vector<Slice> &slices = {});
+[[nodiscard]] SCIPP_DATASET_EXPORT Dataset
+read_dataset(const std::string &filename,
+             const std::vector<Slice> &slices = {});
+
+/// Read only the coord `dim` of the data array or dataset stored in `filename`,
+/// as it would be after applying `slices` to the object.
+///
+/// Throws except::NotFoundError if there is no such coord, including coords
+/// that are turned into attrs by slicing out a position.
+[[nodiscard]] SCIPP_DATASET_EXPORT Variable
+read_coord(const std::string &filename, const Dim dim,
+           const std::vector<Slice> &slices = {});
+
+} // namespace scipp::dataset::hdf5
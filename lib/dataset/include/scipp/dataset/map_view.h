@@ -4,10 +4,15 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 #include <boost/container/small_vector.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 
 #include "scipp/core/sizes.h"
+#include "scipp/core/small_flat_map.h"
 #include "scipp/core/slice.h"
 #include "scipp/dataset/map_view_forward.h"
 #include "scipp/units/dim.h"
@@ -36,39 +41,59 @@ struct make_value {
 
 } // namespace detail
 
+/// Return the slice of a single item of a dict with given sizes.
+///
+/// Items that are bin-edges along the slice dimension are sliced such that
+/// they retain the edges enclosing the selected range.
+template <class T>
+T slice_item(const Sizes &sizes, const T &value, const Slice &params) {
+  if (value.dims().contains(params.dim())) {
+    if (value.dims()[params.dim()] == sizes[params.dim()])
+      return value.slice(params);
+    // bin edge
+    if (params.stride() != 1)
+      throw except::SliceError(
+          "Object has bin-edges along dimension " + to_string(params.dim()) +
+          " so slicing with stride " + std::to_string(params.stride()) +
+          " != 1 is not valid.");
+    const auto end = params.end() == -1               ? params.begin() + 2
+                     : params.begin() == params.end() ? params.end()
+                                                      : params.end() + 1;
+    return value.slice(Slice{params.dim(), params.begin(), end});
+  } else if (params == Slice{}) {
+    return value;
+  } else {
+    return value.as_const();
+  }
+}
+
 template <class T>
 auto slice_map(const Sizes &sizes, const T &map, const Slice &params) {
   T out;
-  for (const auto &[key, value] : map) {
-    if (value.dims().contains(params.dim())) {
-      if (value.dims()[params.dim()] == sizes[params.dim()]) {
-        out[key] = value.slice(params);
-      } else { // bin edge
-        if (params.stride() != 1)
-          throw except::SliceError(
-              "Object has bin-edges along dimension " +
-              to_string(params.dim()) + " so slicing with stride " +
-              std::to_string(params.stride()) + " != 1 is not valid.");
-        const auto end = params.end() == -1               ? params.begin() + 2
-                         : params.begin() == params.end() ? params.end()
-                                                          : params.end() + 1;
-        out[key] = value.slice(Slice{params.dim(), params.begin(), end});
-      }
-    } else if (params == Slice{}) {
-      out[key] = value;
-    } else {
-      out[key] = value.as_const();
-    }
-  }
+  for (const auto &[key, value] : map)
+    out[key] = slice_item(sizes, value, params);
   return out;
 }
 
 /// Common functionality for other const-view classes.
+///
+/// Items are held in a map that is shared between copies of a dict and copied
+/// on write. Slices of a dict reference the map of the sliced dict and slice
+/// individual items lazily when they are first accessed, so the cost of a
+/// slice does not scale with the number of items unless all items are used.
+/// Note that this implies that even const access may modify internal state.
+/// This is synchronized with a mutex while slices are pending, so concurrent
+/// const access is safe as for other containers. Once all items are sliced
+/// const access does not lock.
+///
+/// Dicts rarely hold more than a few dozen items, so items are stored in a flat
+/// map with linear lookup. Iteration order is the insertion order, for slices
+/// the order of the sliced dict.
 template <class Key, class Value> class Dict {
 public:
   using key_type = Key;
   using mapped_type = Value;
-  using holder_type = std::unordered_map<key_type, mapped_type>;
+  using holder_type = core::small_flat_map<key_type, mapped_type>;
 
   Dict() = default;
   Dict(const Sizes &sizes,
@@ -81,9 +106,9 @@ public:
   Dict &operator=(Dict &&other) noexcept;
 
   /// Return the number of coordinates in the view.
-  [[nodiscard]] index size() const noexcept { return scipp::size(m_items); }
+  [[nodiscard]] index size() const { return scipp::size(items()); }
   /// Return true if there are 0 coordinates in the view.
-  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+  [[nodiscard]] bool empty() const { return size() == 0; }
 
   bool contains(const Key &k) const;
   scipp::index count(const Key &k) const;
@@ -96,42 +121,42 @@ public:
   mapped_type at(const Key &key);
   Dim dim_of(const Key &key) const;
 
-  auto find(const Key &k) const noexcept { return m_items.find(k); }
-  auto find(const Key &k) noexcept { return m_items.find(k); }
+  auto find(const Key &k) const { return items().find(k); }
+  auto find(const Key &k) { return writable_items().find(k); }
 
   /// Return const iterator to the beginning of all items.
-  auto begin() const noexcept { return m_items.begin(); }
-  auto begin() noexcept { return m_items.begin(); }
+  auto begin() const { return items().begin(); }
+  auto begin() { return writable_items().begin(); }
   /// Return const iterator to the end of all items.
-  auto end() const noexcept { return m_items.end(); }
-  auto end() noexcept { return m_items.end(); }
+  auto end() const { return items().end(); }
+  auto end() { return writable_items().end(); }
 
   auto items_begin() const && = delete;
   /// Return const iterator to the beginning of all items.
-  auto items_begin() const &noexcept { return begin(); }
+  auto items_begin() const & { return begin(); }
   auto items_end() const && = delete;
   /// Return const iterator to the end of all items.
-  auto items_end() const &noexcept { return end(); }
+  auto items_end() const & { return end(); }
 
   auto keys_begin() const && = delete;
   /// Return const iterator to the beginning of all keys.
-  auto keys_begin() const &noexcept {
+  auto keys_begin() const & {
     return boost::make_transform_iterator(begin(), detail::make_key{});
   }
   auto keys_end() const && = delete;
   /// Return const iterator to the end of all keys.
-  auto keys_end() const &noexcept {
+  auto keys_end() const & {
     return boost::make_transform_iterator(end(), detail::make_key{});
   }
 
   auto values_begin() const && = delete;
   /// Return const iterator to the beginning of all values.
-  auto values_begin() const &noexcept {
+  auto values_begin() const & {
     return boost::make_transform_iterator(begin(), detail::make_value{});
   }
   auto values_end() const && = delete;
   /// Return const iterator to the end of all values.
-  auto values_end() const &noexcept {
+  auto values_end() const & {
     return boost::make_transform_iterator(end(), detail::make_value{});
   }
 
@@ -139,7 +164,7 @@ public:
   bool operator!=(const Dict &other) const;
 
   [[nodiscard]] const Sizes &sizes() const noexcept { return m_sizes; }
-  [[nodiscard]] const auto &items() const noexcept { return m_items; }
+  [[nodiscard]] const holder_type &items() const;
 
   void setSizes(const Sizes &sizes);
   void rebuildSizes();
@@ -164,9 +189,48 @@ public:
   bool is_edges(const Key &key,
                 const std::optional<Dim> dim = std::nullopt) const;
 
+private:
+  /// Which items of the sliced dict a pending slice provides.
+  enum class Select : uint8_t { All, Aligned, Unaligned };
+  /// Slice of the items of another dict that has not been applied yet.
+  struct PendingSlice {
+    std::shared_ptr<const holder_type> items;
+    Sizes sizes;
+    Slice params;
+    Select select;
+    [[nodiscard]] bool selects(const Key &key, const Value &value) const;
+  };
+
+  /// Mutex and flag guarding pending slices. Copies get a new mutex.
+  struct PendingGuard {
+    PendingGuard() = default;
+    PendingGuard(const PendingGuard &) noexcept {}
+    PendingGuard &operator=(const PendingGuard &) noexcept { return *this; }
+    std::mutex mutex;
+    std::atomic<bool> pending{false};
+  };
+
+  Dict(const Dict &other, const std::unique_lock<std::mutex> &);
+  Dict lazy_slice(const Slice &params, const Select select) const;
+  std::unique_lock<std::mutex> lock_pending() const;
+  void update_pending() const noexcept;
+  std::pair<const PendingSlice *, const Value *>
+  find_pending(const Key &key) const;
+  template <class F> void for_each_key(F &&f) const;
+  void materialize() const;
+  void reserve_pending() const;
+  holder_type &unique_items();
+  holder_type &writable_items();
+
 protected:
   Sizes m_sizes;
-  holder_type m_items;
+  // Mutable since `materialize` replaces the items to restore their order.
+  mutable std::shared_ptr<holder_type> m_items;
+  mutable boost::container::small_vector<PendingSlice, 2> m_pending;
+  mutable PendingGuard m_guard;
+  /// Items sliced by `at` before the remaining items of pending slices were
+  /// sliced. References returned by `at` refer to these.
+  mutable std::shared_ptr<const holder_type> m_accessed_items;
   bool m_readonly{false};
 };
 
@@ -14,8 +14,12 @@
 namespace scipp::dataset {
 
 SCIPP_DATASET_EXPORT DataArray mean(const DataArray &a, const Dim dim);
+SCIPP_DATASET_EXPORT DataArray mean(const DataArray &a,
+                                    const scipp::span<const Dim> dims);
 SCIPP_DATASET_EXPORT DataArray mean(const DataArray &a);
 SCIPP_DATASET_EXPORT Dataset mean(const Dataset &d, const Dim dim);
+SCIPP_DATASET_EXPORT Dataset mean(const Dataset &d,
+                                  const scipp::span<const Dim> dims);
 SCIPP_DATASET_EXPORT Dataset mean(const Dataset &d);
 
 } // namespace scipp::dataset
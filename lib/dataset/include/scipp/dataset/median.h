@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+/*
+ * These functions are not generated by CMake since selection-based
+ * reductions cannot be computed by reducing one dimension after the other.
+ */
+
+#include "scipp/dataset/dataset.h"
+
+namespace scipp::dataset {
+
+SCIPP_DATASET_EXPORT DataArray median(const DataArray &a, const Dim dim);
+SCIPP_DATASET_EXPORT DataArray median(const DataArray &a);
+SCIPP_DATASET_EXPORT Dataset median(const Dataset &d, const Dim dim);
+SCIPP_DATASET_EXPORT Dataset median(const Dataset &d);
+
+SCIPP_DATASET_EXPORT DataArray nanmedian(const DataArray &a, const Dim dim);
+SCIPP_DATASET_EXPORT DataArray nanmedian(const DataArray &a);
+SCIPP_DATASET_EXPORT Dataset nanmedian(const Dataset &d, const Dim dim);
+SCIPP_DATASET_EXPORT Dataset nanmedian(const Dataset &d);
+
+SCIPP_DATASET_EXPORT DataArray quantile(const DataArray &a, const double q,
+                                        const Dim dim);
+SCIPP_DATASET_EXPORT DataArray quantile(const DataArray &a, const double q);
+SCIPP_DATASET_EXPORT Dataset quantile(const Dataset &d, const double q,
+                                      const Dim dim);
+SCIPP_DATASET_EXPORT Dataset quantile(const Dataset &d, const double q);
+
+} // namespace scipp::dataset
@@ -21,7 +21,7 @@ template <class Key, class Value>
 Dict<Key, Value>::Dict(const Sizes &sizes,
                        std::initializer_list<std::pair<const Key, Value>> items,
                        const bool readonly)
-    : Dict(sizes, holder_type(items), readonly) {}
+    : Dict(sizes, holder_type(items.begin(), items.end()), readonly) {}
 
 template <class Key, class Value>
 Dict<Key, Value>::Dict(const Sizes &sizes, holder_type items,
@@ -33,20 +33,66 @@ Dict<Key, Value>::Dict(const Sizes &sizes, holder_type items,
   m_readonly = readonly; // NOLINT(cppcoreguidelines-prefer-member-initializer)
 }
 
+/// Copies share the items of `other` until either is modified, unless `other`
+/// has pending slices. In the latter case the items sliced so far are copied,
+/// since they are modified when the remaining items are sliced.
 template <class Key, class Value>
-Dict<Key, Value>::Dict(const Dict &other)
-    : Dict(other.m_sizes, other.m_items, false) {}
+Dict<Key, Value>::Dict(const Dict &other) : Dict(other, other.lock_pending()) {}
+
+/// Copy `other` while holding the lock of its pending slices, if any.
+template <class Key, class Value>
+Dict<Key, Value>::Dict(const Dict &other, const std::unique_lock<std::mutex> &)
+    : m_sizes(other.m_sizes),
+      m_items(other.m_pending.empty() || !other.m_items
+                  ? other.m_items
+                  : std::make_shared<holder_type>(*other.m_items)),
+      m_pending(other.m_pending) {
+  reserve_pending();
+  update_pending();
+}
 
 template <class Key, class Value>
 Dict<Key, Value>::Dict(Dict &&other) noexcept
-    : Dict(std::move(other.m_sizes), std::move(other.m_items),
-           other.m_readonly) {}
+    : m_sizes(std::move(other.m_sizes)), m_items(std::move(other.m_items)),
+      m_pending(std::move(other.m_pending)),
+      m_accessed_items(std::move(other.m_accessed_items)),
+      m_readonly(other.m_readonly) {
+  other.m_pending.clear();
+  other.update_pending();
+  update_pending();
+}
 
 template <class Key, class Value>
-Dict<Key, Value> &Dict<Key, Value>::operator=(const Dict &other) = default;
+Dict<Key, Value> &Dict<Key, Value>::operator=(const Dict &other) {
+  if (this == &other)
+    return *this;
+  Dict copy(other);
+  copy.m_readonly = other.m_readonly;
+  return *this = std::move(copy);
+}
 
 template <class Key, class Value>
-Dict<Key, Value> &Dict<Key, Value>::operator=(Dict &&other) noexcept = default;
+Dict<Key, Value> &Dict<Key, Value>::operator=(Dict &&other) noexcept {
+  if (this == &other)
+    return *this;
+  m_sizes = std::move(other.m_sizes);
+  m_items = std::move(other.m_items);
+  m_pending = std::move(other.m_pending);
+  m_accessed_items = std::move(other.m_accessed_items);
+  other.m_pending.clear();
+  other.update_pending();
+  update_pending();
+  m_readonly = other.m_readonly;
+  return *this;
+}
+
+/// Return all items, slicing items of pending slices.
+template <class Key, class Value>
+const typename Dict<Key, Value>::holder_type &Dict<Key, Value>::items() const {
+  static const holder_type empty_items;
+  materialize();
+  return m_items ? *m_items : empty_items;
+}
 
 template <class Key, class Value>
 bool Dict<Key, Value>::operator==(const Dict &other) const {
@@ -76,7 +122,9 @@ bool Dict<Key, Value>::operator!=(const Dict &other) const {
 /// Returns whether a given key is present in the view.
 template <class Key, class Value>
 bool Dict<Key, Value>::contains(const Key &k) const {
-  return m_items.find(k) != m_items.cend();
+  const auto lock = lock_pending();
+  return (m_items && m_items->find(k) != m_items->cend()) ||
+         find_pending(k).first != nullptr;
 }
 
 /// Returns 1 or 0, depending on whether key is present in the view or not.
@@ -94,8 +142,22 @@ const Value &Dict<Key, Value>::operator[](const Key &key) const {
 /// Const reference to the coordinate for given dimension.
 template <class Key, class Value>
 const Value &Dict<Key, Value>::at(const Key &key) const {
-  scipp::expect::contains(*this, key);
-  return m_items.at(key);
+  {
+    const auto lock = lock_pending();
+    if (m_items)
+      if (const auto it = m_items->find(key); it != m_items->end())
+        return it->second;
+    // Slice only the requested item, others stay pending. Capacity for all
+    // pending items is reserved, so references to other items remain valid.
+    if (const auto [pending, value] = find_pending(key); pending)
+      return m_items
+          ->emplace(key, slice_item(pending->sizes, *value, pending->params))
+          .first->second;
+  }
+  // Formatting the error accesses all items, so this must not hold the lock.
+  using core::to_string;
+  throw except::NotFoundError("Expected " + to_string(*this) + " to contain " +
+                              to_string(key) + ".");
 }
 
 /// The coordinate for given dimension.
@@ -109,32 +171,38 @@ template <class Key, class Value> Value Dict<Key, Value>::at(const Key &key) {
   return std::as_const(*this).at(key);
 }
 
-/// Return the dimension for given coord.
-/// @param key Key of the coordinate in a coord dict
-///
-/// Return the dimension of the coord for 1-D coords or Dim::Invalid for 0-D
-/// coords. In the special case of multi-dimension coords the following applies,
-/// in this order:
-/// - For bin-edge coords return the dimension in which the coord dimension
-///   exceeds the data dimensions.
-/// - Else, for dimension coords (key matching a dimension), return the key.
-/// - Else, return Dim::Invalid.
+namespace {
 template <class Key, class Value>
-Dim Dict<Key, Value>::dim_of(const Key &key) const {
-  const auto &var = at(key);
+Dim dim_of_item(const Sizes &sizes, const Key &key, const Value &var) {
   if (var.dims().ndim() == 0)
     return Dim::Invalid;
   if (var.dims().ndim() == 1)
     return var.dims().inner();
   if constexpr (std::is_same_v<Key, Dim>) {
     for (const auto &dim : var.dims())
-      if (core::is_edges(sizes(), var.dims(), dim))
+      if (core::is_edges(sizes, var.dims(), dim))
         return dim;
     if (var.dims().contains(key))
       return key; // dimension coord
   }
   return Dim::Invalid;
 }
+} // namespace
+
+/// Return the dimension for given coord.
+/// @param key Key of the coordinate in a coord dict
+///
+/// Return the dimension of the coord for 1-D coords or Dim::Invalid for 0-D
+/// coords. In the special case of multi-dimension coords the following applies,
+/// in this order:
+/// - For bin-edge coords return the dimension in which the coord dimension
+///   exceeds the data dimensions.
+/// - Else, for dimension coords (key matching a dimension), return the key.
+/// - Else, return Dim::Invalid.
+template <class Key, class Value>
+Dim Dict<Key, Value>::dim_of(const Key &key) const {
+  return dim_of_item(sizes(), key, at(key));
+}
 
 template <class Key, class Value>
 void Dict<Key, Value>::setSizes(const Sizes &sizes) {
@@ -146,7 +214,7 @@ template <class Key, class Value> void Dict<Key, Value>::rebuildSizes() {
   Sizes new_sizes = m_sizes;
   for (const auto &dim : m_sizes) {
     bool erase = true;
-    for (const auto &item : *this) {
+    for (const auto &item : items()) {
       if (item.second.dims().contains(dim)) {
         erase = false;
         break;
@@ -189,14 +257,14 @@ void Dict<Key, Value>::set(const key_type &key, mapped_type coord) {
     }
   }
   expect_valid_coord_dims(key, dims, m_sizes);
-  m_items.insert_or_assign(key, std::move(coord));
+  writable_items().insert_or_assign(key, std::move(coord));
 }
 
 template <class Key, class Value>
 void Dict<Key, Value>::erase(const key_type &key) {
   expect_writable(*this);
   scipp::expect::contains(*this, key);
-  m_items.erase(key);
+  writable_items().erase(key);
 }
 
 template <class Key, class Value>
@@ -217,34 +285,165 @@ Value Dict<Key, Value>::extract(const key_type &key,
 
 template <class Key, class Value>
 Dict<Key, Value> Dict<Key, Value>::slice(const Slice &params) const {
-  const bool readonly = true;
-  return {m_sizes.slice(params), slice_map(m_sizes, m_items, params), readonly};
-}
-
-namespace {
-constexpr auto unaligned_by_dim_slice = [](const auto &coords, const auto &item,
-                                           const Slice &params) {
-  if (params == Slice{} || params.end() != -1)
-    return false;
-  const Dim dim = params.dim();
-  const auto &[key, var] = item;
-  return var.dims().contains(dim) && coords.dim_of(key) == dim;
-};
+  return lazy_slice(params, Select::All);
 }
 
 template <class Key, class Value>
 std::tuple<Dict<Key, Value>, Dict<Key, Value>>
 Dict<Key, Value>::slice_coords(const Slice &params) const {
-  auto coords = slice(params);
-  coords.m_readonly = false;
-  Dict<Key, Value> attrs(coords.sizes(), {});
-  for (auto &coord : *this)
-    if (unaligned_by_dim_slice(*this, coord, params))
-      attrs.set(coord.first, coords.extract(coord.first));
-  coords.m_readonly = true;
+  auto coords = lazy_slice(params, Select::Aligned);
+  auto attrs = lazy_slice(params, Select::Unaligned);
+  attrs.m_readonly = false;
   return {std::move(coords), std::move(attrs)};
 }
 
+/// Return whether an item is unaligned by a slice.
+///
+/// Slicing out a single position along the dimension of a coord makes that
+/// coord unaligned, it is then turned into an attr.
+template <class Key, class Value>
+bool Dict<Key, Value>::PendingSlice::selects(const Key &key,
+                                             const Value &value) const {
+  if (select == Select::All)
+    return true;
+  const bool unaligned = params != Slice{} && params.end() == -1 &&
+                         value.dims().contains(params.dim()) &&
+                         dim_of_item(sizes, key, value) == params.dim();
+  return unaligned == (select == Select::Unaligned);
+}
+
+/// Return a readonly slice of the selected items.
+///
+/// Items are sliced when first accessed. Slicing bin-edges with a stride is
+/// not valid, in that case all items are sliced right away, to report errors
+/// at the time of slicing.
+template <class Key, class Value>
+Dict<Key, Value> Dict<Key, Value>::lazy_slice(const Slice &params,
+                                              const Select select) const {
+  Dict out;
+  out.m_sizes = m_sizes.slice(params);
+  out.m_items = std::make_shared<holder_type>();
+  out.m_readonly = true;
+  const bool unaligns = params != Slice{} && params.end() == -1;
+  if (!items().empty() && (select != Select::Unaligned || unaligns))
+    out.m_pending.push_back(PendingSlice{m_items, m_sizes, params, select});
+  out.reserve_pending();
+  out.update_pending();
+  if (params.stride() != 1)
+    out.materialize();
+  return out;
+}
+
+/// Return a lock of the mutex guarding pending slices.
+///
+/// The lock is empty if there are no pending slices, since const access does
+/// not modify the dict in that case.
+template <class Key, class Value>
+std::unique_lock<std::mutex> Dict<Key, Value>::lock_pending() const {
+  if (!m_guard.pending.load(std::memory_order_acquire))
+    return {};
+  return std::unique_lock(m_guard.mutex);
+}
+
+/// Update the flag used by `lock_pending`. Must be called after modifying
+/// `m_pending`.
+template <class Key, class Value>
+void Dict<Key, Value>::update_pending() const noexcept {
+  m_guard.pending.store(!m_pending.empty(), std::memory_order_release);
+}
+
+/// Return the pending slice providing `key` and the unsliced item.
+///
+/// Returns a pair of nullptr if no pending slice provides `key`. The caller
+/// must hold the lock returned by `lock_pending`.
+template <class Key, class Value>
+std::pair<const typename Dict<Key, Value>::PendingSlice *, const Value *>
+Dict<Key, Value>::find_pending(const Key &key) const {
+  for (const auto &pending : m_pending)
+    if (const auto it = pending.items->find(key);
+        it != pending.items->end() && pending.selects(key, it->second))
+      return {&pending, &it->second};
+  return {nullptr, nullptr};
+}
+
+/// Call `f` for every key, without slicing items of pending slices.
+template <class Key, class Value>
+template <class F>
+void Dict<Key, Value>::for_each_key(F &&f) const {
+  const auto lock = lock_pending();
+  if (m_items)
+    for (const auto &item : *m_items)
+      f(item.first);
+  for (const auto &pending : m_pending)
+    for (const auto &[key, value] : *pending.items)
+      if (pending.selects(key, value) && !m_items->count(key))
+        f(key);
+}
+
+/// Slice all remaining items of pending slices.
+///
+/// Items are ordered as in the sliced dicts, not in the order in which `at`
+/// sliced them. If any items were sliced already, the map is rebuilt in this
+/// order. The old map is kept alive, since `at` returned references to it.
+template <class Key, class Value> void Dict<Key, Value>::materialize() const {
+  const auto lock = lock_pending();
+  if (m_pending.empty())
+    return;
+  std::shared_ptr<const holder_type> accessed;
+  if (!m_items->empty()) {
+    accessed = std::move(m_items);
+    m_items = std::make_shared<holder_type>();
+    for (const auto &item : *accessed)
+      if (find_pending(item.first).first == nullptr)
+        m_items->insert(item);
+  }
+  for (const auto &pending : m_pending)
+    for (const auto &[key, value] : *pending.items) {
+      if (!pending.selects(key, value) || m_items->count(key))
+        continue;
+      if (accessed && accessed->count(key))
+        m_items->insert(*accessed->find(key));
+      else
+        m_items->emplace(key,
+                         slice_item(pending.sizes, value, pending.params));
+    }
+  if (accessed)
+    m_accessed_items = std::move(accessed);
+  m_pending.clear();
+  update_pending();
+}
+
+/// Reserve capacity for all items of pending slices.
+///
+/// This ensures that slicing items on access does not reallocate, i.e.,
+/// references returned by `at` remain valid.
+template <class Key, class Value>
+void Dict<Key, Value>::reserve_pending() const {
+  if (m_pending.empty())
+    return;
+  scipp::index size = m_items->size();
+  for (const auto &pending : m_pending)
+    size += pending.items->size();
+  m_items->reserve(size);
+}
+
+/// Return the items for modification, copying them if they are shared.
+template <class Key, class Value>
+typename Dict<Key, Value>::holder_type &Dict<Key, Value>::unique_items() {
+  if (!m_items)
+    m_items = std::make_shared<holder_type>();
+  else if (m_items.use_count() > 1)
+    m_items = std::make_shared<holder_type>(*m_items);
+  return *m_items;
+}
+
+/// Return all items for modification, slicing items of pending slices.
+template <class Key, class Value>
+typename Dict<Key, Value>::holder_type &Dict<Key, Value>::writable_items() {
+  materialize();
+  return unique_items();
+}
+
 template <class Key, class Value>
 void Dict<Key, Value>::validateSlice(const Slice &s, const Dict &dict) const {
   using core::to_string;
@@ -282,7 +481,7 @@ Dict<Key, Value> &Dict<Key, Value>::setSlice(const Slice &s, const Dict &dict) {
 template <class Key, class Value>
 void Dict<Key, Value>::rename(const Dim from, const Dim to) {
   m_sizes.replace_key(from, to);
-  for (auto &item : m_items)
+  for (auto &item : writable_items())
     if (item.second.dims().contains(from))
       item.second.rename(from, to);
 }
@@ -302,7 +501,7 @@ bool Dict<Key, Value>::is_readonly() const noexcept {
 template <class Key, class Value>
 Dict<Key, Value> Dict<Key, Value>::as_const() const {
   holder_type items;
-  std::transform(m_items.begin(), m_items.end(),
+  std::transform(begin(), end(),
                  std::inserter(items, items.end()), [](const auto &item) {
                    return std::pair(item.first, item.second.as_const());
                  });
@@ -316,14 +515,31 @@ Dict<Key, Value> Dict<Key, Value>::merge_from(const Dict &other) const {
   using units::to_string;
   auto out(*this);
   out.m_readonly = false;
-  for (const auto &[key, value] : other) {
+  other.for_each_key([&out](const Key &key) {
     if (out.contains(key))
       throw except::DataArrayError(
           "Coord '" + to_string(key) +
           "' shadows attr of the same name. Remove the attr if you are slicing "
           "an array or use the `coords` and `attrs` properties instead of "
           "`meta`.");
-    out.set(key, value);
+  });
+  if (out.sizes() == other.sizes()) {
+    // Items of `other` are valid for the sizes of `out`, keep slices pending.
+    // Items of `out` must precede those of `other`, so slice `out` if `other`
+    // has sliced items already.
+    const auto lock = other.lock_pending();
+    if (other.m_items && !other.m_items->empty())
+      out.materialize();
+    auto &items = out.unique_items();
+    if (other.m_items)
+      items.insert(other.m_items->begin(), other.m_items->end());
+    out.m_pending.insert(out.m_pending.end(), other.m_pending.begin(),
+                         other.m_pending.end());
+    out.reserve_pending();
+    out.update_pending();
+  } else {
+    for (const auto &[key, value] : other)
+      out.set(key, value);
   }
   out.m_readonly = m_readonly;
   return out;
@@ -332,7 +548,7 @@ Dict<Key, Value> Dict<Key, Value>::merge_from(const Dict &other) const {
 template <class Key, class Value>
 bool Dict<Key, Value>::item_applies_to(const Key &key,
                                        const Dimensions &dims) const {
-  const auto &val = m_items.at(key);
+  const auto &val = at(key);
   return std::all_of(val.dims().begin(), val.dims().end(),
                      [&dims](const Dim dim) { return dims.contains(dim); });
 }
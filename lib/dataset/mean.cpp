@@ -18,6 +18,11 @@ DataArray mean(const DataArray &a, const Dim dim) {
       a, [](auto &&..._) { return mean(_...); }, dim, a.masks());
 }
 
+DataArray mean(const DataArray &a, const scipp::span<const Dim> dims) {
+  return apply_to_data_and_drop_dims(
+      a, [](auto &&..._) { return mean(_...); }, dims, a.masks());
+}
+
 DataArray mean(const DataArray &a) {
   return variable::normalize_impl(sum(a), sum(isfinite(a)));
 }
@@ -27,6 +32,11 @@ Dataset mean(const Dataset &d, const Dim dim) {
       d, [](auto &&..._) { return mean(_...); }, dim);
 }
 
+Dataset mean(const Dataset &d, const scipp::span<const Dim> dims) {
+  return apply_to_items(
+      d, [](auto &&..._) { return mean(_...); }, dims);
+}
+
 Dataset mean(const Dataset &d) {
   return apply_to_items(d, [](auto &&..._) { return mean(_...); });
 }
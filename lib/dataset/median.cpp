@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include "scipp/dataset/median.h"
+#include "scipp/variable/reduction.h"
+
+#include "dataset_operations_common.h"
+
+namespace scipp::dataset {
+
+namespace {
+/// Apply a reduction over all dims to the data. As when reducing dims one after
+/// the other, only metadata that does not depend on any dim is preserved.
+template <class Func> DataArray reduce_all(const DataArray &a, Func func) {
+  const auto keep = [](const Variable &var) {
+    return var.dims().empty() ? var : Variable{};
+  };
+  const auto keep_copy = [](const Variable &var) {
+    return var.dims().empty() ? copy(var) : Variable{};
+  };
+  return DataArray(func(a.data(), Dim::Invalid, a.masks()),
+                   transform_map(a.coords(), keep),
+                   transform_map(a.masks(), keep_copy),
+                   transform_map(a.attrs(), keep), a.name());
+}
+} // namespace
+
+DataArray median(const DataArray &a, const Dim dim) {
+  return apply_to_data_and_drop_dim(
+      a, [](auto &&..._) { return median(_...); }, dim, a.masks());
+}
+
+DataArray median(const DataArray &a) {
+  return reduce_all(a, [](auto &&..._) { return median(_...); });
+}
+
+Dataset median(const Dataset &d, const Dim dim) {
+  return apply_to_items(
+      d, [](auto &&..._) { return median(_...); }, dim);
+}
+
+Dataset median(const Dataset &d) {
+  return apply_to_items(d, [](auto &&..._) { return median(_...); });
+}
+
+DataArray nanmedian(const DataArray &a, const Dim dim) {
+  return apply_to_data_and_drop_dim(
+      a, [](auto &&..._) { return nanmedian(_...); }, dim, a.masks());
+}
+
+DataArray nanmedian(const DataArray &a) {
+  return reduce_all(a, [](auto &&..._) { return nanmedian(_...); });
+}
+
+Dataset nanmedian(const Dataset &d, const Dim dim) {
+  return apply_to_items(
+      d, [](auto &&..._) { return nanmedian(_...); }, dim);
+}
+
+Dataset nanmedian(const Dataset &d) {
+  return apply_to_items(d, [](auto &&..._) { return nanmedian(_...); });
+}
+
+DataArray quantile(const DataArray &a, const double q, const Dim dim) {
+  return apply_to_data_and_drop_dim(
+      a,
+      [q](const Variable &var, const Dim dim_, const Masks &masks) {
+        return quantile(var, q, dim_, masks);
+      },
+      dim, a.masks());
+}
+
+DataArray quantile(const DataArray &a, const double q) {
+  return reduce_all(
+      a, [q](const Variable &var, const Dim dim, const Masks &masks) {
+        return quantile(var, q, dim, masks);
+      });
+}
+
+Dataset quantile(const Dataset &d, const double q, const Dim dim) {
+  return apply_to_items(
+      d,
+      [q](const DataArray &a, const Dim dim_) { return quantile(a, q, dim_); },
+      dim);
+}
+
+Dataset quantile(const Dataset &d, const double q) {
+  return apply_to_items(d,
+                        [q](const DataArray &a) { return quantile(a, q); });
+}
+
+} // namespace scipp::dataset
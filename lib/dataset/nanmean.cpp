@@ -20,6 +20,11 @@ DataArray nanmean(const DataArray &a, const Dim dim) {
       a, [](auto &&..._) { return nanmean(_...); }, dim, a.masks());
 }
 
+DataArray nanmean(const DataArray &a, const scipp::span<const Dim> dims) {
+  return apply_to_data_and_drop_dims(
+      a, [](auto &&..._) { return nanmean(_...); }, dims, a.masks());
+}
+
 DataArray nanmean(const DataArray &a) {
   return variable::normalize_impl(nansum(a), sum(isfinite(a)));
 }
@@ -29,6 +34,11 @@ Dataset nanmean(const Dataset &d, const Dim dim) {
       d, [](auto &&..._) { return nanmean(_...); }, dim);
 }
 
+Dataset nanmean(const Dataset &d, const scipp::span<const Dim> dims) {
+  return apply_to_items(
+      d, [](auto &&..._) { return nanmean(_...); }, dims);
+}
+
 Dataset nanmean(const Dataset &d) {
   return apply_to_items(d, [](auto &&..._) { return nanmean(_...); });
 }
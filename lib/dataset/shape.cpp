@@ -76,7 +76,7 @@ template <class Maps> auto concat_maps(const Maps &maps, const Dim dim) {
   if (maps.empty())
     throw std::invalid_argument("Cannot concat empty list.");
   using T = typename Maps::value_type;
-  std::unordered_map<typename T::key_type, typename T::mapped_type> out;
+  core::small_flat_map<typename T::key_type, typename T::mapped_type> out;
   const auto &a = maps.front();
   for (const auto &[key, a_] : a) {
     auto vars = map(maps, [&key = key](auto &&map) { return map[key]; });
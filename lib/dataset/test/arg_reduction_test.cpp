@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "test_macros.h"
+
+#include "scipp/dataset/arg_reduction.h"
+#include "scipp/dataset/dataset.h"
+
+using namespace scipp;
+
+class DataArrayArgReductionTest : public ::testing::Test {
+protected:
+  DataArray da{
+      makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3}, units::m,
+                           Values{1, 2, 30, 4, 50, 6}),
+      {{Dim::X, makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3})},
+       {Dim::Y, makeVariable<double>(Dims{Dim::Y}, Shape{2}, Values{1, 2})}},
+      {{"x", makeVariable<bool>(Dims{Dim::X}, Shape{3},
+                                Values{false, false, true})}}};
+};
+
+TEST_F(DataArrayArgReductionTest, masked_elements_are_skipped) {
+  const auto result = argmax(da, Dim::X);
+  EXPECT_EQ(result.data(),
+            makeVariable<int64_t>(Dims{Dim::Y}, Shape{2}, units::none,
+                                  Values{1, 1}));
+  EXPECT_EQ(result.coords()[Dim::Y], da.coords()[Dim::Y]);
+  EXPECT_FALSE(result.coords().contains(Dim::X));
+  EXPECT_FALSE(result.masks().contains("x"));
+  EXPECT_EQ(argmin(da, Dim::X).data(),
+            makeVariable<int64_t>(Dims{Dim::Y}, Shape{2}, units::none,
+                                  Values{0, 0}));
+}
+
+TEST_F(DataArrayArgReductionTest, mask_not_along_dim_is_preserved) {
+  const auto result = argmax(da, Dim::Y);
+  EXPECT_EQ(result.data(),
+            makeVariable<int64_t>(Dims{Dim::X}, Shape{3}, units::none,
+                                  Values{1, 1, 0}));
+  EXPECT_EQ(result.masks()["x"], da.masks()["x"]);
+}
+
+TEST_F(DataArrayArgReductionTest, topk) {
+  const auto result = topk(da, 2, Dim::X);
+  EXPECT_EQ(result.data(),
+            makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2}, units::m,
+                                 Values{2, 1, 50, 4}));
+  EXPECT_EQ(result.coords()[Dim::Y], da.coords()[Dim::Y]);
+  EXPECT_FALSE(result.coords().contains(Dim::X));
+}
+
+TEST_F(DataArrayArgReductionTest, dataset) {
+  Dataset ds({{"a", da}, {"b", -da}});
+  EXPECT_EQ(argmin(ds, Dim::X)["a"], argmin(da, Dim::X));
+  EXPECT_EQ(argmin(ds, Dim::X)["b"], argmax(da, Dim::X));
+  EXPECT_EQ(topk(ds, 1, Dim::X)["b"], topk(-da, 1, Dim::X));
+}
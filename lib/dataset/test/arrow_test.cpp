@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include "test_macros.h"
+#include <gtest/gtest.h>
+
+#include "scipp/dataset/arrow.h"
+#include "scipp/dataset/bins.h"
+#include "scipp/variable/astype.h"
+#include "scipp/variable/shape.h"
+
+using namespace scipp;
+using namespace scipp::dataset;
+
+namespace {
+Variable round_trip(const Variable &var) {
+  ArrowArray array;
+  ArrowSchema schema;
+  to_arrow(var, array, schema);
+  auto out = from_arrow(array, schema);
+  schema.release(&schema);
+  EXPECT_EQ(array.release, nullptr);
+  return out;
+}
+} // namespace
+
+class ArrowTest : public ::testing::Test {
+protected:
+  Variable var = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                      units::m, Values{1, 2, 3, 4, 5, 6});
+};
+
+TEST_F(ArrowTest, round_trip) {
+  const auto out = round_trip(var);
+  EXPECT_EQ(out, var);
+  EXPECT_TRUE(out.is_readonly());
+}
+
+TEST_F(ArrowTest, round_trip_does_not_copy) {
+  const auto out = round_trip(var);
+  EXPECT_EQ(out.values<double>().data(), var.values<double>().data());
+}
+
+TEST_F(ArrowTest, export_does_not_copy) {
+  ArrowArray array;
+  ArrowSchema schema;
+  to_arrow(var, array, schema);
+  EXPECT_EQ(array.length, 6);
+  EXPECT_EQ(array.n_buffers, 2);
+  EXPECT_EQ(array.buffers[1], var.values<double>().data());
+  EXPECT_EQ(std::string(schema.format), "g");
+  array.release(&array);
+  schema.release(&schema);
+}
+
+TEST_F(ArrowTest, export_keeps_data_alive) {
+  ArrowArray array;
+  ArrowSchema schema;
+  to_arrow(copy(var), array, schema);
+  const auto *data = static_cast<const double *>(array.buffers[1]);
+  EXPECT_EQ(data[5], 6.0);
+  array.release(&array);
+  schema.release(&schema);
+}
+
+TEST_F(ArrowTest, imported_variable_keeps_data_alive) {
+  const auto out = round_trip(copy(var));
+  EXPECT_EQ(out, var);
+}
+
+TEST_F(ArrowTest, writing_to_imported_data_copies) {
+  const auto imported = round_trip(var);
+  Variable writable(imported.dims(), imported.data_handle());
+  writable.values<double>()[0] = -1.0;
+  EXPECT_EQ(var.values<double>()[0], 1.0);
+  EXPECT_NE(writable.values<double>().data(), var.values<double>().data());
+  // The model is shared, so the read-only handle sees the write.
+  EXPECT_EQ(imported.values<double>()[0], -1.0);
+}
+
+TEST_F(ArrowTest, round_trip_non_contiguous) {
+  const auto slice = var.slice({Dim::X, 1});
+  EXPECT_EQ(round_trip(slice), slice);
+  const auto transposed = transpose(var);
+  EXPECT_EQ(round_trip(transposed), copy(transposed));
+}
+
+TEST_F(ArrowTest, round_trip_scalar) {
+  const auto scalar = makeVariable<int32_t>(units::counts, Values{4});
+  EXPECT_EQ(round_trip(scalar), scalar);
+}
+
+TEST_F(ArrowTest, variances_throws) {
+  const auto with_variances = makeVariable<double>(
+      Dims{Dim::X}, Shape{2}, Values{1, 2}, Variances{3, 4});
+  ArrowArray array;
+  ArrowSchema schema;
+  EXPECT_THROW(to_arrow(with_variances, array, schema),
+               except::VariancesError);
+}
+
+TEST_F(ArrowTest, round_trip_bool) {
+  const auto flags = makeVariable<bool>(Dims{Dim::X}, Shape{10},
+                                        Values{true, false, false, true, true,
+                                               false, true, false, true, true});
+  EXPECT_EQ(round_trip(flags), flags);
+  EXPECT_EQ(round_trip(flags.slice({Dim::X, 3, 10})),
+            flags.slice({Dim::X, 3, 10}));
+}
+
+TEST_F(ArrowTest, round_trip_datetime) {
+  const auto times = makeVariable<core::time_point>(
+      Dims{Dim::X}, Shape{2}, units::ns,
+      Values{core::time_point{1}, core::time_point{2}});
+  const auto out = round_trip(times);
+  EXPECT_EQ(out, times);
+  EXPECT_EQ(out.values<core::time_point>().data(),
+            times.values<core::time_point>().data());
+}
+
+TEST_F(ArrowTest, round_trip_strings) {
+  const auto strings = makeVariable<std::string>(Dims{Dim::X}, Shape{3},
+                                                 Values{"a", "", "bcd"});
+  const auto out = round_trip(strings);
+  ASSERT_EQ(out.dtype(), dtype<std::string_view>);
+  EXPECT_EQ(out.dims(), strings.dims());
+  EXPECT_EQ(astype(out, dtype<std::string>), strings);
+}
+
+TEST_F(ArrowTest, round_trip_string_views_does_not_copy) {
+  const auto strings = round_trip(makeVariable<std::string>(
+      Dims{Dim::X}, Shape{3}, Values{"a", "", "bcd"}));
+  const auto out = round_trip(strings);
+  EXPECT_EQ(out.values<std::string_view>()[0].data(),
+            strings.values<std::string_view>()[0].data());
+  EXPECT_EQ(out.values<std::string_view>()[2],
+            strings.values<std::string_view>()[2]);
+}
+
+class ArrowBinsTest : public ::testing::Test {
+protected:
+  Variable indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{3},
+      Values{std::pair{0, 2}, std::pair{2, 2}, std::pair{2, 5}});
+  DataArray buffer = DataArray(
+      makeVariable<float>(Dims{Dim::Event}, Shape{5}, units::counts,
+                          Values{1, 2, 3, 4, 5}, Variances{1, 2, 3, 4, 5}),
+      {{Dim::X, makeVariable<double>(Dims{Dim::Event}, Shape{5}, units::m,
+                                     Values{1, 2, 3, 4, 5})}},
+      {{"mask", makeVariable<bool>(Dims{Dim::Event}, Shape{5},
+                                   Values{true, false, false, true, false})}});
+  Variable binned = make_bins(indices, Dim::Event, buffer);
+};
+
+TEST_F(ArrowBinsTest, round_trip) {
+  const auto out = round_trip(binned);
+  EXPECT_EQ(out, binned);
+  EXPECT_EQ(std::get<2>(out.constituents<DataArray>()), buffer);
+}
+
+TEST_F(ArrowBinsTest, export_uses_bin_indices_as_offsets) {
+  ArrowArray array;
+  ArrowSchema schema;
+  to_arrow(binned, array, schema);
+  EXPECT_EQ(std::string(schema.format), "+L");
+  const auto *offsets = static_cast<const int64_t *>(array.buffers[1]);
+  EXPECT_EQ(std::vector<int64_t>(offsets, offsets + 4),
+            std::vector<int64_t>({0, 2, 2, 5}));
+  ASSERT_EQ(array.n_children, 1);
+  EXPECT_EQ(array.children[0]->length, 5);
+  array.release(&array);
+  schema.release(&schema);
+}
+
+TEST_F(ArrowBinsTest, round_trip_slice) {
+  const auto slice = binned.slice({Dim::Y, 1, 3});
+  EXPECT_EQ(round_trip(slice), slice);
+}
+
+TEST_F(ArrowBinsTest, round_trip_non_contiguous_bins) {
+  indices.values<scipp::index_pair>()[2] = {3, 5};
+  const auto gaps = make_bins(indices, Dim::Event, buffer);
+  EXPECT_EQ(round_trip(gaps), gaps);
+}
+
+TEST_F(ArrowBinsTest, round_trip_does_not_copy_coords) {
+  const auto out = round_trip(binned);
+  const auto &[i0, dim0, buffer0] = binned.constituents<DataArray>();
+  const auto &[i1, dim1, buffer1] = out.constituents<DataArray>();
+  EXPECT_EQ(buffer1.coords()[Dim::X].values<double>().data(),
+            buffer0.coords()[Dim::X].values<double>().data());
+}
+
+TEST_F(ArrowBinsTest, multi_dimensional_throws) {
+  const auto binned_2d = make_bins(
+      makeVariable<scipp::index_pair>(Dims{Dim::Y, Dim::Z}, Shape{1, 1},
+                                      Values{std::pair{0, 5}}),
+      Dim::Event, buffer);
+  ArrowArray array;
+  ArrowSchema schema;
+  EXPECT_THROW(to_arrow(binned_2d, array, schema), except::DimensionError);
+}
@@ -12,6 +12,7 @@
 #include "scipp/dataset/shape.h"
 #include "scipp/dataset/string.h"
 #include "scipp/variable/arithmetic.h"
+#include "scipp/variable/astype.h"
 #include "scipp/variable/comparison.h"
 #include "scipp/variable/creation.h"
 #include "scipp/variable/reduction.h"
@@ -122,6 +123,49 @@ TEST(BinGroupTest, 1d) {
             expected.slice({Dim::Row, 4}));
 }
 
+TEST(BinGroupTest, 1d_categorical_string) {
+  const Dimensions dims(Dim::Row, 5);
+  const auto data = makeVariable<double>(dims, Values{1, 2, 3, 4, 5});
+  const auto label =
+      astype(makeVariable<std::string>(dims, Values{"a", "b", "c", "b", "a"}),
+             dtype<core::categorical_string>);
+  const auto table = DataArray(data, {{Dim("label"), label}});
+  // Encoded in a different dictionary than the labels.
+  const auto groups =
+      astype(makeVariable<std::string>(Dims{Dim("label")}, Shape{2},
+                                       Values{"a", "c"}),
+             dtype<core::categorical_string>);
+  const auto binned = bin(table, {}, {groups});
+  EXPECT_EQ(binned.dims(), groups.dims());
+  EXPECT_EQ(binned.coords()[Dim("label")], groups);
+  const auto bins = binned.values<core::bin<DataArray>>();
+  EXPECT_EQ(bins[0].data(),
+            makeVariable<double>(Dims{Dim::Row}, Shape{2}, Values{1, 5}));
+  EXPECT_EQ(bins[1].data(),
+            makeVariable<double>(Dims{Dim::Row}, Shape{1}, Values{3}));
+}
+
+TEST(BinStringViewTest, characters_outlive_input) {
+  const Dimensions dims(Dim::Row, 4);
+  const auto names =
+      makeVariable<std::string>(dims, Values{"d", "b", "c", "a"});
+  auto table =
+      DataArray(makeVariable<double>(dims, Values{1, 2, 3, 4}),
+                {{Dim::X, makeVariable<double>(dims, Values{3, 1, 2, 0})},
+                 {Dim("name"), astype(names, dtype<std::string_view>)}});
+  const auto edges =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{0, 2, 4});
+  const auto binned = bin(table, {edges});
+  table = DataArray{};
+  const auto bins = binned.values<core::bin<DataArray>>();
+  EXPECT_EQ(astype(bins[0].coords()[Dim("name")], dtype<std::string>),
+            makeVariable<std::string>(Dims{Dim::Row}, Shape{2},
+                                      Values{"b", "a"}));
+  EXPECT_EQ(astype(bins[1].coords()[Dim("name")], dtype<std::string>),
+            makeVariable<std::string>(Dims{Dim::Row}, Shape{2},
+                                      Values{"d", "c"}));
+}
+
 TEST(BinGroupTest, 1d_zero_groups) {
   const Dimensions dims(Dim::Row, 3);
   const auto data = makeVariable<double>(dims, Values{1, 2, 3});
@@ -148,6 +192,36 @@ TEST(BinGroupTest, 1d_regroup_to_zero_groups) {
   EXPECT_EQ(binned, bin(table, {}, {groups0}));
 }
 
+template <class T> class BinGroupNarrowTest : public ::testing::Test {};
+using BinGroupNarrowTestTypes =
+    ::testing::Types<int8_t, int16_t, uint8_t, uint16_t, uint32_t, uint64_t>;
+TYPED_TEST_SUITE(BinGroupNarrowTest, BinGroupNarrowTestTypes);
+
+TYPED_TEST(BinGroupNarrowTest, 1d) {
+  using T = TypeParam;
+  const Dimensions dims(Dim::Row, 5);
+  const auto data = makeVariable<double>(dims, Values{1, 2, 3, 4, 5});
+  const auto pulse = makeVariable<uint16_t>(dims, Values{7, 7, 8, 9, 9});
+  const auto label =
+      makeVariable<T>(dims, Values{T{50}, T{3}, T{50}, T{3}, T{100}});
+  const auto table =
+      DataArray(data, {{Dim("label"), label}, {Dim("pulse"), pulse}});
+  const auto groups =
+      makeVariable<T>(Dims{Dim("label")}, Shape{2}, Values{T{3}, T{50}});
+  const auto binned = bin(table, {}, {groups});
+  auto expected = copy(table);
+  expected.coords().erase(Dim("label"));
+  EXPECT_EQ(binned.coords()[Dim("label")], groups);
+  EXPECT_EQ(binned.template values<core::bin<DataArray>>()[0],
+            concat(std::vector{expected.slice({Dim::Row, 1, 2}),
+                               expected.slice({Dim::Row, 3, 4})},
+                   Dim::Row));
+  EXPECT_EQ(binned.template values<core::bin<DataArray>>()[1],
+            concat(std::vector{expected.slice({Dim::Row, 0, 1}),
+                               expected.slice({Dim::Row, 2, 3})},
+                   Dim::Row));
+}
+
 class BinTest : public ::testing::TestWithParam<DataArray> {
 protected:
   Variable groups = makeVariable<int64_t>(Dims{Dim("group")}, Shape{5},
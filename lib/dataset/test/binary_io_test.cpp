@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include "test_macros.h"
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <utility>
+
+#include "scipp/core/eigen.h"
+#include "scipp/dataset/binary_io.h"
+#include "scipp/dataset/bins.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/shape.h"
+
+#include "io_test_common.h"
+
+using binary_io::ReadMode;
+
+class BinaryIOTest : public ::testing::TestWithParam<ReadMode>,
+                     protected IOTestData {
+protected:
+  BinaryIOTest() : IOTestData(".scipp") {}
+
+  template <class T> T round_trip(const T &obj) {
+    binary_io::write(filename, obj);
+    if constexpr (std::is_same_v<T, Variable>)
+      return binary_io::read_variable(filename, GetParam());
+    else if constexpr (std::is_same_v<T, DataArray>)
+      return binary_io::read_data_array(filename, GetParam());
+    else
+      return binary_io::read_dataset(filename, GetParam());
+  }
+};
+
+INSTANTIATE_TEST_SUITE_P(Mode, BinaryIOTest,
+                         ::testing::Values(ReadMode::Map, ReadMode::Read));
+
+TEST_P(BinaryIOTest, variable) { EXPECT_EQ(round_trip(var), var); }
+
+TEST_P(BinaryIOTest, variable_scalar_without_unit) {
+  const auto scalar = makeVariable<int64_t>(units::none, Values{42});
+  EXPECT_EQ(round_trip(scalar), scalar);
+}
+
+TEST_P(BinaryIOTest, variable_empty) {
+  const auto empty = makeVariable<float>(Dims{Dim::X}, Shape{0});
+  EXPECT_EQ(round_trip(empty), empty);
+}
+
+TEST_P(BinaryIOTest, variable_non_contiguous) {
+  const auto transposed = transpose(var);
+  EXPECT_EQ(round_trip(transposed), copy(transposed));
+  const auto sliced = var.slice({Dim::X, 1, 3});
+  EXPECT_EQ(round_trip(sliced), copy(sliced));
+}
+
+TEST_P(BinaryIOTest, variable_dtypes) {
+  Eigen::Matrix3d m;
+  m << 1, 2, 3, 4, 5, 6, 7, 8, 9;
+  const std::vector<Variable> vars{
+      makeVariable<float>(Dims{Dim::X}, Shape{2}, Values{1.5, 2.5}),
+      makeVariable<uint8_t>(Dims{Dim::X}, Shape{2}, Values{1, 255}),
+      makeVariable<bool>(Dims{Dim::X}, Shape{2}, Values{true, false}),
+      makeVariable<core::time_point>(Dims{Dim::X}, Shape{2}, units::ns,
+                                     Values{core::time_point{1},
+                                            core::time_point{-2}}),
+      makeVariable<std::string>(Dims{Dim::X}, Shape{3},
+                                Values{"a", "", "äöü"}),
+      makeVariable<Eigen::Vector3d>(Dims{Dim::X}, Shape{1}, units::m,
+                                    Values{Eigen::Vector3d(1, 2, 3)}),
+      makeVariable<Eigen::Matrix3d>(Dims{Dim::X}, Shape{1}, Values{m})};
+  for (const auto &v : vars)
+    EXPECT_EQ(round_trip(v), v);
+}
+
+TEST_P(BinaryIOTest, variable_unsupported_dtype_throws) {
+  const auto nested = makeVariable<Variable>(Values{var});
+  EXPECT_THROW(binary_io::write(filename, nested), except::TypeError);
+}
+
+TEST_P(BinaryIOTest, loaded_variable_can_be_modified) {
+  auto loaded = round_trip(var);
+  loaded.values<double>()[0] = 100.0;
+  EXPECT_EQ(round_trip(var), var);
+}
+
+TEST_P(BinaryIOTest, writing_to_loaded_variable_does_not_copy) {
+  auto loaded = round_trip(var);
+  const auto *data = std::as_const(loaded).values<double>().data();
+  EXPECT_EQ(loaded.values<double>().data(), data);
+  EXPECT_EQ(loaded.variances<double>().data(),
+            std::as_const(loaded).variances<double>().data());
+}
+
+TEST_P(BinaryIOTest, loaded_object_can_be_written_to_same_file) {
+  const auto loaded = round_trip(da);
+  binary_io::write(filename, loaded);
+  EXPECT_EQ(loaded, da);
+  EXPECT_EQ(binary_io::read_data_array(filename, GetParam()), da);
+  // The temporary file has been renamed.
+  for (const auto &entry : std::filesystem::directory_iterator(
+           std::filesystem::path(filename).parent_path()))
+    EXPECT_NE(entry.path().string().rfind(filename + ".tmp", 0), 0u);
+}
+
+TEST_P(BinaryIOTest, data_array) { EXPECT_EQ(round_trip(da), da); }
+
+TEST_P(BinaryIOTest, dataset) {
+  Dataset ds({{"a", da}, {"b", DataArray(y * y)}});
+  EXPECT_EQ(round_trip(ds), ds);
+}
+
+TEST_P(BinaryIOTest, binned) {
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{3},
+      Values{std::pair{0, 2}, std::pair{2, 2}, std::pair{2, 5}});
+  const auto buffer = makeVariable<double>(Dims{Dim::Event}, Shape{5},
+                                           units::m, Values{1, 2, 3, 4, 5});
+  const auto binned =
+      make_bins(indices, Dim::Event, DataArray(buffer, {{Dim::X, buffer}}));
+  EXPECT_EQ(round_trip(binned), binned);
+  const auto slice = binned.slice({Dim::Y, 1, 3});
+  EXPECT_EQ(round_trip(slice), copy(slice));
+  EXPECT_EQ(round_trip(DataArray(binned, {{Dim::Y, y}})),
+            DataArray(binned, {{Dim::Y, y}}));
+}
+
+TEST_P(BinaryIOTest, object_type) {
+  binary_io::write(filename, da);
+  EXPECT_EQ(binary_io::object_type(filename), "DataArray");
+}
+
+TEST_P(BinaryIOTest, read_wrong_type_throws) {
+  binary_io::write(filename, var);
+  EXPECT_THROW_DISCARD(binary_io::read_data_array(filename, GetParam()),
+                       std::runtime_error);
+}
+
+TEST_P(BinaryIOTest, read_invalid_file_throws) {
+  std::ofstream(filename) << "not a scipp file";
+  EXPECT_THROW_DISCARD(binary_io::read_variable(filename, GetParam()),
+                       std::runtime_error);
+}
+
+TEST_P(BinaryIOTest, read_truncated_file_throws) {
+  binary_io::write(filename, var);
+  std::filesystem::resize_file(filename,
+                               std::filesystem::file_size(filename) - 8);
+  EXPECT_THROW_DISCARD(binary_io::read_variable(filename, GetParam()),
+                       std::runtime_error);
+}
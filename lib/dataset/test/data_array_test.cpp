@@ -2,6 +2,8 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include <unordered_map>
+
 #include "scipp/dataset/data_array.h"
 #include "scipp/dataset/except.h"
 #include "scipp/variable/to_unit.h"
@@ -26,6 +28,15 @@ TEST_F(DataArrayTest, constructor_shares) {
   EXPECT_TRUE(a.attrs()[Dim("attr")].is_same(attr));
 }
 
+TEST_F(DataArrayTest, constructor_from_unordered_map) {
+  const std::unordered_map<Dim, Variable> coords{{Dim::X, coord}};
+  const std::unordered_map<std::string, Variable> masks{{"mask", mask}};
+  DataArray a(data, coords, masks);
+  EXPECT_TRUE(a.coords()[Dim::X].is_same(coord));
+  EXPECT_TRUE(a.masks()["mask"].is_same(mask));
+  EXPECT_TRUE(a.attrs().empty());
+}
+
 TEST_F(DataArrayTest, copy_shares) {
   const DataArray a(data, {{Dim::X, coord}}, {{"mask", mask}},
                     {{Dim("attr"), attr}});
@@ -772,3 +772,87 @@ TEST(DataArrayMasks, can_contain_any_type_but_only_OR_bools) {
   ASSERT_NO_THROW(a += a);
   ASSERT_NO_THROW_DISCARD(a + a);
 }
+
+class DatasetBatchedBinaryOpTest : public ::testing::Test {
+protected:
+  static Dataset make_dataset(const scipp::index n_items, const double offset) {
+    Dataset ds;
+    ds.setCoord(Dim::X, makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m,
+                                             Values{1, 2, 3}));
+    ds.setCoord(Dim::Y, makeVariable<double>(Dims{Dim::Y}, Shape{2}, units::m,
+                                             Values{4, 5}));
+    for (scipp::index i = 0; i < n_items; ++i) {
+      const auto dims = i % 2 == 0 ? Dimensions{Dim::X, 3}
+                                   : Dimensions{{Dim::Y, 2}, {Dim::X, 3}};
+      Variable data = makeVariable<double>(dims, units::counts);
+      for (auto &x : data.values<double>())
+        x = offset + static_cast<double>(i);
+      const auto name = "item" + std::to_string(i);
+      ds.setData(name, data);
+      ds[name].masks().set("mask", makeVariable<bool>(Dims{Dim::X}, Shape{3},
+                                                      Values{false, i % 3 == 0,
+                                                             false}));
+    }
+    return ds;
+  }
+};
+
+TEST_F(DatasetBatchedBinaryOpTest, dataset_dataset_matches_itemwise) {
+  const auto a = make_dataset(64, 1.0);
+  const auto b = make_dataset(64, 2.0);
+  const auto res = a * b;
+  ASSERT_EQ(res.size(), 64);
+  EXPECT_EQ(res.coords(), a.coords());
+  for (const auto &item : a)
+    EXPECT_EQ(res[item.name()], item * b[item.name()]);
+}
+
+TEST_F(DatasetBatchedBinaryOpTest, dataset_broadcast_matches_itemwise) {
+  const auto a = make_dataset(64, 1.0);
+  const auto b = make_dataset(1, 2.0)["item0"];
+  const auto res = a - b;
+  const auto res_var = b.data() - a;
+  for (const auto &item : a) {
+    EXPECT_EQ(res[item.name()], item - b);
+    EXPECT_EQ(res_var[item.name()], b.data() - item);
+  }
+}
+
+TEST_F(DatasetBatchedBinaryOpTest, in_place_matches_itemwise) {
+  auto a = make_dataset(64, 1.0);
+  const auto b = make_dataset(64, 2.0);
+  const auto expected = a + b;
+  a += b;
+  EXPECT_EQ(a, expected);
+}
+
+TEST_F(DatasetBatchedBinaryOpTest, in_place_with_items_sharing_buffer) {
+  auto var = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                  units::counts, Values{1, 2, 3, 4, 5, 6});
+  Dataset a;
+  a.setData("a", var.slice({Dim::Y, 0}));
+  a.setData("b", var.slice({Dim::Y, 1}));
+  Dataset b;
+  b.setData("a", var.slice({Dim::Y, 1}));
+  b.setData("b", var.slice({Dim::Y, 0}));
+  a += b;
+  // Items are processed in order, "b" sees the result of the op on "a".
+  EXPECT_EQ(a["a"].data(),
+            makeVariable<double>(Dims{Dim::X}, Shape{3}, units::counts,
+                                 Values{5, 7, 9}));
+  EXPECT_EQ(a["b"].data(),
+            makeVariable<double>(Dims{Dim::X}, Shape{3}, units::counts,
+                                 Values{9, 12, 15}));
+}
+
+TEST_F(DatasetBatchedBinaryOpTest, coord_mismatch_of_any_item_throws) {
+  auto a = make_dataset(64, 1.0);
+  auto b = make_dataset(64, 2.0);
+  // The Y coord applies only to items with odd index.
+  b.setCoord(Dim::Y, makeVariable<double>(Dims{Dim::Y}, Shape{2}, units::m,
+                                          Values{4, 6}));
+  EXPECT_THROW_DISCARD(a + b, except::CoordMismatchError);
+  const auto original(a);
+  EXPECT_THROW(a += b, except::CoordMismatchError);
+  EXPECT_EQ(a, original);
+}
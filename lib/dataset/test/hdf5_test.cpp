@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include "test_macros.h"
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <thread>
+
+#include "scipp/core/eigen.h"
+#include "scipp/dataset/bins.h"
+#include "scipp/dataset/hdf5.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/creation.h"
+#include "scipp/variable/shape.h"
+
+#include "io_test_common.h"
+
+class HDF5Test : public ::testing::Test, protected IOTestData {
+protected:
+  HDF5Test() : IOTestData(".h5") {}
+
+  template <class T>
+  T round_trip(const T &obj, const hdf5::WriteOptions &options = {},
+               const std::vector<Slice> &slices = {}) {
+    hdf5::write(filename, obj, options);
+    if constexpr (std::is_same_v<T, Variable>)
+      return hdf5::read_variable(filename, slices);
+    else if constexpr (std::is_same_v<T, DataArray>)
+      return hdf5::read_data_array(filename, slices);
+    else
+      return hdf5::read_dataset(filename, slices);
+  }
+};
+
+TEST_F(HDF5Test, variable) { EXPECT_EQ(round_trip(var), var); }
+
+TEST_F(HDF5Test, variable_scalar_without_unit) {
+  const auto scalar = makeVariable<int64_t>(units::none, Values{42});
+  EXPECT_EQ(round_trip(scalar), scalar);
+}
+
+TEST_F(HDF5Test, variable_non_contiguous) {
+  const auto transposed = transpose(var);
+  EXPECT_EQ(round_trip(transposed), copy(transposed));
+  const auto sliced = var.slice({Dim::X, 1, 3});
+  EXPECT_EQ(round_trip(sliced), copy(sliced));
+}
+
+TEST_F(HDF5Test, variable_dtypes) {
+  const std::vector<Variable> vars{
+      makeVariable<float>(Dims{Dim::X}, Shape{2}, Values{1.5, 2.5}),
+      makeVariable<uint8_t>(Dims{Dim::X}, Shape{2}, Values{1, 255}),
+      makeVariable<bool>(Dims{Dim::X}, Shape{2}, Values{true, false}),
+      makeVariable<core::time_point>(Dims{Dim::X}, Shape{2}, units::ns,
+                                     Values{core::time_point{1},
+                                            core::time_point{-2}}),
+      makeVariable<std::string>(Dims{Dim::X}, Shape{3},
+                                Values{"a", "", "äöü"}),
+      makeVariable<Eigen::Vector3d>(Dims{Dim::X}, Shape{1}, units::m,
+                                    Values{Eigen::Vector3d(1, 2, 3)})};
+  for (const auto &v : vars)
+    EXPECT_EQ(round_trip(v), v);
+}
+
+TEST_F(HDF5Test, variable_matrix_is_stored_row_major) {
+  Eigen::Matrix3d m;
+  m << 1, 2, 3, 4, 5, 6, 7, 8, 9;
+  const auto matrix =
+      makeVariable<Eigen::Matrix3d>(Dims{Dim::X}, Shape{1}, Values{m});
+  EXPECT_EQ(round_trip(matrix), matrix);
+}
+
+TEST_F(HDF5Test, variable_unsupported_dtype_throws) {
+  const auto nested = makeVariable<Variable>(Values{var});
+  EXPECT_THROW(hdf5::write(filename, nested), except::TypeError);
+}
+
+TEST_F(HDF5Test, compression_round_trip) {
+  auto large = variable::empty(Dimensions{{Dim::Y, 100}, {Dim::X, 1000}},
+                               units::counts, dtype<double>);
+  auto values = large.values<double>();
+  for (scipp::index i = 0; i < values.size(); ++i)
+    values[i] = static_cast<double>(i % 17);
+  for (const auto shuffle : {false, true}) {
+    hdf5::WriteOptions options{hdf5::Compression::Gzip, 6, shuffle, 8192};
+    EXPECT_EQ(round_trip(large, options), large);
+    EXPECT_EQ(round_trip(large, options, {{Dim::Y, 13, 57}, {Dim::X, 101}}),
+              copy(large.slice({Dim::Y, 13, 57}).slice({Dim::X, 101})));
+  }
+}
+
+TEST_F(HDF5Test, invalid_options_throw) {
+  EXPECT_THROW(hdf5::write(filename, var, {hdf5::Compression::Gzip, 10}),
+               std::invalid_argument);
+  EXPECT_THROW(hdf5::write(filename, var, {hdf5::Compression::None, 4, false,
+                                           -1}),
+               std::invalid_argument);
+}
+
+TEST_F(HDF5Test, data_array) { EXPECT_EQ(round_trip(da), da); }
+
+TEST_F(HDF5Test, data_array_slices) {
+  EXPECT_EQ(round_trip(da, {}, {{Dim::X, 1, 3}}),
+            copy(da.slice({Dim::X, 1, 3})));
+  EXPECT_EQ(round_trip(da, {}, {{Dim::X, 2}, {Dim::Y, 0, 2}}),
+            copy(da.slice({Dim::X, 2}).slice({Dim::Y, 0, 2})));
+}
+
+TEST_F(HDF5Test, invalid_slices_throw) {
+  hdf5::write(filename, da);
+  EXPECT_THROW_DISCARD(hdf5::read_data_array(filename, {{Dim::X, 0, 5}}),
+                       except::SliceError);
+  EXPECT_THROW_DISCARD(hdf5::read_data_array(filename, {{Dim::X, 0, 4, 2}}),
+                       except::SliceError);
+}
+
+TEST_F(HDF5Test, sizes_and_object_type) {
+  hdf5::write(filename, da);
+  EXPECT_EQ(hdf5::object_type(filename), "DataArray");
+  EXPECT_EQ(hdf5::sizes(filename), da.dims());
+}
+
+TEST_F(HDF5Test, read_coord) {
+  hdf5::write(filename, da);
+  EXPECT_EQ(hdf5::read_coord(filename, Dim::X), x);
+  EXPECT_EQ(hdf5::read_coord(filename, Dim::X, {{Dim::X, 1, 3}}),
+            x.slice({Dim::X, 1, 4}));
+  EXPECT_EQ(hdf5::read_coord(filename, Dim::Y, {{Dim::X, 1}}), y);
+  // Slicing out a position turns the coord into an attr.
+  EXPECT_THROW_DISCARD(hdf5::read_coord(filename, Dim::Y, {{Dim::Y, 1}}),
+                       except::NotFoundError);
+  EXPECT_THROW_DISCARD(hdf5::read_coord(filename, Dim("attr")),
+                       except::NotFoundError);
+}
+
+TEST_F(HDF5Test, read_wrong_type_throws) {
+  hdf5::write(filename, var);
+  EXPECT_THROW_DISCARD(hdf5::read_data_array(filename), std::runtime_error);
+}
+
+TEST_F(HDF5Test, dataset) {
+  Dataset ds({{"a", da}, {"b", DataArray(y * y)}});
+  EXPECT_EQ(round_trip(ds), ds);
+  EXPECT_EQ(round_trip(ds, {}, {{Dim::Y, 1, 3}}),
+            copy(ds.slice({Dim::Y, 1, 3})));
+}
+
+TEST_F(HDF5Test, binned) {
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{3},
+      Values{std::pair{0, 2}, std::pair{2, 2}, std::pair{2, 5}});
+  const auto buffer = makeVariable<double>(Dims{Dim::Event}, Shape{5},
+                                           units::m, Values{1, 2, 3, 4, 5});
+  const auto binned =
+      make_bins(indices, Dim::Event, DataArray(buffer, {{Dim::X, buffer}}));
+  EXPECT_EQ(round_trip(binned), binned);
+  EXPECT_EQ(round_trip(binned, {}, {{Dim::Y, 1, 3}}),
+            copy(binned.slice({Dim::Y, 1, 3})));
+  const auto slice = binned.slice({Dim::Y, 2});
+  EXPECT_EQ(round_trip(slice), copy(slice));
+}
+
+TEST_F(HDF5Test, concurrent_reads_and_writes) {
+  auto large = variable::empty(Dimensions{{Dim::Y, 64}, {Dim::X, 1000}},
+                               units::counts, dtype<double>);
+  auto xs = variable::empty(Dimensions{Dim::X, 1000}, units::s, dtype<double>);
+  auto values = large.values<double>();
+  for (scipp::index i = 0; i < values.size(); ++i)
+    values[i] = static_cast<double>(i % 23);
+  for (scipp::index i = 0; i < xs.dims().volume(); ++i)
+    xs.values<double>()[i] = 0.5 * static_cast<double>(i);
+  const DataArray compressed(large, {{Dim::X, xs}});
+  hdf5::write(filename, compressed, {hdf5::Compression::Gzip, 4, true, 4096});
+  std::vector<std::thread> threads;
+  for (scipp::index i = 0; i < 8; ++i)
+    threads.emplace_back([&, i]() {
+      const auto own = filename + std::to_string(i);
+      for (scipp::index repeat = 0; repeat < 4; ++repeat) {
+        EXPECT_EQ(hdf5::read_data_array(filename), compressed);
+        EXPECT_EQ(hdf5::read_data_array(filename, {{Dim::Y, i, i + 8}}),
+                  copy(compressed.slice({Dim::Y, i, i + 8})));
+        EXPECT_EQ(hdf5::sizes(filename), Sizes(compressed.dims()));
+        hdf5::write(own, da);
+        EXPECT_EQ(hdf5::read_data_array(own), da);
+      }
+      std::filesystem::remove(own);
+    });
+  for (auto &thread : threads)
+    thread.join();
+}
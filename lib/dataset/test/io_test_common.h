@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+
+#include "scipp/dataset/data_array.h"
+
+using namespace scipp;
+using namespace scipp::dataset;
+
+/// Objects and a temporary file for tests of writing and reading files.
+///
+/// The file is named after the running test, such that tests of different
+/// file formats and parametrizations do not share files. It is removed when
+/// the test finishes.
+class IOTestData {
+protected:
+  explicit IOTestData(const std::string &extension)
+      : filename(temp_filename(extension)) {}
+  ~IOTestData() { std::filesystem::remove(filename); }
+
+  std::string filename;
+  Variable var = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{3, 4},
+                                      units::m, Values{1, 2, 3, 4, 5, 6, 7, 8,
+                                                       9, 10, 11, 12},
+                                      Variances{1, 1, 1, 1, 2, 2, 2, 2, 3, 3,
+                                                3, 3});
+  Variable x = makeVariable<double>(Dims{Dim::X}, Shape{5}, units::s,
+                                    Values{0, 1, 2, 3, 4});
+  Variable y = makeVariable<int32_t>(Dims{Dim::Y}, Shape{3},
+                                     Values{10, 20, 30});
+  DataArray da{var,
+               {{Dim::X, x}, {Dim::Y, y}},
+               {{"mask", makeVariable<bool>(Dims{Dim::Y}, Shape{3},
+                                            Values{true, false, true})}},
+               {{Dim("attr"), makeVariable<std::string>(Values{"abc"})}},
+               "name"};
+
+private:
+  static std::string temp_filename(const std::string &extension) {
+    const auto *info = ::testing::UnitTest::GetInstance()->current_test_info();
+    const auto name =
+        std::string(info->test_suite_name()) + '.' + info->name();
+    return (std::filesystem::temp_directory_path() /
+            ("scipp-io-test-" +
+             std::to_string(std::hash<std::string>{}(name)) + extension))
+        .string();
+  }
+};
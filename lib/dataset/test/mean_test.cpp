@@ -142,6 +142,26 @@ TEST(MeanTest, masked_data_array_md_masks) {
   test_masked_data_array_nd_mask(nanmean_func);
 }
 
+TEST(MeanTest, masked_data_array_multiple_dims) {
+  const auto var = makeVariable<double>(
+      Dimensions{{Dim::Z, 2}, {Dim::Y, 2}, {Dim::X, 3}}, units::m,
+      Values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, double(NAN)});
+  DataArray a(var);
+  a.masks().set("x", makeVariable<bool>(Dimensions{Dim::X, 3},
+                                        Values{false, true, false}));
+  a.masks().set("z", makeVariable<bool>(Dimensions{Dim::Z, 2},
+                                        Values{true, false}));
+  const std::vector<Dim> dims{Dim::Y, Dim::X};
+  const auto expected = makeVariable<double>(
+      Dimensions{Dim::Z, 2}, units::m, Values{3.5, double(NAN)});
+  EXPECT_TRUE(equals_nan(mean(a, dims).data(), expected));
+  EXPECT_TRUE(mean(a, dims).masks().contains("z"));
+  EXPECT_EQ(nanmean(a, dims).data(),
+            makeVariable<double>(Dimensions{Dim::Z, 2}, units::m,
+                                 Values{3.5, 26.0 / 3}));
+  EXPECT_EQ(nanmean(Dataset({{"a", a}}), dims)["a"], nanmean(a, dims));
+}
+
 TYPED_TEST(MeanTest, nanmean_masked_data_with_nans) {
   if constexpr (!TestFixture::TestNans)
     GTEST_SKIP_(
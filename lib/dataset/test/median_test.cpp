@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "test_macros.h"
+
+#include "scipp/dataset/dataset.h"
+#include "scipp/dataset/median.h"
+#include "scipp/variable/reduction.h"
+
+using namespace scipp;
+
+class DataArrayMedianTest : public ::testing::Test {
+protected:
+  DataArray da{
+      makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3}, units::m,
+                           Values{1, 2, 30, 4, 5, 60}),
+      {{Dim::X, makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3})},
+       {Dim::Y, makeVariable<double>(Dims{Dim::Y}, Shape{2}, Values{1, 2})},
+       {Dim("scalar"), makeVariable<double>(Values{1.2})}},
+      {{"x", makeVariable<bool>(Dims{Dim::X}, Shape{3},
+                                Values{false, false, true})}}};
+};
+
+TEST_F(DataArrayMedianTest, masked_elements_are_ignored) {
+  const auto result = median(da, Dim::X);
+  EXPECT_EQ(result.data(), makeVariable<double>(Dims{Dim::Y}, Shape{2},
+                                                units::m, Values{1.5, 4.5}));
+  EXPECT_EQ(result.coords()[Dim::Y], da.coords()[Dim::Y]);
+  EXPECT_FALSE(result.coords().contains(Dim::X));
+  EXPECT_FALSE(result.masks().contains("x"));
+}
+
+TEST_F(DataArrayMedianTest, mask_not_along_dim_is_preserved) {
+  const auto result = median(da, Dim::Y);
+  EXPECT_EQ(result.data(),
+            makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m,
+                                 Values{2.5, 3.5, 45}));
+  EXPECT_EQ(result.masks()["x"], da.masks()["x"]);
+}
+
+TEST_F(DataArrayMedianTest, all_dims) {
+  const auto result = median(da);
+  EXPECT_EQ(result.data(), makeVariable<double>(units::m, Values{3}));
+  EXPECT_EQ(result.coords()[Dim("scalar")], da.coords()[Dim("scalar")]);
+  EXPECT_FALSE(result.coords().contains(Dim::X));
+  EXPECT_FALSE(result.coords().contains(Dim::Y));
+  EXPECT_TRUE(result.masks().empty());
+}
+
+TEST_F(DataArrayMedianTest, quantile) {
+  EXPECT_EQ(quantile(da, 0.5), median(da));
+  EXPECT_EQ(quantile(da, 0.0).data(),
+            makeVariable<double>(units::m, Values{1}));
+  EXPECT_EQ(quantile(da, 1.0, Dim::X).data(),
+            makeVariable<double>(Dims{Dim::Y}, Shape{2}, units::m,
+                                 Values{2, 5}));
+}
+
+TEST_F(DataArrayMedianTest, dataset) {
+  Dataset ds({{"a", da}, {"b", da * da}});
+  const auto result = nanmedian(ds, Dim::X);
+  EXPECT_EQ(result["a"], nanmedian(da, Dim::X));
+  EXPECT_EQ(result["b"], nanmedian(da * da, Dim::X));
+}
+
+TEST_F(DataArrayMedianTest, all_dims_with_outer_mask) {
+  da.masks().set("y", makeVariable<bool>(Dims{Dim::Y}, Shape{2},
+                                         Values{true, false}));
+  EXPECT_EQ(median(da).data(), makeVariable<double>(units::m, Values{4.5}));
+  EXPECT_EQ(quantile(da, 1.0).data(),
+            makeVariable<double>(units::m, Values{5}));
+}
+
+TEST_F(DataArrayMedianTest, all_dims_parallel_select) {
+  const auto limit = variable::detail::parallel_quantile_min_size();
+  variable::detail::set_parallel_quantile_min_size(1);
+  const auto result = median(da);
+  da.masks().set("y", makeVariable<bool>(Dims{Dim::Y}, Shape{2},
+                                         Values{true, false}));
+  const auto masked_outer = median(da);
+  variable::detail::set_parallel_quantile_min_size(limit);
+  EXPECT_EQ(result.data(), makeVariable<double>(units::m, Values{3}));
+  EXPECT_EQ(masked_outer.data(), makeVariable<double>(units::m, Values{4.5}));
+}
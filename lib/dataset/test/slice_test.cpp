@@ -3,12 +3,14 @@
 #include <gtest/gtest.h>
 
 #include <numeric>
+#include <thread>
 
 #include "dataset_test_common.h"
 #include "scipp/core/dimensions.h"
 #include "scipp/core/except.h"
 #include "scipp/core/slice.h"
 #include "scipp/dataset/dataset.h"
+#include "scipp/dataset/except.h"
 #include "scipp/variable/arithmetic.h"
 #include "test_macros.h"
 
@@ -673,3 +675,130 @@ TEST(SliceWithStrideTest, works_if_bin_edges_along_unrelated_dim) {
   Slice params(Dim::Y, 0, 4, 2);
   EXPECT_NO_THROW_DISCARD(da.slice(params));
 }
+
+class LazyMetadataSliceTest : public ::testing::Test {
+protected:
+  Variable xy = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{4, 3},
+                                     Values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+                                            12});
+  Variable x = makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1, 2, 3, 4});
+  Variable y_edges =
+      makeVariable<double>(Dims{Dim::Y}, Shape{4}, Values{1, 2, 3, 4});
+  DataArray a{xy,
+              {{Dim::X, x}, {Dim::Y, y_edges}, {Dim("xy"), xy}},
+              {{"mask", makeVariable<bool>(Dims{Dim::X}, Shape{4},
+                                           Values{true, false, true, false})}},
+              {{Dim("attr"), x + x}}};
+};
+
+TEST_F(LazyMetadataSliceTest, items_match_slices_of_items) {
+  const auto slice = a.slice({Dim::X, 1, 3});
+  EXPECT_EQ(slice.coords()[Dim("xy")], xy.slice({Dim::X, 1, 3}));
+  EXPECT_EQ(slice.coords()[Dim::Y], y_edges);
+  EXPECT_EQ(slice.masks()["mask"], a.masks()["mask"].slice({Dim::X, 1, 3}));
+  EXPECT_EQ(slice.attrs()[Dim("attr")], (x + x).slice({Dim::X, 1, 3}));
+  EXPECT_EQ(slice.coords().size(), 3);
+  EXPECT_EQ(slice.masks().size(), 1);
+  EXPECT_EQ(slice.attrs().size(), 1);
+}
+
+TEST_F(LazyMetadataSliceTest, bin_edges_are_sliced_on_access) {
+  const auto slice = a.slice({Dim::Y, 1});
+  EXPECT_FALSE(slice.coords().contains(Dim::Y));
+  EXPECT_EQ(slice.attrs()[Dim::Y], y_edges.slice({Dim::Y, 1, 3}));
+  EXPECT_EQ(slice.coords()[Dim::X], x);
+}
+
+TEST_F(LazyMetadataSliceTest, equal_to_slice_of_copy) {
+  const auto slice = a.slice({Dim::X, 2});
+  EXPECT_EQ(slice, copy(a).slice({Dim::X, 2}));
+  EXPECT_EQ(copy(slice), slice);
+}
+
+TEST_F(LazyMetadataSliceTest, unaffected_by_modification_of_original) {
+  const auto slice = a.slice({Dim::X, 1, 3});
+  a.coords().set(Dim::X, x + x);
+  a.coords().set(Dim::Z, x);
+  a.coords().erase(Dim("xy"));
+  a.masks().erase("mask");
+  a.rename(Dim::Y, Dim::Z);
+  EXPECT_EQ(slice.coords()[Dim::X], x.slice({Dim::X, 1, 3}));
+  EXPECT_FALSE(slice.coords().contains(Dim::Z));
+  EXPECT_TRUE(slice.coords().contains(Dim("xy")));
+  EXPECT_TRUE(slice.masks().contains("mask"));
+  EXPECT_TRUE(slice.dims().contains(Dim::Y));
+  EXPECT_TRUE(slice.coords()[Dim("xy")].dims().contains(Dim::Y));
+}
+
+TEST_F(LazyMetadataSliceTest, shares_buffers_with_original) {
+  const auto expected = xy.slice({Dim::X, 1, 3}) * (2.0 * units::one);
+  const auto slice = a.slice({Dim::X, 1, 3});
+  a.coords()[Dim("xy")] *= 2.0 * units::one;
+  EXPECT_EQ(slice.coords()[Dim("xy")], expected);
+}
+
+TEST_F(LazyMetadataSliceTest, unaligned_coord_shadowing_attr_throws) {
+  a.attrs().set(Dim::X, x);
+  EXPECT_THROW_DISCARD(a.slice({Dim::X, 1}), except::DataArrayError);
+  EXPECT_NO_THROW_DISCARD(a.slice({Dim::X, 1, 2}));
+}
+
+TEST_F(LazyMetadataSliceTest, missing_key_throws) {
+  const auto slice = a.slice({Dim::X, 1, 3});
+  EXPECT_THROW_DISCARD(slice.coords()[Dim::Z], except::NotFoundError);
+  EXPECT_EQ(slice.coords()[Dim::X], x.slice({Dim::X, 1, 3}));
+}
+
+TEST_F(LazyMetadataSliceTest, iteration_order_is_independent_of_access) {
+  const auto slice = a.slice({Dim::X, 1, 3});
+  const auto &xy_slice = slice.coords()[Dim("xy")];
+  EXPECT_EQ(slice.coords()[Dim::Y], y_edges);
+  std::vector<Dim> keys;
+  for (const auto &[key, value] : slice.coords())
+    keys.push_back(key);
+  EXPECT_EQ(keys, (std::vector<Dim>{Dim::X, Dim::Y, Dim("xy")}));
+  // Reference returned before iteration remains valid.
+  EXPECT_EQ(xy_slice, xy.slice({Dim::X, 1, 3}));
+}
+
+TEST_F(LazyMetadataSliceTest, meta_order_is_independent_of_access) {
+  const auto expected = a.slice({Dim::Y, 1});
+  std::vector<Dim> expected_keys;
+  for (const auto &[key, value] : expected.attrs())
+    expected_keys.push_back(key);
+  for (const auto &[key, value] : expected.coords())
+    expected_keys.push_back(key);
+  const auto slice = a.slice({Dim::Y, 1});
+  EXPECT_EQ(slice.coords()[Dim::X], x);
+  std::vector<Dim> keys;
+  for (const auto &[key, value] : slice.meta())
+    keys.push_back(key);
+  EXPECT_EQ(keys, expected_keys);
+}
+
+TEST_F(LazyMetadataSliceTest, concurrent_const_access) {
+  std::vector<Variable> expected;
+  for (scipp::index i = 0; i < 32; ++i) {
+    const auto coord = x * ((1.0 * i) * units::one);
+    a.coords().set(Dim("c" + std::to_string(i)), coord);
+    expected.push_back(coord.slice({Dim::X, 1, 3}));
+  }
+  for (scipp::index repeat = 0; repeat < 20; ++repeat) {
+    const auto slice = a.slice({Dim::X, 1, 3});
+    std::vector<std::thread> threads;
+    for (scipp::index thread = 0; thread < 8; ++thread)
+      threads.emplace_back([&, thread]() {
+        for (scipp::index i = 0; i < 32; ++i) {
+          const auto j = (i + 4 * thread) % 32;
+          const Dim dim("c" + std::to_string(j));
+          EXPECT_TRUE(slice.coords().contains(dim));
+          EXPECT_EQ(slice.coords()[dim], expected[j]);
+          if (i == 3 * thread)
+            EXPECT_EQ(DataArray(slice).coords().size(), 35);
+        }
+        EXPECT_EQ(slice.coords().size(), 35);
+      });
+    for (auto &thread : threads)
+      thread.join();
+  }
+}
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "scipp/dataset/bins.h"
+#include "scipp/dataset/max.h"
 #include "scipp/dataset/mean.h"
 #include "scipp/dataset/sum.h"
 #include "scipp/variable/reduction.h"
@@ -76,6 +77,29 @@ TEST(SumTest, masked_data_array_two_masks) {
   EXPECT_FALSE(sum(a, Dim::Y).masks().contains("y"));
 }
 
+TEST(SumTest, masked_data_array_multiple_dims) {
+  const auto var = makeVariable<double>(
+      Dimensions{{Dim::Z, 2}, {Dim::Y, 2}, {Dim::X, 3}}, units::m,
+      Values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+  DataArray a(var, {{Dim::Z, makeVariable<double>(Dims{Dim::Z}, Shape{2})},
+                    {Dim::X, makeVariable<double>(Dims{Dim::X}, Shape{3})}});
+  a.masks().set("x", makeVariable<bool>(Dimensions{Dim::X, 3},
+                                        Values{false, true, false}));
+  a.masks().set("z", makeVariable<bool>(Dimensions{Dim::Z, 2},
+                                        Values{true, false}));
+  const std::vector<Dim> dims{Dim::Y, Dim::X};
+  const auto summed = sum(a, dims);
+  EXPECT_EQ(summed, sum(sum(a, Dim::X), Dim::Y));
+  EXPECT_EQ(summed.data(), makeVariable<double>(Dimensions{Dim::Z, 2},
+                                                units::m, Values{14, 38}));
+  EXPECT_TRUE(summed.coords().contains(Dim::Z));
+  EXPECT_FALSE(summed.coords().contains(Dim::X));
+  EXPECT_TRUE(summed.masks().contains("z"));
+  EXPECT_FALSE(summed.masks().contains("x"));
+  EXPECT_EQ(max(a, dims), max(max(a, Dim::Y), Dim::X));
+  EXPECT_EQ(sum(Dataset({{"a", a}}), dims)["a"], summed);
+}
+
 class Sum2dCoordTest : public ::testing::Test {
 protected:
   Variable var{makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
@@ -2,6 +2,9 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <algorithm>
+#include <vector>
+
 #include "scipp/dataset/map_view.h"
 
 #include "../variable/operations_common.h"
@@ -27,14 +30,82 @@ Variable reduce_impl(const Variable &var, const Dim dim, const Masks &masks,
   }
   return op(var, dim);
 }
+
+/// Return the union of the masks that apply when reducing along `dim`. For
+/// Dim::Invalid, i.e., a reduction along all dims, this includes all masks
+/// that depend on any dim.
+Variable reduction_mask(const Masks &masks, const Dim dim) {
+  if (dim != Dim::Invalid)
+    return irreducible_mask(masks, dim);
+  Variable union_;
+  for (const auto &mask : masks)
+    if (!mask.second.dims().empty())
+      union_ = union_.is_valid() ? union_ | mask.second : copy(mask.second);
+  return union_;
+}
+
+/// Return the union of the masks that apply when reducing along all of `dims`.
+Variable reduction_mask(const Masks &masks, const scipp::span<const Dim> dims) {
+  Variable union_;
+  for (const auto &mask : masks)
+    if (std::any_of(dims.begin(), dims.end(), [&mask](const Dim dim) {
+          return mask.second.dims().contains(dim);
+        }))
+      union_ = union_.is_valid() ? union_ | mask.second : copy(mask.second);
+  return union_;
+}
+
+template <class Op>
+Variable reduce_impl(const Variable &var, const scipp::span<const Dim> dims,
+                     const Masks &masks, const FillValue fill, const Op &op) {
+  if (const auto mask_union = reduction_mask(masks, dims);
+      mask_union.is_valid()) {
+    return op(
+        where(mask_union, dense_special_like(var, Dimensions{}, fill), var),
+        dims);
+  }
+  return op(var, dims);
+}
+
+/// Return the number of elements of `var` along `dims` that are not masked.
+///
+/// Only the mask is summed, the extents of dims it does not depend on are
+/// multiplied instead.
+Variable unmasked_count(const Variable &var, const scipp::span<const Dim> dims,
+                        const Variable &mask) {
+  std::vector<Dim> mask_dims;
+  scipp::index volume = 1;
+  for (const auto dim : dims) {
+    if (mask.dims().contains(dim))
+      mask_dims.push_back(dim);
+    else
+      volume *= var.dims()[dim];
+  }
+  return sum(~mask, mask_dims) * (volume * units::none);
+}
+
+void expect_not_binned(const Variable &var, const std::string_view name) {
+  if (is_bins(var))
+    throw except::DimensionError(
+        std::string(name) +
+        " of masked binned data over multiple dimensions is not supported, "
+        "reduce one dimension at a time instead.");
+}
 } // namespace
 
 Variable sum(const Variable &var, const Dim dim, const Masks &masks) {
+  // Masked elements are skipped during accumulation, no masked copy required.
+  if (const auto mask_union = irreducible_mask(masks, dim);
+      mask_union.is_valid() && !is_bins(var))
+    return masked_sum(var, dim, mask_union);
   return reduce_impl(var, dim, masks, FillValue::Default,
                      [](auto &&...args) { return sum(args...); });
 }
 
 Variable nansum(const Variable &var, const Dim dim, const Masks &masks) {
+  if (const auto mask_union = irreducible_mask(masks, dim);
+      mask_union.is_valid() && !is_bins(var))
+    return masked_nansum(var, dim, mask_union);
   return reduce_impl(var, dim, masks, FillValue::Default,
                      [](auto &&...args) { return nansum(args...); });
 }
@@ -69,11 +140,40 @@ Variable any(const Variable &var, const Dim dim, const Masks &masks) {
                      [](auto &&...args) { return any(args...); });
 }
 
+Variable median(const Variable &var, const Dim dim, const Masks &masks) {
+  // Masked elements are skipped during selection, no masked copy required.
+  return quantile_impl(var, dim, 0.5, false, reduction_mask(masks, dim));
+}
+
+Variable nanmedian(const Variable &var, const Dim dim, const Masks &masks) {
+  return quantile_impl(var, dim, 0.5, true, reduction_mask(masks, dim));
+}
+
+Variable quantile(const Variable &var, const double q, const Dim dim,
+                  const Masks &masks) {
+  return quantile_impl(var, dim, q, false, reduction_mask(masks, dim));
+}
+
+Variable argmin(const Variable &var, const Dim dim, const Masks &masks) {
+  return argmin_impl(var, dim, irreducible_mask(masks, dim));
+}
+
+Variable argmax(const Variable &var, const Dim dim, const Masks &masks) {
+  return argmax_impl(var, dim, irreducible_mask(masks, dim));
+}
+
+Variable topk(const Variable &var, const scipp::index k, const Dim dim,
+              const Masks &masks) {
+  return topk_impl(var, k, dim, irreducible_mask(masks, dim));
+}
+
 Variable mean(const Variable &var, const Dim dim, const Masks &masks) {
   if (const auto mask_union = irreducible_mask(masks, dim);
       mask_union.is_valid()) {
     const auto count = sum(~mask_union, dim);
-    return mean_impl(where(mask_union, zero_like(var), var), dim, count);
+    if (is_bins(var))
+      return mean_impl(where(mask_union, zero_like(var), var), dim, count);
+    return normalize_impl(masked_sum(var, dim, mask_union), count);
   }
   return mean(var, dim);
 }
@@ -81,11 +181,92 @@ Variable mean(const Variable &var, const Dim dim, const Masks &masks) {
 Variable nanmean(const Variable &var, const Dim dim, const Masks &masks) {
   if (const auto mask_union = irreducible_mask(masks, dim);
       mask_union.is_valid()) {
-    const auto count = sum(
-        where(mask_union, makeVariable<bool>(Values{false}), ~isnan(var)), dim);
-    return nanmean_impl(where(mask_union, zero_like(var), var), dim, count);
+    if (is_bins(var)) {
+      const auto count = sum(
+          where(mask_union, makeVariable<bool>(Values{false}), ~isnan(var)),
+          dim);
+      return nanmean_impl(where(mask_union, zero_like(var), var), dim, count);
+    }
+    const auto count = masked_sum(~isnan(var), dim, mask_union);
+    return normalize_impl(masked_nansum(var, dim, mask_union), count);
   }
   return nanmean(var, dim);
 }
 
+Variable sum(const Variable &var, const scipp::span<const Dim> dims,
+             const Masks &masks) {
+  if (const auto mask_union = reduction_mask(masks, dims);
+      mask_union.is_valid() && !is_bins(var))
+    return masked_sum(var, dims, mask_union);
+  return reduce_impl(var, dims, masks, FillValue::Default,
+                     [](auto &&...args) { return sum(args...); });
+}
+
+Variable nansum(const Variable &var, const scipp::span<const Dim> dims,
+                const Masks &masks) {
+  if (const auto mask_union = reduction_mask(masks, dims);
+      mask_union.is_valid() && !is_bins(var))
+    return masked_nansum(var, dims, mask_union);
+  return reduce_impl(var, dims, masks, FillValue::Default,
+                     [](auto &&...args) { return nansum(args...); });
+}
+
+Variable max(const Variable &var, const scipp::span<const Dim> dims,
+             const Masks &masks) {
+  return reduce_impl(var, dims, masks, FillValue::Lowest,
+                     [](auto &&...args) { return max(args...); });
+}
+
+Variable nanmax(const Variable &var, const scipp::span<const Dim> dims,
+                const Masks &masks) {
+  return reduce_impl(var, dims, masks, FillValue::Lowest,
+                     [](auto &&...args) { return nanmax(args...); });
+}
+
+Variable min(const Variable &var, const scipp::span<const Dim> dims,
+             const Masks &masks) {
+  return reduce_impl(var, dims, masks, FillValue::Max,
+                     [](auto &&...args) { return min(args...); });
+}
+
+Variable nanmin(const Variable &var, const scipp::span<const Dim> dims,
+                const Masks &masks) {
+  return reduce_impl(var, dims, masks, FillValue::Max,
+                     [](auto &&...args) { return nanmin(args...); });
+}
+
+Variable all(const Variable &var, const scipp::span<const Dim> dims,
+             const Masks &masks) {
+  return reduce_impl(var, dims, masks, FillValue::True,
+                     [](auto &&...args) { return all(args...); });
+}
+
+Variable any(const Variable &var, const scipp::span<const Dim> dims,
+             const Masks &masks) {
+  return reduce_impl(var, dims, masks, FillValue::False,
+                     [](auto &&...args) { return any(args...); });
+}
+
+Variable mean(const Variable &var, const scipp::span<const Dim> dims,
+              const Masks &masks) {
+  if (const auto mask_union = reduction_mask(masks, dims);
+      mask_union.is_valid()) {
+    expect_not_binned(var, "mean");
+    return normalize_impl(masked_sum(var, dims, mask_union),
+                          unmasked_count(var, dims, mask_union));
+  }
+  return mean(var, dims);
+}
+
+Variable nanmean(const Variable &var, const scipp::span<const Dim> dims,
+                 const Masks &masks) {
+  if (const auto mask_union = reduction_mask(masks, dims);
+      mask_union.is_valid()) {
+    expect_not_binned(var, "nanmean");
+    const auto count = masked_sum(~isnan(var), dims, mask_union);
+    return normalize_impl(masked_nansum(var, dims, mask_union), count);
+  }
+  return nanmean(var, dims);
+}
+
 } // namespace scipp::dataset
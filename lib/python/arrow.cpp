@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#include "scipp/dataset/arrow.h"
+#include "scipp/dataset/dataset.h"
+
+#include "pybind11.h"
+
+using namespace scipp;
+using namespace scipp::dataset;
+
+namespace py = pybind11;
+
+namespace {
+// Capsule names and ownership semantics as defined by the Arrow PyCapsule
+// interface. Consumers move the struct out of the capsule and set its release
+// callback to null, otherwise the capsule releases it.
+constexpr auto schema_capsule_name = "arrow_schema";
+constexpr auto array_capsule_name = "arrow_array";
+
+template <class T> T *capsule_pointer(PyObject *capsule, const char *name) {
+  auto *ptr = static_cast<T *>(PyCapsule_GetPointer(capsule, name));
+  if (ptr == nullptr)
+    throw py::error_already_set();
+  return ptr;
+}
+
+template <class T> void release_capsule(PyObject *capsule) {
+  auto *ptr = static_cast<T *>(PyCapsule_GetPointer(
+      capsule, std::is_same_v<T, ArrowSchema> ? schema_capsule_name
+                                              : array_capsule_name));
+  if (ptr == nullptr) {
+    PyErr_WriteUnraisable(capsule);
+    return;
+  }
+  if (ptr->release != nullptr)
+    ptr->release(ptr);
+  delete ptr;
+}
+} // namespace
+
+void init_arrow(py::module &m) {
+  m.def(
+      "_to_arrow_c_array",
+      [](const Variable &var) {
+        auto schema = std::make_unique<ArrowSchema>();
+        auto array = std::make_unique<ArrowArray>();
+        schema->release = nullptr;
+        array->release = nullptr;
+        {
+          py::gil_scoped_release release;
+          to_arrow(var, *array, *schema);
+        }
+        py::capsule schema_capsule(schema.get(), schema_capsule_name,
+                                   release_capsule<ArrowSchema>);
+        schema.release();
+        py::capsule array_capsule(array.get(), array_capsule_name,
+                                  release_capsule<ArrowArray>);
+        array.release();
+        return py::make_tuple(schema_capsule, array_capsule);
+      },
+      py::arg("var"));
+
+  m.def(
+      "_from_arrow_c_array",
+      [](const py::capsule &schema_capsule, const py::capsule &array_capsule) {
+        const auto &schema = *capsule_pointer<ArrowSchema>(
+            schema_capsule.ptr(), schema_capsule_name);
+        auto &array = *capsule_pointer<ArrowArray>(array_capsule.ptr(),
+                                                   array_capsule_name);
+        py::gil_scoped_release release;
+        return from_arrow(array, schema);
+      },
+      py::arg("schema"), py::arg("array"));
+}
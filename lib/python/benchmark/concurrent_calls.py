@@ -0,0 +1,51 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+# @file
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+import scipp as sc
+
+
+def run_concurrently(func, tables, n_threads):
+    """
+    Call func on all tables using a pool of n_threads Python threads.
+    Since the bindings release the GIL the calls should run concurrently, such
+    that the throughput scales with the number of threads.
+    """
+    with ThreadPoolExecutor(max_workers=n_threads) as executor:
+        start_time = time.perf_counter()
+        for _ in executor.map(func, tables):
+            pass
+        return time.perf_counter() - start_time
+
+
+def benchmark(name, func, n_tables, n_events, num_threads=1):
+    # By default use single-threaded calls in C++, such that speedups can only
+    # come from concurrent Python threads. These run on the calling thread
+    # instead of entering a shared task arena, which would serialize them.
+    sc.set_num_threads(num_threads)
+    tables = [sc.data.table_xyz(n_events) for _ in range(n_tables)]
+    baseline = None
+    for n_threads in [1, 2, 4, 8]:
+        total_time = run_concurrently(func, tables, n_threads)
+        baseline = total_time if baseline is None else baseline
+        print(
+            name, {
+                'num_threads': sc.get_num_threads(),
+                'n_threads': n_threads,
+                'n_calls': n_tables,
+                'n_events': n_events,
+                'total_time': total_time,
+                'calls_per_second': n_tables / total_time,
+                'speedup': baseline / total_time,
+            })
+    sc.set_num_threads()
+
+
+if __name__ == '__main__':
+    for n_events in [100_000, 1_000_000]:
+        benchmark('bin', lambda table: table.bin(x=100, y=100), 32, n_events)
+        benchmark('hist', lambda table: table.hist(x=100, y=100), 32, n_events)
+    # For comparison, concurrent calls that are also multi-threaded in C++.
+    benchmark('bin', lambda table: table.bin(x=100, y=100), 32, 1_000_000, None)
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#include "scipp/dataset/binary_io.h"
+
+#include "pybind11.h"
+
+using namespace scipp;
+using namespace scipp::dataset;
+
+namespace py = pybind11;
+
+namespace {
+template <class T> void bind_save(py::module &m) {
+  m.def(
+      "_save",
+      [](const T &obj, const std::string &filename) {
+        binary_io::write(filename, obj);
+      },
+      py::arg("obj"), py::arg("filename"),
+      py::call_guard<py::gil_scoped_release>());
+}
+
+template <class T>
+py::object load(const std::string &filename, const binary_io::ReadMode mode) {
+  T out;
+  {
+    py::gil_scoped_release release;
+    if constexpr (std::is_same_v<T, Variable>)
+      out = binary_io::read_variable(filename, mode);
+    else if constexpr (std::is_same_v<T, DataArray>)
+      out = binary_io::read_data_array(filename, mode);
+    else
+      out = binary_io::read_dataset(filename, mode);
+  }
+  return py::cast(std::move(out));
+}
+} // namespace
+
+void init_binary_io(py::module &m) {
+  bind_save<Variable>(m);
+  bind_save<DataArray>(m);
+  bind_save<Dataset>(m);
+
+  m.def(
+      "_load",
+      [](const std::string &filename, const bool mmap) -> py::object {
+        const auto mode = mmap ? binary_io::ReadMode::Map
+                               : binary_io::ReadMode::Read;
+        const auto type = [&filename]() {
+          py::gil_scoped_release release;
+          return binary_io::object_type(filename);
+        }();
+        if (type == "Variable")
+          return load<Variable>(filename, mode);
+        if (type == "DataArray")
+          return load<DataArray>(filename, mode);
+        return load<Dataset>(filename, mode);
+      },
+      py::arg("filename"), py::arg("mmap") = true);
+}
@@ -13,6 +13,7 @@
 #include "scipp/core/tag_util.h"
 #include "scipp/dataset/dataset.h"
 #include "scipp/dataset/except.h"
+#include "scipp/variable/astype.h"
 #include "scipp/variable/shape.h"
 #include "scipp/variable/variable.h"
 #include "scipp/variable/variable_concept.h"
@@ -95,6 +96,8 @@ class DataAccessHelper {
       // no automatic move because of type mismatch
       return py::object{std::move(array)};
     } else {
+      // The array may be modified at any time, without notifying scipp.
+      var.data().property_cache().disable();
       return py::array{get_dtype(), dims.shape(),
                        numpy_strides<T>(var.strides()),
                        Getter::template get<T>(view).data(),
@@ -115,6 +118,17 @@ class DataAccessHelper {
   };
 };
 
+/// Assign `strings` to a variable of dtype categorical_string.
+///
+/// Codes refer to the dictionaries of the target, so they cannot be created
+/// from Python objects directly. Encoding via `astype` and copying makes the
+/// target share the new dictionary.
+template <class View>
+void assign_categorical(View &view, const Variable &strings) {
+  auto var = get_data_variable(view);
+  copy(astype(strings, dtype<scipp::core::categorical_string>), var);
+}
+
 inline void expect_scalar(const Dimensions &dims, const std::string_view name) {
   if (dims != Dimensions{}) {
     std::ostringstream oss;
@@ -144,10 +158,28 @@ template <class... Ts> class as_ElementArrayViewImpl {
         return {Getter::template get<int64_t>(view)};
       if (type == dtype<int32_t>)
         return {Getter::template get<int32_t>(view)};
+      if (type == dtype<int16_t>)
+        return {Getter::template get<int16_t>(view)};
+      if (type == dtype<int8_t>)
+        return {Getter::template get<int8_t>(view)};
+      if (type == dtype<uint64_t>)
+        return {Getter::template get<uint64_t>(view)};
+      if (type == dtype<uint32_t>)
+        return {Getter::template get<uint32_t>(view)};
+      if (type == dtype<uint16_t>)
+        return {Getter::template get<uint16_t>(view)};
+      if (type == dtype<uint8_t>)
+        return {Getter::template get<uint8_t>(view)};
+      if (type == dtype<scipp::core::float16>)
+        return {Getter::template get<scipp::core::float16>(view)};
       if (type == dtype<bool>)
         return {Getter::template get<bool>(view)};
       if (type == dtype<std::string>)
         return {Getter::template get<std::string>(view)};
+      if (type == dtype<scipp::core::categorical_string>)
+        return {Getter::template get<scipp::core::categorical_string>(view)};
+      if (type == dtype<std::string_view>)
+        return {Getter::template get<std::string_view>(view)};
       if (type == dtype<scipp::core::time_point>)
         return {Getter::template get<scipp::core::time_point>(view)};
       if (type == dtype<Variable>)
@@ -239,6 +271,21 @@ public:
       return DataAccessHelper::as_py_array_t_impl<Getter, int64_t>(view);
     if (type == dtype<int32_t>)
       return DataAccessHelper::as_py_array_t_impl<Getter, int32_t>(view);
+    if (type == dtype<int16_t>)
+      return DataAccessHelper::as_py_array_t_impl<Getter, int16_t>(view);
+    if (type == dtype<int8_t>)
+      return DataAccessHelper::as_py_array_t_impl<Getter, int8_t>(view);
+    if (type == dtype<uint64_t>)
+      return DataAccessHelper::as_py_array_t_impl<Getter, uint64_t>(view);
+    if (type == dtype<uint32_t>)
+      return DataAccessHelper::as_py_array_t_impl<Getter, uint32_t>(view);
+    if (type == dtype<uint16_t>)
+      return DataAccessHelper::as_py_array_t_impl<Getter, uint16_t>(view);
+    if (type == dtype<uint8_t>)
+      return DataAccessHelper::as_py_array_t_impl<Getter, uint8_t>(view);
+    if (type == dtype<scipp::core::float16>)
+      return DataAccessHelper::as_py_array_t_impl<Getter,
+                                                  scipp::core::float16>(view);
     if (type == dtype<bool>)
       return DataAccessHelper::as_py_array_t_impl<Getter, bool>(view);
     if (type == dtype<scipp::core::time_point>)
@@ -288,6 +335,10 @@ public:
     if (is_structured(view.dtype())) {
       auto elems = structure_elements(view);
       set_values(elems, obj);
+    } else if (view.dtype() == dtype<scipp::core::categorical_string>) {
+      auto strings = makeVariable<std::string>(view.dims(), view.unit());
+      set_values(strings, obj);
+      assign_categorical(view, strings);
     } else {
       set(view.dims(), view.unit(), get<get_values>(view), obj);
     }
@@ -318,6 +369,10 @@ private:
           py::module::import("numpy").attr("datetime64");
       return np_datetime64(scalar.time_since_epoch(),
                            to_numpy_time_string(view.unit()));
+    } else if constexpr (std::is_same_v<std::decay_t<Scalar>,
+                                        core::float16>) {
+      // No pybind11 caster, return a Python float like numpy.float16.item().
+      return py::object{py::float_(static_cast<float>(scalar))};
     } else if constexpr (!std::is_reference_v<Scalar>) {
       // Views such as slices of data arrays for binned data are
       // returned by value and require separate handling to avoid the
@@ -362,7 +417,17 @@ private:
               "Conversion of time units is not implemented.");
         }
         data[0] = make_time_point(rhs.template cast<py::buffer>());
-      } else
+      } else if constexpr (std::is_same_v<T, scipp::core::float16>)
+        data[0] = T(rhs.cast<float>());
+      else if constexpr (std::is_same_v<T, std::string_view>)
+        // The characters are owned by the variable and cannot be replaced.
+        throw std::invalid_argument(
+            "Elements of dtype string_view are read-only, use "
+            "astype(sc.DType.string) to modify them.");
+      else if constexpr (std::is_same_v<T, scipp::core::categorical_string>)
+        assign_categorical(view, makeVariable<std::string>(
+                                     Values{rhs.cast<std::string>()}));
+      else
         data[0] = rhs.cast<T>();
     }
   };
@@ -418,7 +483,9 @@ using as_ElementArrayView = as_ElementArrayViewImpl<
     double, float, int64_t, int32_t, bool, std::string, scipp::core::time_point,
     Variable, DataArray, Dataset, bucket<Variable>, bucket<DataArray>,
     bucket<Dataset>, Eigen::Vector3d, Eigen::Matrix3d, scipp::python::PyObject,
-    Eigen::Affine3d, scipp::core::Quaternion, scipp::core::Translation>;
+    Eigen::Affine3d, scipp::core::Quaternion, scipp::core::Translation, int16_t,
+    int8_t, uint64_t, uint32_t, uint16_t, uint8_t, scipp::core::float16,
+    scipp::core::categorical_string, std::string_view>;
 
 template <class T, class... Ignored>
 void bind_common_data_properties(pybind11::class_<T, Ignored...> &c) {
@@ -27,7 +27,9 @@ namespace py = pybind11;
 
 template <class T, class... Ignored>
 void bind_common_operators(pybind11::class_<T, Ignored...> &c) {
-  c.def("__abs__", [](const T &self) { return abs(self); });
+  c.def(
+      "__abs__", [](const T &self) { return abs(self); },
+      py::call_guard<py::gil_scoped_release>());
   c.def("__repr__", [](const T &self) { return to_string(self); });
   c.def("__bool__", [](const T &self) {
     if constexpr (std::is_same_v<T, scipp::Variable>) {
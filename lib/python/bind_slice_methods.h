@@ -131,26 +131,33 @@ template <class T> struct slicer {
   }
 
   static void set_from_numpy(T &&slice, const py::object &obj) {
-    core::CallDType<double, float, int64_t, int32_t,
-                    bool>::apply<SetData<T>::template Impl>(slice.dtype(),
-                                                            slice, obj);
+    core::CallDType<double, float, int64_t, int32_t, bool, int16_t, int8_t,
+                    uint64_t, uint32_t, uint16_t, uint8_t,
+                    scipp::core::float16>::apply<SetData<T>::template Impl>(
+        slice.dtype(), slice, obj);
   }
 
   template <class Other>
   static void set_from_view(T &self, const std::tuple<Dim, scipp::index> &index,
                             const Other &data) {
-    self.setSlice(get_slice(self, index), data);
+    const auto slice = get_slice(self, index);
+    py::gil_scoped_release release;
+    self.setSlice(slice, data);
   }
 
   template <class Other>
   static void set_from_view(T &self,
                             const std::tuple<Dim, const py::slice> &index,
                             const Other &data) {
-    self.setSlice(get_slice_range(self, index), data);
+    // Computing the range from the py::slice requires the GIL.
+    const auto slice = get_slice_range(self, index);
+    py::gil_scoped_release release;
+    self.setSlice(slice, data);
   }
 
   template <class Other>
   static void set_from_view(T &self, const py::ellipsis &, const Other &data) {
+    py::gil_scoped_release release;
     self.setSlice(Slice{}, data);
   }
 
@@ -295,13 +302,18 @@ void bind_slice_methods(pybind11::class_<T, Ignored...> &c) {
   // the objection to this is not absolute (unlike in the case of slicing outer
   // dimension above).
   if constexpr (std::is_same_v<T, DataArray>) {
-    c.def("__getitem__", &slicer<T>::get_by_value);
-    c.def("__setitem__", &slicer<T>::template set_by_value<Variable>);
-    c.def("__setitem__", &slicer<T>::template set_by_value<DataArray>);
+    c.def("__getitem__", &slicer<T>::get_by_value,
+          py::call_guard<py::gil_scoped_release>());
+    c.def("__setitem__", &slicer<T>::template set_by_value<Variable>,
+          py::call_guard<py::gil_scoped_release>());
+    c.def("__setitem__", &slicer<T>::template set_by_value<DataArray>,
+          py::call_guard<py::gil_scoped_release>());
   }
   if constexpr (std::is_same_v<T, Dataset>) {
-    c.def("__getitem__", &slicer<T>::get_by_value);
-    c.def("__setitem__", &slicer<T>::template set_by_value<Dataset>);
+    c.def("__getitem__", &slicer<T>::get_by_value,
+          py::call_guard<py::gil_scoped_release>());
+    c.def("__setitem__", &slicer<T>::template set_by_value<Dataset>,
+          py::call_guard<py::gil_scoped_release>());
   } else {
     c.def("__len__", [](const T &self) {
       if (self.dims().ndim() == 0)
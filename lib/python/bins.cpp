@@ -61,16 +61,20 @@ template <class T> void bind_bins(pybind11::module &m) {
       [](const std::optional<Variable> &begin,
          const std::optional<Variable> &end, const std::string &dim,
          const T &data) {
+        // Release GIL only in the functor since implicit conversions of the
+        // arguments may need it.
+        py::gil_scoped_release release;
         return call_make_bins(begin, end, Dim{dim}, T(data));
       },
       py::arg("begin") = py::none(), py::arg("end") = py::none(),
-      py::arg("dim"), py::arg("data")); // do not release GIL since using
-                                        // implicit conversions in functor
+      py::arg("dim"), py::arg("data"));
 }
 
 template <class T> py::dict bins_constituents(const Variable &var) {
+  py::gil_scoped_release release;
   auto &&[indices, dim, buffer] = var.constituents<T>();
   auto &&[begin, end] = unzip(indices);
+  py::gil_scoped_acquire acquire;
   py::dict out;
   out["begin"] = std::forward<decltype(begin)>(begin);
   out["end"] = std::forward<decltype(end)>(end);
@@ -110,15 +114,19 @@ auto bins_like(const Variable &bins, const Data &data) {
 }
 
 template <class Data> void bind_bins_like(py::module &m) {
-  m.def("bins_like", [](const Variable &bins, const Data &data) {
-    if (bins.dtype() == dtype<bucket<Variable>>)
-      return bins_like<Variable>(bins, data);
-    if (bins.dtype() == dtype<bucket<DataArray>>)
-      return bins_like<DataArray>(bins, data);
-    throw except::TypeError(
-        "In `bins_like`: Prototype must contain binned data but got dtype=" +
-        to_string(bins.dtype()));
-  });
+  m.def(
+      "bins_like",
+      [](const Variable &bins, const Data &data) {
+        if (bins.dtype() == dtype<bucket<Variable>>)
+          return bins_like<Variable>(bins, data);
+        if (bins.dtype() == dtype<bucket<DataArray>>)
+          return bins_like<DataArray>(bins, data);
+        throw except::TypeError(
+            "In `bins_like`: Prototype must contain binned data but got "
+            "dtype=" +
+            to_string(bins.dtype()));
+      },
+      py::call_guard<py::gil_scoped_release>());
 }
 
 } // namespace
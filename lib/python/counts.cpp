@@ -17,26 +17,26 @@ void init_counts(py::module &m) {
       [](const Dataset &d, const std::string &dim) {
         return counts::toDensity(d, Dim{dim});
       },
-      py::arg("x"), py::arg("dim"));
+      py::arg("x"), py::arg("dim"), py::call_guard<py::gil_scoped_release>());
 
   m.def(
       "counts_to_density",
       [](const DataArray &d, const std::string &dim) {
         return counts::toDensity(d, Dim{dim});
       },
-      py::arg("x"), py::arg("dim"));
+      py::arg("x"), py::arg("dim"), py::call_guard<py::gil_scoped_release>());
 
   m.def(
       "density_to_counts",
       [](const Dataset &d, const std::string &dim) {
         return counts::fromDensity(d, Dim{dim});
       },
-      py::arg("x"), py::arg("dim"));
+      py::arg("x"), py::arg("dim"), py::call_guard<py::gil_scoped_release>());
 
   m.def(
       "density_to_counts",
       [](const DataArray &d, const std::string &dim) {
         return counts::fromDensity(d, Dim{dim});
       },
-      py::arg("x"), py::arg("dim"));
+      py::arg("x"), py::arg("dim"), py::call_guard<py::gil_scoped_release>());
 }
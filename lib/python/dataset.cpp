@@ -108,7 +108,7 @@ template <class T> void bind_rebin(py::module &m) {
 }
 
 template <class Key, class Value> auto to_cpp_map(const py::dict &dict) {
-  std::unordered_map<Key, Value> out;
+  typename Dict<Key, Value>::holder_type out;
   for (const auto &[key, val] : dict) {
     out.emplace(key.template cast<std::string>(), val.template cast<Value &>());
   }
@@ -210,11 +210,13 @@ Returned by :py:func:`DataArray.masks`)");
       .def("__setitem__",
            [](Dataset &self, const std::string &name, const Variable &data) {
              self.setData(name, data);
-           })
+           },
+           py::call_guard<py::gil_scoped_release>())
       .def("__setitem__",
            [](Dataset &self, const std::string &name, const DataArray &data) {
              self.setData(name, data);
-           })
+           },
+           py::call_guard<py::gil_scoped_release>())
       .def("__delitem__", &Dataset::erase,
            py::call_guard<py::gil_scoped_release>())
       .def("clear", &Dataset::clear,
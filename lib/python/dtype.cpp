@@ -25,6 +25,7 @@ namespace {
 enum class DTypeKind : char {
   Float = 'f',
   Int = 'i',
+  UInt = 'u',
   Bool = 'b',
   Datetime = 'M',
   Object = 'O',
@@ -39,8 +40,11 @@ constexpr bool operator==(const char a, const DTypeKind b) {
 enum class DTypeSize : scipp::index {
   Float64 = 8,
   Float32 = 4,
+  Float16 = 2,
   Int64 = 8,
   Int32 = 4,
+  Int16 = 2,
+  Int8 = 1,
 };
 
 constexpr bool operator==(const scipp::index a, const DTypeSize b) {
@@ -70,11 +74,20 @@ objects containing binned data. They cannot be used directly to create arrays of
   // types that are for internal use only and are never returned to Python.
   for (const auto &t : {
            dtype<bool>,
+           dtype<int8_t>,
+           dtype<int16_t>,
            dtype<int32_t>,
            dtype<int64_t>,
+           dtype<uint8_t>,
+           dtype<uint16_t>,
+           dtype<uint32_t>,
+           dtype<uint64_t>,
+           dtype<core::float16>,
            dtype<float>,
            dtype<double>,
            dtype<std::string>,
+           dtype<core::categorical_string>,
+           dtype<std::string_view>,
            dtype<Eigen::Vector3d>,
            dtype<Eigen::Matrix3d>,
            dtype<Eigen::Affine3d>,
@@ -126,12 +139,28 @@ scipp::core::DType scipp_dtype(const py::dtype &type) {
       return scipp::core::dtype<double>;
     if (type.itemsize() == DTypeSize::Float32)
       return scipp::core::dtype<float>;
+    if (type.itemsize() == DTypeSize::Float16)
+      return scipp::core::dtype<scipp::core::float16>;
   }
   if (type.kind() == DTypeKind::Int) {
     if (type.itemsize() == DTypeSize::Int64)
       return scipp::core::dtype<std::int64_t>;
     if (type.itemsize() == DTypeSize::Int32)
       return scipp::core::dtype<std::int32_t>;
+    if (type.itemsize() == DTypeSize::Int16)
+      return scipp::core::dtype<std::int16_t>;
+    if (type.itemsize() == DTypeSize::Int8)
+      return scipp::core::dtype<std::int8_t>;
+  }
+  if (type.kind() == DTypeKind::UInt) {
+    if (type.itemsize() == DTypeSize::Int64)
+      return scipp::core::dtype<std::uint64_t>;
+    if (type.itemsize() == DTypeSize::Int32)
+      return scipp::core::dtype<std::uint32_t>;
+    if (type.itemsize() == DTypeSize::Int16)
+      return scipp::core::dtype<std::uint16_t>;
+    if (type.itemsize() == DTypeSize::Int8)
+      return scipp::core::dtype<std::uint8_t>;
   }
   if (type.kind() == DTypeKind::Bool)
     return scipp::core::dtype<bool>;
@@ -147,8 +176,9 @@ scipp::core::DType scipp_dtype(const py::dtype &type) {
       "Unsupported numpy dtype: " +
       py::str(static_cast<py::handle>(type)).cast<std::string>() +
       "\n"
-      "Supported types are: bool, float32, float64,"
-      " int32, int64, string, datetime64, and object");
+      "Supported types are: bool, float16, float32, float64, int8, int16,"
+      " int32, int64, uint8, uint16, uint32, uint64, string, datetime64, and"
+      " object");
 }
 
 scipp::core::DType scipp_dtype(const py::object &type) {
@@ -204,7 +234,8 @@ void ensure_conversion_possible(const DType from, const DType to,
                                 const std::string &data_name) {
   if (from == to || (core::is_fundamental(from) && core::is_fundamental(to)) ||
       to == dtype<python::PyObject> ||
-      (core::is_int(from) && to == dtype<core::time_point>)) {
+      (core::is_int(from) && to == dtype<core::time_point>) ||
+      (from == dtype<std::string> && to == dtype<core::categorical_string>)) {
     return; // These are allowed.
   }
   throw std::invalid_argument(python::format("Cannot convert ", data_name,
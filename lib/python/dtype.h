@@ -45,6 +45,13 @@ struct converting_cast<T, std::enable_if_t<std::is_integral_v<T>>> {
   }
 };
 
+template <> struct converting_cast<scipp::core::float16> {
+  static scipp::core::float16 cast(const pybind11::object &obj) {
+    // There is no pybind11 caster for float16, go through float.
+    return scipp::core::float16(obj.cast<float>());
+  }
+};
+
 scipp::core::DType
 common_dtype(const pybind11::object &values, const pybind11::object &variances,
              scipp::core::DType dtype,
@@ -60,11 +60,22 @@ void declare_ElementArrayView(py::module &m, const std::string &suffix) {
       else
         to_python_object(self[i]) = value;
     });
+  } else if constexpr (std::is_same_v<std::remove_const_t<T>,
+                                      categorical_string>) {
+    // Codes refer to the dictionaries of the variable, which are not
+    // accessible from the view.
+    view.def("__setitem__", [](ElementArrayView<T> &, const scipp::index,
+                               const py::object &) {
+      throw std::invalid_argument(
+          "Elements of dtype categorical_string cannot be assigned "
+          "individually, assign to 'values' instead.");
+    });
   } else {
     view.def("__setitem__", [](ElementArrayView<T> &self,
                                [[maybe_unused]] const scipp::index i,
                                [[maybe_unused]] const T &value) {
-      if constexpr (is_bins<T>::value || std::is_const_v<T>)
+      if constexpr (is_bins<T>::value || std::is_const_v<T> ||
+                    std::is_same_v<T, std::string_view>)
         throw std::invalid_argument("assignment destination is read-only");
       else
         self[i] = value;
@@ -78,6 +89,8 @@ void init_element_array_view(py::module &m) {
   declare_ElementArrayView<int64_t>(m, "int64");
   declare_ElementArrayView<int32_t>(m, "int32");
   declare_ElementArrayView<std::string>(m, "string");
+  declare_ElementArrayView<categorical_string>(m, "categorical_string");
+  declare_ElementArrayView<std::string_view>(m, "string_view");
   declare_ElementArrayView<bool>(m, "bool");
   declare_ElementArrayView<Variable>(m, "Variable");
   declare_ElementArrayView<DataArray>(m, "DataArray");
@@ -94,6 +107,9 @@ void init_element_array_view(py::module &m) {
   declare_ElementArrayView<const int64_t>(m, "int64_const");
   declare_ElementArrayView<const int32_t>(m, "int32_const");
   declare_ElementArrayView<const std::string>(m, "string_const");
+  declare_ElementArrayView<const categorical_string>(
+      m, "categorical_string_const");
+  declare_ElementArrayView<const std::string_view>(m, "string_view_const");
   declare_ElementArrayView<const bool>(m, "bool_const");
   declare_ElementArrayView<const Variable>(m, "Variable_const");
   declare_ElementArrayView<const DataArray>(m, "DataArray_const");
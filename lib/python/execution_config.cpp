@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include "pybind11.h"
+
+#include "scipp/core/execution_config.h"
+
+using namespace scipp;
+
+namespace py = pybind11;
+
+void init_execution_config(py::module &m) {
+  m.def("get_num_threads", &core::parallel::max_threads);
+  m.def("set_num_threads", &core::parallel::set_max_threads, py::arg("n"));
+}
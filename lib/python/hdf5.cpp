@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <map>
+#include <optional>
+
+#include "scipp/dataset/hdf5.h"
+#include "scipp/dataset/slice.h"
+#include "scipp/variable/shape.h"
+
+#include "pybind11.h"
+
+using namespace scipp;
+using namespace scipp::dataset;
+
+namespace py = pybind11;
+
+namespace {
+
+hdf5::WriteOptions
+make_options(const std::optional<std::string> &compression,
+             const std::optional<int> &compression_opts, const bool shuffle,
+             const std::optional<scipp::index> &chunk_bytes) {
+  hdf5::WriteOptions options;
+  if (compression) {
+    if (*compression != "gzip")
+      throw std::invalid_argument("Unsupported compression '" + *compression +
+                                  "', only 'gzip' is supported.");
+    options.compression = hdf5::Compression::Gzip;
+  }
+  if (compression_opts)
+    options.compression_level = *compression_opts;
+  options.shuffle = shuffle;
+  options.chunk_bytes = chunk_bytes.value_or(0);
+  return options;
+}
+
+/// Slices given as (dim, begin, end), end is None for point slices.
+using PySlices = std::vector<
+    std::tuple<std::string, scipp::index, std::optional<scipp::index>>>;
+
+std::vector<Slice> to_slices(const PySlices &slices) {
+  std::vector<Slice> out;
+  for (const auto &[dim, begin, end] : slices)
+    out.push_back(end ? Slice(Dim(dim), begin, *end) : Slice(Dim(dim), begin));
+  return out;
+}
+
+/// Return a data array without data with the sizes of the object stored in
+/// `filename` after applying `slices`, and the coord `dim` if it exists.
+DataArray coord_only(const std::string &filename, const Dim dim,
+                     const std::vector<Slice> &slices) {
+  auto sizes = hdf5::sizes(filename);
+  for (const auto &slice : slices)
+    sizes = sizes.slice(slice);
+  DataArray out(broadcast(makeVariable<int32_t>(Values{0}),
+                          Dimensions(sizes.labels(), sizes.sizes())));
+  try {
+    out.coords().set(dim, hdf5::read_coord(filename, dim, slices));
+  } catch (const except::NotFoundError &) {
+    // get_slice_params reports the missing coord.
+  }
+  return out;
+}
+
+template <class T> void bind_to_hdf5(py::module &m) {
+  m.def(
+      "_to_hdf5",
+      [](const T &obj, const std::string &filename,
+         const std::optional<std::string> &compression,
+         const std::optional<int> &compression_opts, const bool shuffle,
+         const std::optional<scipp::index> &chunk_bytes) {
+        const auto options =
+            make_options(compression, compression_opts, shuffle, chunk_bytes);
+        py::gil_scoped_release release;
+        hdf5::write(filename, obj, options);
+      },
+      py::arg("obj"), py::arg("filename"), py::arg("compression") = py::none(),
+      py::arg("compression_opts") = py::none(), py::arg("shuffle") = false,
+      py::arg("chunk_bytes") = py::none());
+}
+} // namespace
+
+void init_hdf5(py::module &m) {
+  bind_to_hdf5<Variable>(m);
+  bind_to_hdf5<DataArray>(m);
+  bind_to_hdf5<Dataset>(m);
+
+  m.def(
+      "_hdf5_sizes",
+      [](const std::string &filename) {
+        std::map<std::string, scipp::index> out;
+        const auto sizes = hdf5::sizes(filename);
+        for (const auto &dim : sizes)
+          out.emplace(dim.name(), sizes[dim]);
+        return out;
+      },
+      py::arg("filename"));
+
+  m.def("_hdf5_object_type", &hdf5::object_type, py::arg("filename"),
+        py::call_guard<py::gil_scoped_release>());
+
+  m.def(
+      "_open_hdf5",
+      [](const std::string &filename, const PySlices &slices) -> py::object {
+        const auto s = to_slices(slices);
+        const auto type = hdf5::object_type(filename);
+        if (type == "Variable") {
+          py::gil_scoped_release release;
+          auto out = hdf5::read_variable(filename, s);
+          py::gil_scoped_acquire acquire;
+          return py::cast(std::move(out));
+        }
+        if (type == "DataArray") {
+          py::gil_scoped_release release;
+          auto out = hdf5::read_data_array(filename, s);
+          py::gil_scoped_acquire acquire;
+          return py::cast(std::move(out));
+        }
+        py::gil_scoped_release release;
+        auto out = hdf5::read_dataset(filename, s);
+        py::gil_scoped_acquire acquire;
+        return py::cast(std::move(out));
+      },
+      py::arg("filename"), py::arg("slices"));
+
+  // Label-based slicing of objects in files. Only the coord is read.
+  m.def(
+      "_hdf5_slice_params",
+      [](const std::string &filename, const PySlices &slices,
+         const std::string &dim, const Variable &value) {
+        const auto [d, index] = get_slice_params(
+            coord_only(filename, Dim(dim), to_slices(slices)), Dim(dim),
+            value);
+        return std::tuple{d.name(), index};
+      },
+      py::arg("filename"), py::arg("slices"), py::arg("dim"), py::arg("value"),
+      py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "_hdf5_slice_params",
+      [](const std::string &filename, const PySlices &slices,
+         const std::string &dim, const std::optional<Variable> &begin,
+         const std::optional<Variable> &end) {
+        const auto [d, first, last] = get_slice_params(
+            coord_only(filename, Dim(dim), to_slices(slices)), Dim(dim),
+            begin.value_or(Variable{}), end.value_or(Variable{}));
+        return std::tuple{d.name(), first, last};
+      },
+      py::arg("filename"), py::arg("slices"), py::arg("dim"), py::arg("begin"),
+      py::arg("end"), py::call_guard<py::gil_scoped_release>());
+}
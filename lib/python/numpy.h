@@ -5,10 +5,14 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
 #include <functional>
 
+#include <boost/container/small_vector.hpp>
+
 #include "scipp/common/index_composition.h"
 #include "scipp/core/parallel.h"
+#include "scipp/core/strides.h"
 #include "scipp/variable/variable.h"
 
 #include "py_object.h"
@@ -61,8 +65,13 @@ auto cast_to_array_like(const py::object &obj, const units::Unit unit) {
     // pbj.cast<py::array_t<PyType> does not always work because
     // numpy.datetime64.__int__ delegates to datetime.datetime if the unit is
     // larger than ns and that cannot be converted to long.
-    return obj.cast<py::array>()
-        .attr("astype")(py::dtype::of<PyType>())
+    const auto array = obj.cast<py::array>();
+    // datetime64 is stored as int64, reinterpret instead of copying. The unit
+    // has been checked by check_assignable.
+    if (array.dtype().attr("kind").template cast<char>() == 'M')
+      return array.attr("view")(py::dtype::of<PyType>())
+          .template cast<py::array_t<PyType>>();
+    return array.attr("astype")(py::dtype::of<PyType>())
         .template cast<py::array_t<PyType>>();
   } else if constexpr (std::is_standard_layout_v<T> && std::is_trivial_v<T>) {
     // Casting to py::array_t applies all sorts of automatic conversions
@@ -85,54 +94,113 @@ auto cast_to_array_like(const py::object &obj, const units::Unit unit) {
   }
 }
 
-template <bool convert, class T, class View>
-void copy_flattened_0d(const py::array_t<T> &data, View &&view) {
-  auto r = data.unchecked();
-  auto it = view.begin();
-  copy_element<convert>(r(), *it);
+/// Copy `size` elements from `src` with a stride of `src_stride` bytes into
+/// `dst` with a stride of `dst_stride` elements.
+template <bool convert, class Src, class Dst>
+void copy_run(const std::byte *src, const scipp::index src_stride, Dst *dst,
+              const scipp::index dst_stride, const scipp::index size) {
+  if (src_stride == scipp::index(sizeof(Src)) && dst_stride == 1) {
+    if constexpr (!convert && std::is_same_v<Src, Dst>) {
+      std::memcpy(dst, src, size * sizeof(Src));
+    } else {
+      // Plain loop over contiguous memory, which the compiler can vectorize
+      // for cheap conversions such as int64 to time_point.
+      const auto *s = reinterpret_cast<const Src *>(src);
+      for (scipp::index i = 0; i < size; ++i)
+        copy_element<convert>(s[i], dst[i]);
+    }
+  } else {
+    for (scipp::index i = 0; i < size; ++i)
+      copy_element<convert>(
+          *reinterpret_cast<const Src *>(src + i * src_stride),
+          dst[i * dst_stride]);
+  }
 }
 
-template <bool convert, class T, class View>
-void copy_flattened_1d(const py::array_t<T> &data, View &&view) {
-  auto r = data.unchecked();
-  auto it = view.begin();
-  for (scipp::index i = 0; i < r.shape(0); ++i, ++it) {
-    copy_element<convert>(r(i), *it);
+/// Copy an N-d array with `shape` from `src` into `dst`.
+///
+/// Strides of `src` are given in bytes as in numpy, strides of `dst` in
+/// elements. Dims of length 1 are dropped and dims that are contiguous in both
+/// `src` and `dst` are merged, such that contiguous inputs are copied as a
+/// single run. The flat range of elements is split into tasks, so both many
+/// short runs and few long runs are copied in parallel.
+template <bool convert, class Src, class Dst>
+void copy_strided(const std::byte *src,
+                  const scipp::span<const scipp::index> src_strides, Dst *dst,
+                  const scipp::span<const scipp::index> dst_strides,
+                  const scipp::span<const scipp::index> shape) {
+  using small_vector =
+      boost::container::small_vector<scipp::index, core::NDIM_STACK>;
+  small_vector sh;
+  small_vector s;
+  small_vector d;
+  for (scipp::index dim = 0; dim < scipp::size(shape); ++dim) {
+    if (shape[dim] == 0)
+      return;
+    if (shape[dim] == 1)
+      continue;
+    if (!sh.empty() && s.back() == src_strides[dim] * shape[dim] &&
+        d.back() == dst_strides[dim] * shape[dim]) {
+      sh.back() *= shape[dim];
+      s.back() = src_strides[dim];
+      d.back() = dst_strides[dim];
+    } else {
+      sh.push_back(shape[dim]);
+      s.push_back(src_strides[dim]);
+      d.push_back(dst_strides[dim]);
+    }
   }
-}
+  if (sh.empty())
+    return copy_element<convert>(*reinterpret_cast<const Src *>(src), *dst);
 
-template <bool convert, class T, class View>
-void copy_flattened_2d(const py::array_t<T> &data, View &&view) {
-  auto r = data.unchecked();
-  const auto begin = view.begin();
+  const auto ndim = scipp::size(sh);
+  scipp::index size = 1;
+  for (const auto n : sh)
+    size *= n;
+  const auto copy_range = [&](const scipp::index begin,
+                              const scipp::index end) {
+    small_vector pos(ndim, 0);
+    scipp::index src_offset = 0;
+    scipp::index dst_offset = 0;
+    for (auto dim = ndim - 1, flat = begin; dim >= 0; --dim) {
+      pos[dim] = flat % sh[dim];
+      flat /= sh[dim];
+      src_offset += pos[dim] * s[dim];
+      dst_offset += pos[dim] * d[dim];
+    }
+    for (auto i = begin; i < end;) {
+      const auto n = std::min(sh.back() - pos.back(), end - i);
+      copy_run<convert, Src>(src + src_offset, s.back(), dst + dst_offset,
+                             d.back(), n);
+      i += n;
+      pos.back() += n;
+      src_offset += n * s.back();
+      dst_offset += n * d.back();
+      for (auto dim = ndim - 1; dim > 0 && pos[dim] == sh[dim]; --dim) {
+        pos[dim] = 0;
+        ++pos[dim - 1];
+        src_offset += s[dim - 1] - sh[dim] * s[dim];
+        dst_offset += d[dim - 1] - sh[dim] * d[dim];
+      }
+    }
+  };
+  if (size <= core::parallel::min_items_per_task(sizeof(Dst)))
+    return copy_range(0, size);
   core::parallel::parallel_for(
-      core::parallel::blocked_range(0, r.shape(0)), [&](const auto &range) {
-        auto it = begin + range.begin() * r.shape(1);
-        for (scipp::index i = range.begin(); i < range.end(); ++i)
-          for (scipp::index j = 0; j < r.shape(1); ++j, ++it)
-            copy_element<convert>(r(i, j), *it);
-      });
+      core::parallel::blocked_range(
+          0, size, core::parallel::grainsize(size, sizeof(Dst))),
+      [&](const auto &range) { copy_range(range.begin(), range.end()); });
 }
 
-template <bool convert, class T, class View>
-void copy_flattened_3d(const py::array_t<T> &data, View &&view) {
-  auto r = data.unchecked();
-  auto it = view.begin();
-  for (scipp::index i = 0; i < r.shape(0); ++i)
-    for (scipp::index j = 0; j < r.shape(1); ++j)
-      for (scipp::index k = 0; k < r.shape(2); ++k, ++it)
-        copy_element<convert>(r(i, j, k), *it);
+/// First element and strides in elements of the destination of a copy.
+template <class T>
+auto strided_destination(element_array<T> &dst, const Dimensions &dims) {
+  return std::pair{dst.data(), core::Strides(dims)};
 }
 
-template <bool convert, class T, class View>
-void copy_flattened_4d(const py::array_t<T> &data, View &&view) {
-  auto r = data.unchecked();
-  auto it = view.begin();
-  for (scipp::index i = 0; i < r.shape(0); ++i)
-    for (scipp::index j = 0; j < r.shape(1); ++j)
-      for (scipp::index k = 0; k < r.shape(2); ++k)
-        for (scipp::index l = 0; l < r.shape(3); ++l, ++it)
-          copy_element<convert>(r(i, j, k, l), *it);
+template <class T>
+auto strided_destination(const ElementArrayView<T> &dst, const Dimensions &) {
+  return std::pair{dst.buffer() + dst.offset(), dst.strides()};
 }
 
 template <class T> auto memory_begin_end(const py::buffer_info &info) {
@@ -162,30 +230,26 @@ bool memory_overlaps(const py::array_t<T> &data, const View &view) {
 /// `dst` `convert == true`.
 /// Otherwise, elements in src are simply assigned to dst.
 template <bool convert, class T, class View>
-void copy_flattened(const py::array_t<T> &src, View &&dst) {
+void copy_flattened(const py::array_t<T> &src, View &&dst,
+                    const Dimensions &dims) {
   if (scipp::size(dst) != src.size())
     throw std::runtime_error(
         "Numpy data size does not match size of target object.");
-
-  const auto dispatch = [](const py::array_t<T> &src_, View &&dst_) {
-    switch (src_.ndim()) {
-    case 0:
-      return copy_flattened_0d<convert>(src_, std::forward<View>(dst_));
-    case 1:
-      return copy_flattened_1d<convert>(src_, std::forward<View>(dst_));
-    case 2:
-      return copy_flattened_2d<convert>(src_, std::forward<View>(dst_));
-    case 3:
-      return copy_flattened_3d<convert>(src_, std::forward<View>(dst_));
-    case 4:
-      return copy_flattened_4d<convert>(src_, std::forward<View>(dst_));
-    default:
-      throw std::runtime_error("Numpy array has more dimensions than supported "
-                               "in the current implementation.");
-    }
-  };
-  dispatch(memory_overlaps(src, dst) ? py::array_t<T>(src.request()) : src,
-           std::forward<View>(dst));
+  const auto source =
+      memory_overlaps(src, dst) ? py::array_t<T>(src.request()) : src;
+  const auto [data, strides] = strided_destination(dst, dims);
+  const std::vector<scipp::index> src_strides(
+      source.strides(), source.strides() + source.ndim());
+  const std::vector<scipp::index> shape(source.shape(),
+                                        source.shape() + source.ndim());
+  // The copy only accesses the buffers, which are kept alive by `source` and
+  // `dst`, so it can run without the GIL.
+  py::gil_scoped_release release;
+  copy_strided<convert, T>(reinterpret_cast<const std::byte *>(source.data()),
+                           src_strides, data,
+                           std::vector<scipp::index>(strides.begin(),
+                                                     strides.end()),
+                           shape);
 }
 
 template <class SourceDType, class Destination>
@@ -199,14 +263,16 @@ void copy_array_into_view(const py::array_t<SourceDType> &src,
                                  "object.");
   copy_flattened<ElementTypeMap<
       typename std::remove_reference_t<Destination>::value_type>::convert>(
-      src, std::forward<Destination>(dst));
+      src, std::forward<Destination>(dst), dims);
 }
 
 template <class SourceDType, class Destination>
-void copy_array_into_view(const std::vector<SourceDType> &src,
-                          Destination &&dst, const Dimensions &) {
+void copy_array_into_view(std::vector<SourceDType> src, Destination &&dst,
+                          const Dimensions &) {
   core::expect::sizeMatches(dst, src);
-  std::copy(begin(src), end(src), dst.begin());
+  // Elements are temporaries converted from Python, move to avoid copying,
+  // e.g., strings a second time.
+  std::move(begin(src), end(src), dst.begin());
 }
 
 core::time_point make_time_point(const py::buffer &buffer, int64_t scale = 1);
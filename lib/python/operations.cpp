@@ -74,10 +74,13 @@ void bind_allsorted(py::module &m) {
 }
 
 void bind_midpoints(py::module &m) {
-  m.def("midpoints", [](const Variable &var,
-                        const std::optional<std::string> &dim) {
-    return midpoints(var, dim.has_value() ? Dim{*dim} : std::optional<Dim>{});
-  });
+  m.def(
+      "midpoints",
+      [](const Variable &var, const std::optional<std::string> &dim) {
+        return midpoints(var,
+                         dim.has_value() ? Dim{*dim} : std::optional<Dim>{});
+      },
+      py::call_guard<py::gil_scoped_release>());
 }
 
 void init_operations(py::module &m) {
@@ -102,9 +105,11 @@ void init_operations(py::module &m) {
       py::call_guard<py::gil_scoped_release>());
   m.def("get_slice_params", [](const Variable &var, const Variable &coord,
                                const Variable &begin, const Variable &end) {
+    py::gil_scoped_release release;
     const auto [dim, start, stop] =
         get_slice_params(var.dims(), coord, begin, end);
-    // Do NOT release GIL since using py::slice
+    // Reacquire GIL since using py::slice
+    py::gil_scoped_acquire acquire;
     return std::tuple{dim.name(), py::slice(start, stop, 1)};
   });
 
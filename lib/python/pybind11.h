@@ -13,3 +13,40 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
+
+#include "scipp/core/categorical_string.h"
+#include "scipp/core/float16.h"
+
+namespace pybind11::detail {
+// numpy's half-precision type is not known to pybind11. Registering it here
+// enables py::array_t<float16> and py::dtype::of<float16>, so float16 takes
+// the same buffer-based path as other fundamental types.
+template <> struct npy_format_descriptor<scipp::core::float16> {
+  static constexpr auto name = _("float16");
+  static pybind11::dtype dtype() {
+    constexpr int NPY_HALF = 23;
+    return reinterpret_steal<pybind11::dtype>(
+        npy_api::get().PyArray_DescrFromType_(NPY_HALF));
+  }
+};
+
+// Dictionary-encoded strings are plain `str` in Python. Conversion from
+// Python is not supported since codes refer to the dictionary of a variable,
+// assignment is handled by bind_data_access.h instead.
+template <> struct type_caster<scipp::core::categorical_string> {
+  PYBIND11_TYPE_CASTER(scipp::core::categorical_string, _("str"));
+
+  bool load(handle, bool) { return false; }
+
+  static handle cast(const scipp::core::categorical_string &src,
+                     return_value_policy policy, handle parent) {
+    return make_caster<std::string>::cast(src.str(), policy, parent);
+  }
+};
+} // namespace pybind11::detail
+
+namespace pybind11 {
+template <> struct format_descriptor<scipp::core::float16> {
+  static std::string format() { return "e"; }
+};
+} // namespace pybind11
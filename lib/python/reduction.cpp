@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include "pybind11.h"
+
+#include "scipp/dataset/arg_reduction.h"
+#include "scipp/dataset/median.h"
+#include "scipp/variable/reduction.h"
+
+using namespace scipp;
+
+namespace py = pybind11;
+
+template <class T> void bind_median(py::module &m) {
+  m.def(
+      "median", [](const T &x) { return median(x); }, py::arg("x"),
+      py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "median",
+      [](const T &x, const std::string &dim) { return median(x, Dim{dim}); },
+      py::arg("x"), py::arg("dim"), py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "nanmedian", [](const T &x) { return nanmedian(x); }, py::arg("x"),
+      py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "nanmedian",
+      [](const T &x, const std::string &dim) {
+        return nanmedian(x, Dim{dim});
+      },
+      py::arg("x"), py::arg("dim"), py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "quantile", [](const T &x, const double q) { return quantile(x, q); },
+      py::arg("x"), py::arg("q"), py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "quantile",
+      [](const T &x, const double q, const std::string &dim) {
+        return quantile(x, q, Dim{dim});
+      },
+      py::arg("x"), py::arg("q"), py::arg("dim"),
+      py::call_guard<py::gil_scoped_release>());
+}
+
+template <class T> void bind_arg_reduction(py::module &m) {
+  m.def(
+      "argmin",
+      [](const T &x, const std::string &dim) { return argmin(x, Dim{dim}); },
+      py::arg("x"), py::arg("dim"), py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "argmax",
+      [](const T &x, const std::string &dim) { return argmax(x, Dim{dim}); },
+      py::arg("x"), py::arg("dim"), py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "topk",
+      [](const T &x, const scipp::index k, const std::string &dim) {
+        return topk(x, k, Dim{dim});
+      },
+      py::arg("x"), py::arg("k"), py::arg("dim"),
+      py::call_guard<py::gil_scoped_release>());
+}
+
+void init_reduction(py::module &m) {
+  bind_median<Variable>(m);
+  bind_median<DataArray>(m);
+  bind_median<Dataset>(m);
+  bind_arg_reduction<Variable>(m);
+  bind_arg_reduction<DataArray>(m);
+  bind_arg_reduction<Dataset>(m);
+}
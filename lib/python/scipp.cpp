@@ -6,6 +6,8 @@
 
 namespace py = pybind11;
 
+void init_arrow(py::module &);
+void init_binary_io(py::module &);
 void init_buckets(py::module &);
 void init_choose(py::module &);
 void init_comparison(py::module &);
@@ -16,10 +18,14 @@ void init_dataset(py::module &);
 void init_dtype(py::module &);
 void init_element_array_view(py::module &);
 void init_exceptions(py::module &);
+void init_execution_config(py::module &);
 void init_groupby(py::module &);
+void init_hdf5(py::module &);
 void init_geometry(py::module &);
 void init_histogram(py::module &);
 void init_operations(py::module &);
+void init_reduction(py::module &);
+void init_serialization(py::module &);
 void init_shape(py::module &);
 void init_trigonometry(py::module &);
 void init_unary(py::module &);
@@ -42,18 +48,24 @@ void init_core(py::module &m) {
   // pybind11 puts proper type annotations into the docstrings.
   init_units(core);
   init_exceptions(core);
+  init_execution_config(core);
   init_dtype(core);
   init_variable(core);
   init_dataset(core);
 
+  init_arrow(core);
   init_choose(core);
   init_counts(core);
   init_creation(core);
   init_cumulative(core);
   init_buckets(core);
   init_groupby(core);
+  init_hdf5(core);
+  init_binary_io(core);
   init_comparison(core);
   init_operations(core);
+  init_reduction(core);
+  init_serialization(core);
   init_shape(core);
   init_geometry(core);
   init_histogram(core);
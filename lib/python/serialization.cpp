@@ -0,0 +1,256 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <cstring>
+
+#include "scipp/core/eigen.h"
+#include "scipp/core/spatial_transforms.h"
+#include "scipp/core/string.h"
+#include "scipp/core/tag_util.h"
+#include "scipp/dataset/dataset.h"
+#include "scipp/units/string.h"
+#include "scipp/variable/categorical_string_model.h"
+#include "scipp/variable/string_array_model.h"
+#include "scipp/variable/structures.h"
+#include "scipp/variable/util.h"
+
+#include "pybind11.h"
+
+using namespace scipp;
+
+namespace py = pybind11;
+
+namespace {
+
+/// Dtypes of dense variables that can be serialized into frames. Elements of
+/// all types other than strings are copied bytewise.
+using SerializableTypes =
+    core::CallDType<double, float, core::float16, int64_t, int32_t, int16_t,
+                    int8_t, uint64_t, uint32_t, uint16_t, uint8_t, bool,
+                    core::time_point, Eigen::Vector3d, Eigen::Matrix3d,
+                    Eigen::Affine3d, core::Quaternion, core::Translation,
+                    std::string, std::string_view, core::categorical_string>;
+
+template <class T> constexpr bool is_string_v =
+    std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> ||
+    std::is_same_v<T, core::categorical_string>;
+
+/// Return a frame referring to `size` bytes at `data`, kept alive by `owner`.
+///
+/// Frames are writable unless `readonly` such that pickle restores them as
+/// writable buffers, which can be deserialized without copy. They are not
+/// meant to be modified.
+py::array make_frame(const void *data, const scipp::index size,
+                     std::shared_ptr<const void> owner, const bool readonly) {
+  py::capsule base(new std::shared_ptr<const void>(std::move(owner)),
+                   [](void *ptr) {
+                     delete static_cast<std::shared_ptr<const void> *>(ptr);
+                   });
+  py::array frame(py::dtype::of<uint8_t>(), {size}, {scipp::index{1}},
+                  static_cast<const uint8_t *>(data), base);
+  if (readonly)
+    py::detail::array_proxy(frame.ptr())->flags &=
+        ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+  return frame;
+}
+
+template <class T>
+py::array make_frame(std::shared_ptr<std::vector<T>> buffer) {
+  const auto *data = buffer->data();
+  const auto size = scipp::size(*buffer) * scipp::index{sizeof(T)};
+  return make_frame(data, size, std::move(buffer), false);
+}
+
+/// Frames of a string array: offsets into the characters and the characters.
+/// The characters of string_view elements are shared with `var` if they are
+/// stored consecutively.
+template <class T> py::list string_frames(const Variable &var) {
+  const auto values = var.values<T>();
+  auto offsets = std::make_shared<std::vector<int64_t>>(values.size() + 1, 0);
+  const char *begin =
+      values.size() == 0 ? nullptr : std::string_view(values[0]).data();
+  bool shared = std::is_same_v<T, std::string_view> && begin != nullptr;
+  int64_t total = 0;
+  scipp::index i = 0;
+  for (const auto &value : values) {
+    const std::string_view str(value);
+    shared = shared && str.data() == begin + total;
+    total += scipp::size(str);
+    (*offsets)[++i] = total;
+  }
+  py::list frames;
+  frames.append(make_frame(std::move(offsets)));
+  if (shared) {
+    frames.append(make_frame(begin, total, std::make_shared<Variable>(var),
+                             var.is_readonly()));
+  } else {
+    auto chars = std::make_shared<std::vector<char>>();
+    chars->reserve(total);
+    for (const auto &value : values) {
+      const std::string_view str(value);
+      chars->insert(chars->end(), str.begin(), str.end());
+    }
+    frames.append(make_frame(std::move(chars)));
+  }
+  return frames;
+}
+
+template <class T> struct ToFrames {
+  static py::list apply(const Variable &var) {
+    if constexpr (is_string_v<T>) {
+      return string_frames<T>(var);
+    } else {
+      const auto owner = std::make_shared<Variable>(var);
+      const auto size = var.dims().volume() * scipp::index{sizeof(T)};
+      py::list frames;
+      frames.append(make_frame(var.values<T>().data(), size, owner,
+                               var.is_readonly()));
+      if (var.has_variances())
+        frames.append(make_frame(var.variances<T>().data(), size, owner,
+                                 var.is_readonly()));
+      return frames;
+    }
+  }
+};
+
+py::tuple to_frames(const Variable &var) {
+  if (!is_contiguous(var)) {
+    Variable contiguous;
+    {
+      py::gil_scoped_release release;
+      contiguous = copy(var);
+    }
+    return to_frames(contiguous);
+  }
+  py::dict header;
+  py::list dims;
+  for (const auto &dim : var.dims().labels())
+    dims.append(dim.name());
+  header["dims"] = dims;
+  header["shape"] = py::cast(std::vector<scipp::index>(
+      var.dims().shape().begin(), var.dims().shape().end()));
+  header["unit"] = var.unit() == units::none
+                       ? py::object(py::none())
+                       : py::str(units::to_string(var.unit()));
+  header["dtype"] = core::to_string(var.dtype());
+  header["variances"] = var.has_variances();
+  auto frames = SerializableTypes::apply<ToFrames>(var.dtype(), var);
+  header["frame_count"] = frames.size();
+  return py::make_tuple(header, frames);
+}
+
+/// Keep the memory of a Python buffer exported while C++ data refers to it.
+std::shared_ptr<const void> hold_buffer(py::buffer_info &&info) {
+  return std::shared_ptr<py::buffer_info>(
+      new py::buffer_info(std::move(info)), [](py::buffer_info *ptr) {
+        py::gil_scoped_acquire acquire;
+        delete ptr;
+      });
+}
+
+/// Return the elements stored in `frame`. The memory of writable frames is
+/// used without copy, read-only frames are copied since variables must be
+/// writable. Memory is also copied if it is not aligned to `align` bytes.
+template <class T>
+core::element_array<T> from_frame(const py::buffer &frame,
+                                  const scipp::index size,
+                                  const size_t align = alignof(T)) {
+  auto info = frame.request();
+  if (info.size * info.itemsize != size * scipp::index{sizeof(T)})
+    throw std::invalid_argument("Frame of " +
+                                std::to_string(info.size * info.itemsize) +
+                                " bytes does not match the size of " +
+                                std::to_string(size) + " elements.");
+  auto *data = static_cast<T *>(info.ptr);
+  if (!info.readonly && reinterpret_cast<uintptr_t>(data) % align == 0)
+    return core::element_array<T>(data, size, hold_buffer(std::move(info)));
+  core::element_array<T> out(size, core::init_for_overwrite);
+  py::gil_scoped_release release;
+  if (size > 0)
+    std::memcpy(static_cast<void *>(out.data()), data, size * sizeof(T));
+  return out;
+}
+
+/// Return the string_view elements of strings stored in `frames`, viewing
+/// the characters in place.
+std::pair<core::element_array<std::string_view>,
+          std::shared_ptr<variable::StringArrayModel::buffer_type>>
+strings_from_frames(const py::list &frames, const scipp::index size) {
+  const auto offsets =
+      from_frame<int64_t>(frames[0].cast<py::buffer>(), size + 1);
+  const auto total = offsets.data()[size];
+  auto chars = std::make_shared<variable::StringArrayModel::buffer_type>(
+      from_frame<char>(frames[1].cast<py::buffer>(), total));
+  core::element_array<std::string_view> views(size, core::init_for_overwrite);
+  for (scipp::index i = 0; i < size; ++i)
+    views.data()[i] =
+        std::string_view(chars->data() + offsets.data()[i],
+                         offsets.data()[i + 1] - offsets.data()[i]);
+  return {std::move(views), std::move(chars)};
+}
+
+template <class T> struct FromFrames {
+  static Variable apply(const Dimensions &dims, const units::Unit &unit,
+                        const bool variances, const py::list &frames) {
+    const auto size = dims.volume();
+    if constexpr (std::is_same_v<T, std::string_view>) {
+      auto [views, chars] = strings_from_frames(frames, size);
+      return Variable(dims, variable::StringArrayModel::make(
+                                std::move(views), std::move(chars), unit));
+    } else if constexpr (std::is_same_v<T, core::categorical_string>) {
+      const auto [views, chars] = strings_from_frames(frames, size);
+      return Variable(dims, variable::CategoricalStringArrayModel::make(
+                                {views.data(), static_cast<size_t>(size)},
+                                unit));
+    } else if constexpr (std::is_same_v<T, std::string>) {
+      const auto [views, chars] = strings_from_frames(frames, size);
+      core::element_array<T> values(views.begin(), views.end());
+      return Variable(dims, std::make_shared<variable::ElementArrayModel<T>>(
+                                size, unit, std::move(values)));
+    } else if constexpr (core::is_structured(dtype<T>)) {
+      // The frame of a structured dtype holds its elements as doubles, which
+      // must be aligned for `T` if used without copy.
+      constexpr auto count = sizeof(T) / sizeof(double);
+      return variable::make_structures<T, double>(
+          dims, unit,
+          from_frame<double>(frames[0].cast<py::buffer>(),
+                             size * static_cast<scipp::index>(count),
+                             alignof(T)));
+    } else {
+      auto values = from_frame<T>(frames[0].cast<py::buffer>(), size);
+      std::optional<core::element_array<T>> vars;
+      if (variances)
+        vars = from_frame<T>(frames[1].cast<py::buffer>(), size);
+      return Variable(dims,
+                      std::make_shared<variable::ElementArrayModel<T>>(
+                          size, unit, std::move(values), std::move(vars)));
+    }
+  }
+};
+
+Variable from_frames(const py::dict &header, const py::list &frames) {
+  Dimensions dims;
+  const auto shape = header["shape"].cast<std::vector<scipp::index>>();
+  scipp::index i = 0;
+  for (const auto &dim : header["dims"].cast<std::vector<std::string>>())
+    dims.addInner(Dim(dim), shape.at(i++));
+  const auto unit = header["unit"].is_none()
+                        ? units::none
+                        : units::Unit(header["unit"].cast<std::string>());
+  const auto dtype = core::dtype_from_name(header["dtype"].cast<std::string>());
+  const auto variances = header["variances"].cast<bool>();
+  return SerializableTypes::apply<FromFrames>(dtype, dims, unit, variances,
+                                              frames);
+}
+} // namespace
+
+void init_serialization(py::module &m) {
+  m.def("_variable_to_frames", &to_frames, py::arg("var"),
+        R"(Return a header dict and a list of buffers holding the data of a
+dense variable. Buffers refer to the memory of the variable if it is
+contiguous.)");
+  m.def("_variable_from_frames", &from_frames, py::arg("header"),
+        py::arg("frames"),
+        R"(Create a dense variable from a header and buffers as returned by
+_variable_to_frames. Writable buffers are used without copy.)");
+}
@@ -125,6 +125,11 @@ of variances.)");
       py::arg("x"), py::arg("dim") = py::none(),
       py::call_guard<py::gil_scoped_release>());
 
+  m.def(
+      "_mark_linspace",
+      [](Variable &x) -> Variable { return scipp::variable::mark_linspace(x); },
+      py::arg("x"), py::call_guard<py::gil_scoped_release>());
+
   bind_structured_creation<Eigen::Vector3d, double, 3>(m, "vectors");
   bind_structured_creation<Eigen::Matrix3d, double, 3, 3>(m, "matrices");
   bind_structured_creation<Eigen::Affine3d, double, 4, 4>(m,
@@ -141,9 +146,12 @@ of variances.)");
     return core::callDType<GetElements>(
         structured_t{}, variableFactory().elem_dtype(self), self, key);
   });
-  m.def("_set_elements", [](Variable &self, const std::string &key,
-                            const Variable &elems) {
-    core::callDType<SetElements>(
-        structured_t{}, variableFactory().elem_dtype(self), self, key, elems);
-  });
+  m.def(
+      "_set_elements",
+      [](Variable &self, const std::string &key, const Variable &elems) {
+        core::callDType<SetElements>(structured_t{},
+                                     variableFactory().elem_dtype(self), self,
+                                     key, elems);
+      },
+      py::call_guard<py::gil_scoped_release>());
 }
@@ -51,9 +51,11 @@ void init_creation(py::module &m) {
         const auto unit_ = unit_or_default(unit, dtype_);
         return core::CallDType<
             double, float, int64_t, int32_t, bool, scipp::core::time_point,
-            std::string, Eigen::Vector3d,
-            Eigen::Matrix3d>::apply<MakeZeros>(dtype_, dims, shape, unit_,
-                                               with_variances);
+            std::string, Eigen::Vector3d, Eigen::Matrix3d, int16_t, int8_t,
+            uint64_t, uint32_t, uint16_t, uint8_t, scipp::core::float16,
+            scipp::core::categorical_string>::apply<MakeZeros>(dtype_, dims,
+                                                               shape, unit_,
+                                                               with_variances);
       },
       py::arg("dims"), py::arg("shape"), py::arg("unit") = DefaultUnit{},
       py::arg("dtype") = py::none(), py::arg("with_variances") = std::nullopt);
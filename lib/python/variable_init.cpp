@@ -10,6 +10,7 @@
 #include "scipp/core/tag_util.h"
 #include "scipp/dataset/dataset.h"
 #include "scipp/units/string.h"
+#include "scipp/variable/astype.h"
 #include "scipp/variable/to_unit.h"
 #include "scipp/variable/variable.h"
 
@@ -203,6 +204,12 @@ template <class T> struct MakeVariable {
 Variable make_variable(const py::object &dim_labels, const py::object &values,
                        const py::object &variances,
                        const std::optional<units::Unit> &unit_, DType dtype) {
+  if (dtype == core::dtype<std::string_view> ||
+      dtype == core::dtype<core::categorical_string>)
+    // Characters are copied into the buffer or dictionary of the new variable.
+    return astype(make_variable(dim_labels, values, variances, unit_,
+                                core::dtype<std::string>),
+                  dtype);
   const auto converted_values = parse_data_sequence(dim_labels, values);
   const auto converted_variances = parse_data_sequence(dim_labels, variances);
   dtype = common_dtype(converted_values, converted_variances, dtype);
@@ -212,10 +219,9 @@ Variable make_variable(const py::object &dim_labels, const py::object &values,
   return core::CallDType<double, float, int64_t, int32_t, bool,
                          scipp::core::time_point, std::string, Variable,
                          DataArray, Dataset, Eigen::Vector3d, Eigen::Matrix3d,
-                         python::PyObject>::apply<MakeVariable>(dtype, dims,
-                                                                values,
-                                                                variances,
-                                                                unit);
+                         python::PyObject, int16_t, int8_t, uint64_t, uint32_t,
+                         uint16_t, uint8_t, scipp::core::float16>::
+      apply<MakeVariable>(dtype, dims, values, variances, unit);
 }
 } // namespace
 
@@ -4,10 +4,13 @@
 #include "scipp/core/dtype.h"
 #include "scipp/core/eigen.h"
 #include "scipp/core/element/arithmetic.h"
+#include "scipp/core/spatial_kernels.h"
 #include "scipp/core/spatial_transforms.h"
 #include "scipp/variable/astype.h"
+#include "scipp/variable/creation.h"
 #include "scipp/variable/pow.h"
 #include "scipp/variable/transform.h"
+#include "scipp/variable/util.h"
 #include "scipp/variable/variable_factory.h"
 
 namespace scipp::variable {
@@ -33,6 +36,26 @@ bool correlated(const Variable &a, const Variable &b) {
          variableFactory().has_variances(b) && a.is_same(b);
 }
 
+/// Apply transformations of type T to vectors using the kernels in
+/// `core::spatial_kernels`, which are faster than `transform` in particular
+/// for a single transformation applied to many vectors. Returns an invalid
+/// variable if the inputs are not a contiguous array or scalar of T and a
+/// contiguous array of vectors with matching dims.
+template <class T, class Op>
+Variable try_transform_vectors(const Variable &a, const Variable &b,
+                               const Op &op) {
+  if (a.dtype() != dtype<T> || b.dtype() != dtype<Eigen::Vector3d> ||
+      (a.dims() != b.dims() && a.dims().ndim() != 0) || !is_contiguous(a) ||
+      !is_contiguous(b))
+    return Variable{};
+  Variable out =
+      empty(b.dims(), op(a.unit(), b.unit()), dtype<Eigen::Vector3d>);
+  core::spatial_kernels::multiply(a.values<T>().as_span(),
+                                  b.values<Eigen::Vector3d>().as_span(),
+                                  out.values<Eigen::Vector3d>().as_span());
+  return out;
+}
+
 } // namespace
 
 Variable operator+(const Variable &a, const Variable &b) {
@@ -48,6 +71,14 @@ Variable operator-(const Variable &a, const Variable &b) {
 }
 
 Variable operator*(const Variable &a, const Variable &b) {
+  if (auto out = try_transform_vectors<Eigen::Matrix3d>(
+          a, b, core::element::multiply);
+      out.is_valid())
+    return out;
+  if (auto out = try_transform_vectors<Eigen::Affine3d>(
+          a, b, core::element::apply_spatial_transformation);
+      out.is_valid())
+    return out;
   if (is_transform_with_translation(a) &&
       (is_transform_with_translation(b) ||
        b.dtype() == dtype<Eigen::Vector3d>)) {
@@ -4,17 +4,34 @@
 /// @author Jan-Lukas Wynen
 #include <cmath>
 
+#include "scipp/core/element/arg_list.h"
 #include "scipp/core/tag_util.h"
 #include "scipp/core/transform_common.h"
 #include "scipp/variable/astype.h"
+#include "scipp/variable/categorical_string_model.h"
+#include "scipp/variable/string_array_model.h"
 #include "scipp/variable/transform.h"
 #include "scipp/variable/variable.h"
 #include "scipp/variable/variable_factory.h"
 
 namespace scipp::variable {
 
+namespace {
+constexpr auto decode_string = overloaded{
+    core::element::arg_list<core::categorical_string>,
+    [](const units::Unit &u) { return u; },
+    [](const auto &x) { return x.str(); }};
+
+constexpr auto string_view_to_string = overloaded{
+    core::element::arg_list<std::string_view>,
+    [](const units::Unit &u) { return u; },
+    [](const auto &x) { return std::string(x); }};
+} // namespace
+
 struct MakeVariableWithType {
-  using AllSourceTypes = std::tuple<double, float, int64_t, int32_t, bool>;
+  using AllSourceTypes =
+      std::tuple<double, float, int64_t, int32_t, bool, int16_t, int8_t,
+                 uint64_t, uint32_t, uint16_t, uint8_t, core::float16>;
 
   template <class T> struct Maker {
     template <size_t I, class... Types> constexpr static auto source_types() {
@@ -57,12 +74,29 @@ struct MakeVariableWithType {
   };
 
   static Variable make(const Variable &var, DType type) {
-    return core::CallDType<double, float, int64_t, int32_t, bool>::apply<Maker>(
-        type, var);
+    return core::CallDType<double, float, int64_t, int32_t, bool, int16_t,
+                           int8_t, uint64_t, uint32_t, uint16_t, uint8_t,
+                           core::float16>::apply<Maker>(type, var);
   }
 };
 
 Variable astype(const Variable &var, DType type, const CopyPolicy copy) {
+  if (var.dtype() == dtype<std::string> &&
+      type == dtype<core::categorical_string>) {
+    const auto strings = var.values<std::string>();
+    const std::vector<std::string_view> views(strings.begin(), strings.end());
+    return Variable(var.dims(),
+                    CategoricalStringArrayModel::make(views, var.unit()));
+  }
+  if (var.dtype() == dtype<core::categorical_string> &&
+      type == dtype<std::string>)
+    return transform(var, decode_string, "astype");
+  if (var.dtype() == dtype<std::string> && type == dtype<std::string_view>)
+    return Variable(var.dims(),
+                    StringArrayModel::make(var.values<std::string>(),
+                                           var.unit()));
+  if (var.dtype() == dtype<std::string_view> && type == dtype<std::string>)
+    return transform(var, string_view_to_string, "astype");
   return type == variableFactory().elem_dtype(var)
              ? (copy == CopyPolicy::TryAvoid ? var : variable::copy(var))
              : MakeVariableWithType::make(var, type);
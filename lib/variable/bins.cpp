@@ -25,7 +25,10 @@ void copy_data(const Variable &src, Variable &dst) {
   assert(dst.dtype() == dtype<bucket<Variable>>);
   transform_in_place<double, float, int64_t, int32_t, bool, std::string,
                      core::time_point, Eigen::Vector3d, Eigen::Matrix3d,
-                     Eigen::Affine3d, core::Translation, core::Quaternion>(
+                     Eigen::Affine3d, core::Translation, core::Quaternion,
+                     int16_t, int8_t, uint64_t, uint32_t, uint16_t, uint8_t,
+                     core::float16, core::categorical_string,
+                     std::string_view>(
       dst, src, [](auto &a, const auto &b) { a = b; }, "copy");
 }
 
@@ -51,8 +54,11 @@ Variable resize_default_init(const Variable &var, const Dim dim,
     dims.resize(dim, size);
   // Using variableFactory instead of variable::resize for creating
   // _uninitialized_ variable.
-  return variable::variableFactory().create(var.dtype(), dims, var.unit(),
-                                            var.has_variances());
+  auto out = variable::variableFactory().create(var.dtype(), dims, var.unit(),
+                                                var.has_variances());
+  // Elements are typically copied from `var`, e.g., when binning.
+  share_storage(var, out);
+  return out;
 }
 
 /// Construct a bin-variable over a variable.
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <algorithm>
+
+#include "scipp/variable/categorical_string_model.h"
+#include "scipp/variable/element_array_variable.tcc"
+
+namespace scipp::variable {
+
+template <> struct model<core::categorical_string> {
+  using type = CategoricalStringArrayModel;
+};
+
+CategoricalStringArrayModel::CategoricalStringArrayModel(
+    const CategoricalStringArrayModel &other)
+    : ElementArrayModel(other), m_dictionaries(other.m_dictionaries) {}
+
+CategoricalStringArrayModel &
+CategoricalStringArrayModel::operator=(
+    const CategoricalStringArrayModel &other) {
+  ElementArrayModel::operator=(other);
+  m_dictionaries = other.m_dictionaries;
+  m_own.reset();
+  return *this;
+}
+
+std::shared_ptr<CategoricalStringArrayModel> CategoricalStringArrayModel::make(
+    const scipp::span<const std::string_view> strings,
+    const units::Unit &unit) {
+  const auto size = scipp::size(strings);
+  auto model = std::make_shared<CategoricalStringArrayModel>(
+      size, unit, element_array<core::categorical_string>(size));
+  auto values = model->values();
+  std::transform(strings.begin(), strings.end(), values.begin(),
+                 [&model](const auto &str) { return model->encode(str); });
+  return model;
+}
+
+VariableConceptHandle CategoricalStringArrayModel::makeDefaultFromParent(
+    const scipp::index size) const {
+  auto model = std::make_shared<CategoricalStringArrayModel>(
+      size, unit(), element_array<core::categorical_string>(size));
+  // Elements are typically copied from the parent.
+  model->m_dictionaries = m_dictionaries;
+  return model;
+}
+
+VariableConceptHandle CategoricalStringArrayModel::clone() const {
+  return std::make_shared<CategoricalStringArrayModel>(*this);
+}
+
+void CategoricalStringArrayModel::copy_batch(
+    const scipp::span<const Variable> src,
+    const scipp::span<Variable> dest) const {
+  for (size_t i = 0; i < std::min(src.size(), dest.size()); ++i)
+    variable::share_storage(src[i], dest[i]);
+  ElementArrayModel::copy_batch(src, dest);
+}
+
+void CategoricalStringArrayModel::assign(const VariableConcept &other) {
+  *this = requireT<const CategoricalStringArrayModel>(other);
+}
+
+scipp::index CategoricalStringArrayModel::object_size() const {
+  auto size = static_cast<scipp::index>(sizeof(*this));
+  for (const auto &dictionary : m_dictionaries)
+    size += scipp::size(*dictionary) *
+            static_cast<scipp::index>(sizeof(core::categorical_string::Entry));
+  return size;
+}
+
+core::categorical_string
+CategoricalStringArrayModel::encode(const std::string_view str) {
+  if (!m_own) {
+    m_own = std::make_shared<dictionary_type>();
+    m_dictionaries.insert(m_own);
+  }
+  return m_own->encode(str);
+}
+
+void CategoricalStringArrayModel::share_storage(
+    const VariableConcept &other) {
+  if (&other == this || other.dtype() != scipp::dtype<core::categorical_string>)
+    return;
+  const auto &dictionaries =
+      requireT<const CategoricalStringArrayModel>(other).m_dictionaries;
+  m_dictionaries.insert(dictionaries.begin(), dictionaries.end());
+}
+
+template class SCIPP_EXPORT ElementArrayModel<core::categorical_string>;
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE_BASE(categorical_string,
+                                        core::categorical_string)
+
+} // namespace scipp::variable
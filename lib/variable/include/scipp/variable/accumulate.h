@@ -11,20 +11,35 @@
 namespace scipp::variable {
 
 namespace detail {
-template <class... Ts, class Op, class Var, class... Other>
+/// `combine` is used for combining partial results of threads. If it is
+/// nullptr, `op` is used, which is only possible if there is a single `other`.
+template <class... Ts, class Op, class Combine, class Var, class... Other>
 static void do_accumulate(const std::tuple<Ts...> &types, Op op,
-                          const std::string_view &name, Var &&var,
-                          const Other &...other) {
+                          const Combine &combine, const std::string_view &name,
+                          Var &&var, const Other &...other) {
+  constexpr bool can_combine =
+      sizeof...(other) == 1 || !std::is_same_v<Combine, std::nullptr_t>;
+  const auto combine_into = [&](auto &&out, const auto &in) {
+    if constexpr (std::is_same_v<Combine, std::nullptr_t>)
+      in_place<false>::transform_data(types, op, name, out, in);
+    else
+      combine(out, in);
+  };
+  // Chunking along the input dims requires slicing all `other` alike.
+  const auto &first_dims = std::get<0>(std::tie(other...)).dims();
+  const bool chunkable = can_combine && ((other.dims() == first_dims) && ...);
   // Bail out (no threading) if:
   // - `other` is implicitly broadcast
   // - `other` are small, to avoid overhead (important for groupby), limit set
-  //   by tuning BM_groupby_large_table
-  // - reduction to scalar with more than 1 `other`
+  //   by tuning BM_groupby_large_table, which found 4 tasks worth of work with
+  //   the default execution config
+  // - reduction to scalar, unless partial results can be combined
   const bool binned_input = (is_bins(other) || ...);
-  const scipp::index small_input = binned_input ? 2 : 16384;
+  const scipp::index small_input =
+      binned_input ? 2 : 4 * core::parallel::min_items_per_task();
   if ((!other.dims().includes(var.dims()) || ...) ||
       ((other.dims().volume() < small_input) && ...) ||
-      (sizeof...(other) != 1 && var.dims().ndim() == 0))
+      (!chunkable && var.dims().ndim() == 0))
     return in_place<false>::transform_data(types, op, name, var, other...);
 
   const auto reduce_chunk = [&](auto &&out, const Slice &slice) {
@@ -54,25 +69,34 @@ static void do_accumulate(const std::tuple<Ts...> &types, Op op,
       reduce_chunk(var.slice(slice), slice);
     };
     const auto size = var.dims()[dim];
-    core::parallel::parallel_for(core::parallel::blocked_range(0, size),
+    // Every item of the range is a slice of the output, accumulating a slice of
+    // the input.
+    const auto grain = core::parallel::grainsize(
+        size, first_dims.volume() / std::max(size, scipp::index(1)) *
+                  scipp::index(sizeof(double)));
+    core::parallel::parallel_for(core::parallel::blocked_range(0, size, grain),
                                  reduce);
   };
-  if constexpr (sizeof...(other) == 1) {
+  if constexpr (can_combine) {
     const bool reduce_outer =
         (!var.dims().contains(other.dims().labels().front()) || ...);
     // This value is found from benchmarks reducing the outer dimension. Making
     // it larger can improve parallelism further, but increases the overhead
     // from copies. May need further tuning.
     constexpr scipp::index chunking_limit = 65536;
-    if (var.dims().ndim() == 0 ||
-        (reduce_outer && var.dims()[*var.dims().begin()] < chunking_limit)) {
+    if (chunkable &&
+        (var.dims().ndim() == 0 ||
+         (reduce_outer && var.dims()[*var.dims().begin()] < chunking_limit))) {
       // For small output sizes, especially with reduction along the outer
       // dimension, threading via the output's dimension does not provide
       // significant speedup, mainly due to partially transposed memory access
       // patterns. We thus chunk based on the input's dimension, for a 5x
       // speedup in many cases.
-      const auto outer_dim = (*other.dims().begin(), ...);
-      const auto outer_size = (other.dims()[outer_dim], ...);
+      const auto outer_dim = *first_dims.begin();
+      const auto outer_size = first_dims[outer_dim];
+      // The number of partial results is fixed, independent of the execution
+      // config, such that results of floating-point sums do not depend on the
+      // number of threads or the machine.
       const auto nchunk = std::min(scipp::index(24), outer_size);
       const auto chunk_size = (outer_size + nchunk - 1) / nchunk;
       // The threading approach in used here is possible only under the
@@ -87,7 +111,7 @@ static void do_accumulate(const std::tuple<Ts...> &types, Op op,
       // (instead of a broadcast of the output). For now we simply bail out if
       // we detect non-idempotent initial values.
       auto v = copy(var);
-      if (in_place<false>::transform_data(types, op, name, v, var); var != v)
+      if (combine_into(v, var); var != v)
         return in_place<false>::transform_data(types, op, name, var, other...);
       v = copy(
           broadcast(var, merge({Dim::InternalAccumulate, nchunk}, var.dims())));
@@ -100,7 +124,7 @@ static void do_accumulate(const std::tuple<Ts...> &types, Op op,
       };
       core::parallel::parallel_for(core::parallel::blocked_range(0, nchunk, 1),
                                    reduce);
-      in_place<false>::transform_data(types, op, name, var, v);
+      combine_into(var, v);
     } else {
       accumulate_parallel();
     }
@@ -117,7 +141,7 @@ static void accumulate(const std::tuple<Ts...> &types, Op op,
   if constexpr ((!std::is_const_v<std::remove_reference_t<Other>> || ...))
     return in_place<false>::transform_data(types, op, name, var, other...);
   else
-    do_accumulate(types, op, name, std::forward<Var>(var), other...);
+    do_accumulate(types, op, nullptr, name, std::forward<Var>(var), other...);
 }
 
 } // namespace detail
@@ -158,4 +182,25 @@ void accumulate_in_place(Var &&var, Variable &var1, const Variable &var2,
                      var1, var2, var3);
 }
 
+/// Accumulate data elements of a variable in-place, skipping masked elements.
+///
+/// `op` is called with the accumulator, the element of `other`, and the
+/// corresponding element of `mask`. This avoids creating a copy of `other` with
+/// masked elements replaced by a neutral value. `combine` must be equivalent to
+/// `op` with a mask value of false. It is used for combining partial results
+/// from multiple threads.
+template <class Var, class Op, class Combine>
+void masked_accumulate_in_place(Var &&var, const Variable &other,
+                                const Variable &mask, Op op, Combine combine,
+                                const std::string_view name) {
+  const auto combine_ = [&combine, name](auto &&out, const auto &in) {
+    in_place<false>::transform_data(type_tuples<>(combine), combine, name, out,
+                                    in);
+  };
+  // Broadcasting the mask is free and lets threads slice it like `other`.
+  detail::do_accumulate(type_tuples<>(op), op, combine_, name,
+                        std::forward<Var>(var), other,
+                        broadcast(mask, other.dims()));
+}
+
 } // namespace scipp::variable
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+#include <memory>
+#include <string_view>
+#include <unordered_set>
+
+#include "scipp/core/categorical_string.h"
+#include "scipp/variable/element_array_model.h"
+
+namespace scipp::variable {
+
+/// Implementation of VariableConcept for arrays of dictionary-encoded strings
+/// with elements of type core::categorical_string.
+///
+/// The model owns the dictionaries its elements refer to. Dictionaries are
+/// shared by all models with elements referring to them, such that copying,
+/// concatenating, and binning copies only the codes. A dictionary is released
+/// when the last model referring to it is destroyed.
+///
+/// Models share the dictionaries of all models whose elements are written into
+/// them, see `share_storage`. This is done by `copy`, `copy_batch`, and
+/// `transform_in_place`. Code writing elements of another model directly via
+/// `values` must call `variable::share_storage` first.
+class SCIPP_VARIABLE_EXPORT CategoricalStringArrayModel
+    : public ElementArrayModel<core::categorical_string> {
+public:
+  using dictionary_type = core::CategoricalDictionary;
+
+  using ElementArrayModel::ElementArrayModel;
+  /// Share the dictionaries of `other` but not the dictionary used by
+  /// `encode`, which is exclusive to each model.
+  CategoricalStringArrayModel(const CategoricalStringArrayModel &other);
+  CategoricalStringArrayModel &
+  operator=(const CategoricalStringArrayModel &other);
+
+  /// Return a model with elements encoding `strings` in a new dictionary.
+  static std::shared_ptr<CategoricalStringArrayModel>
+  make(scipp::span<const std::string_view> strings, const units::Unit &unit);
+
+  using ElementArrayModel::makeDefaultFromParent;
+  VariableConceptHandle
+  makeDefaultFromParent(scipp::index size) const override;
+  VariableConceptHandle clone() const override;
+
+  void copy_batch(scipp::span<const Variable> src,
+                  scipp::span<Variable> dest) const override;
+  void assign(const VariableConcept &other) override;
+
+  /// Size of the model, including the dictionaries, which may be shared.
+  scipp::index object_size() const override;
+
+  /// Return the code of `str` for storing in an element of this model.
+  [[nodiscard]] core::categorical_string encode(std::string_view str);
+
+  /// Keep the dictionaries of `other` alive as long as this model.
+  void share_storage(const VariableConcept &other) override;
+  const auto &dictionaries() const noexcept { return m_dictionaries; }
+
+private:
+  std::unordered_set<std::shared_ptr<const dictionary_type>> m_dictionaries;
+  std::shared_ptr<dictionary_type> m_own;
+};
+
+} // namespace scipp::variable
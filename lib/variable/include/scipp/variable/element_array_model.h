@@ -3,10 +3,16 @@
 /// @file
 /// @author Simon Heybrock
 #pragma once
+#include <algorithm>
 #include <optional>
+#include <utility>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
 
 #include "scipp/common/initialization.h"
 #include "scipp/common/numeric.h"
+#include "scipp/core/block_copy.h"
 #include "scipp/core/dimensions.h"
 #include "scipp/core/eigen.h"
 #include "scipp/core/element_array_view.h"
@@ -35,7 +41,8 @@ bool equals_impl(const T1 &view1, const T2 &view2) {
 }
 
 template <class T> bool equals_nan(const T &a, const T &b) {
-  if constexpr (std::is_floating_point_v<T>) {
+  if constexpr (std::is_floating_point_v<T> ||
+                std::is_same_v<T, core::float16>) {
     using numeric::isnan;
     if (isnan(a) && isnan(b))
       return true;
@@ -83,6 +90,8 @@ public:
   bool equals_nan(const Variable &a, const Variable &b) const override;
   void copy(const Variable &src, Variable &dest) const override;
   void copy(const Variable &src, Variable &&dest) const override;
+  void copy_batch(scipp::span<const Variable> src,
+                  scipp::span<Variable> dest) const override;
   void assign(const VariableConcept &other) override;
 
   void setVariances(const Variable &variances) override;
@@ -97,6 +106,8 @@ public:
     return ElementArrayView(base, m_values.data());
   }
   auto values(const core::ElementArrayViewParams &base) {
+    property_cache().clear();
+    detach(m_values);
     return ElementArrayView(base, m_values.data());
   }
   auto variances(const core::ElementArrayViewParams &base) const {
@@ -105,6 +116,7 @@ public:
   }
   auto variances(const core::ElementArrayViewParams &base) {
     expect_has_variances();
+    detach(*m_variances);
     return ElementArrayView(base, m_variances->data());
   }
 
@@ -119,10 +131,21 @@ public:
   }
 
   scipp::span<T> values() {
+    property_cache().clear();
+    detach(m_values);
     return {m_values.data(), m_values.data() + m_values.size()};
   }
 
 private:
+  /// Copy `array` if it wraps memory that must not be written.
+  ///
+  /// This is done on the first non-const access, so read-only variables, such
+  /// as those imported by `dataset::from_arrow`, keep sharing the memory.
+  /// Writable external memory, e.g., of mapped files, is used in place.
+  static void detach(element_array<T> &array) {
+    if (array.is_read_only())
+      array = element_array<T>(std::as_const(array));
+  }
   void expect_has_variances() const {
     if (!has_variances())
       throw except::VariancesError("Variable does not have variances.");
@@ -134,6 +157,34 @@ private:
 namespace {
 template <class T> auto copy(const T &x) { return x; }
 constexpr auto do_copy = [](auto &a, const auto &b) { a = copy(b); };
+
+constexpr auto copy_op = overloaded{
+    core::transform_flags::expect_in_variance_if_out_variance, do_copy};
+
+/// Add the copy of `src` to `dest` to `plan`, return false if the memory
+/// layout does not yield contiguous blocks.
+template <class T>
+bool add_to_plan(core::BlockCopyPlan &plan, const Variable &src,
+                 Variable &dest) {
+  // Strides of `src` in the order of `dest`, zero for broadcast dims.
+  boost::container::small_vector<scipp::index, core::NDIM_STACK> src_strides;
+  for (const auto &dim : dest.dims().labels())
+    src_strides.push_back(src.dims().contains(dim)
+                              ? src.strides()[src.dims().index(dim)]
+                              : 0);
+  const auto add = [&](const T *in, T *out) {
+    return plan.add(reinterpret_cast<const std::byte *>(in),
+                    {src_strides.data(), src_strides.size()},
+                    reinterpret_cast<std::byte *>(out), dest.strides(),
+                    dest.dims().shape(), sizeof(T));
+  };
+  if (!add(src.values<T>().data(), dest.values<T>().data()))
+    return false;
+  if constexpr (core::canHaveVariances<T>())
+    if (dest.has_variances())
+      add(src.variances<T>().data(), dest.variances<T>().data());
+  return true;
+}
 } // namespace
 
 /// Helper for implementing Variable(View) copy operations.
@@ -142,15 +193,48 @@ constexpr auto do_copy = [](auto &a, const auto &b) { a = copy(b); };
 /// transform can be called with any T.
 template <class T>
 void ElementArrayModel<T>::copy(const Variable &src, Variable &dest) const {
-  transform_in_place<T>(
-      dest, src,
-      overloaded{core::transform_flags::expect_in_variance_if_out_variance,
-                 do_copy},
-      "copy");
+  copy_batch({&src, 1}, {&dest, 1});
 }
 template <class T>
 void ElementArrayModel<T>::copy(const Variable &src, Variable &&dest) const {
   copy(src, dest);
 }
 
+/// Copy using a single `BlockCopyPlan` for all pairs with contiguous inner
+/// dims. Other pairs, e.g., with transposed inputs, use `transform_in_place`.
+template <class T>
+void ElementArrayModel<T>::copy_batch(const scipp::span<const Variable> src,
+                                      const scipp::span<Variable> dest) const {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (src.size() != dest.size())
+      throw std::invalid_argument(
+          "Number of sources and destinations differs.");
+    std::vector<const VariableConcept *> dest_buffers;
+    for (const auto &var : dest)
+      if (std::find(dest_buffers.begin(), dest_buffers.end(), &var.data()) ==
+          dest_buffers.end())
+        dest_buffers.push_back(&var.data());
+    core::BlockCopyPlan plan;
+    std::vector<size_t> strided;
+    for (size_t i = 0; i < src.size(); ++i) {
+      // Check dims, dtypes, units, and variances without copying data.
+      dry_run::transform_in_place<T>(dest[i], src[i], copy_op, "copy");
+      // Copies from any of the destinations are done one by one, in order,
+      // using transform_in_place, which also handles overlap.
+      if (std::find(dest_buffers.begin(), dest_buffers.end(), &src[i].data()) !=
+              dest_buffers.end() ||
+          !add_to_plan<T>(plan, src[i], dest[i]))
+        strided.push_back(i);
+    }
+    plan.execute();
+    for (size_t i = 0; i < src.size(); ++i)
+      dest[i].setUnit(src[i].unit());
+    for (const auto i : strided)
+      transform_in_place<T>(dest[i], src[i], copy_op, "copy");
+  } else {
+    for (size_t i = 0; i < src.size(); ++i)
+      transform_in_place<T>(dest[i], src[i], copy_op, "copy");
+  }
+}
+
 } // namespace scipp::variable
@@ -14,7 +14,7 @@ Variable make_default_init(const Dimensions &dims, const units::Unit &unit,
     throw except::VariancesError("This data type cannot have variances.");
   const auto volume = dims.volume();
   VariableConceptHandle model;
-  if constexpr (std::is_same_v<model_t<T>, ElementArrayModel<T>>) {
+  if constexpr (std::is_base_of_v<ElementArrayModel<T>, model_t<T>>) {
     if (variances)
       model = std::make_shared<model_t<T>>(
           volume, unit, element_array<T>(volume, core::init_for_overwrite),
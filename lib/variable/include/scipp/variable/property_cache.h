@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include "scipp-variable_export.h"
+
+namespace scipp::variable {
+
+class Variable;
+
+/// Memoized properties of the elements of a VariableConcept.
+///
+/// Properties refer to all elements of the buffer in memory order. They are
+/// recorded and consulted by the functions in `util.h` and `reduction.h`, such
+/// that, e.g., repeated calls to `hist` with the same bin edges do not
+/// validate the edges every time. Owners of the elements must call `clear`
+/// whenever the elements may be modified.
+///
+/// Buffers that have been exposed as writable arrays outside of scipp, e.g.,
+/// to numpy, may be modified at any time. `disable` stops memoization for
+/// these.
+///
+/// Methods may be called concurrently. A property computed while the elements
+/// are cleared concurrently is not recorded: callers obtain a `generation`
+/// before computing the property and pass it to `set`, which drops the value
+/// if `clear` was called in the meantime. This does not make reading elements
+/// concurrently with writing them safe, results are undefined in that case.
+///
+/// Most buffers never have properties recorded. `clear` is called on every
+/// write access, so it returns after a single relaxed load unless `generation`
+/// has ever been called.
+class SCIPP_VARIABLE_EXPORT PropertyCache {
+public:
+  enum class Property : uint8_t {
+    Linspace,
+    SortedAscending,
+    SortedDescending
+  };
+
+  PropertyCache() = default;
+  /// Copy the memoized properties but not whether memoization is disabled,
+  /// since that refers to the buffer of `other`, not its values.
+  PropertyCache(const PropertyCache &other);
+  PropertyCache &operator=(const PropertyCache &other);
+
+  /// Incremented by every call to `clear`.
+  [[nodiscard]] uint64_t generation() const noexcept;
+
+  [[nodiscard]] std::optional<bool> get(Property property) const noexcept;
+  void set(Property property, bool value, uint64_t generation) noexcept;
+
+  [[nodiscard]] std::shared_ptr<const Variable> min() const noexcept;
+  [[nodiscard]] std::shared_ptr<const Variable> max() const noexcept;
+  void set_min(std::shared_ptr<const Variable> min,
+               uint64_t generation) noexcept;
+  void set_max(std::shared_ptr<const Variable> max,
+               uint64_t generation) noexcept;
+
+  void clear() noexcept;
+  void disable() noexcept;
+  [[nodiscard]] bool enabled() const noexcept;
+
+private:
+  enum class State : uint8_t { Unknown, False, True };
+  static constexpr size_t n_property = 3;
+
+  std::array<std::atomic<State>, n_property> m_state{};
+  std::shared_ptr<const Variable> m_min;
+  std::shared_ptr<const Variable> m_max;
+  std::atomic<uint64_t> m_generation{0};
+  std::atomic<bool> m_disabled{false};
+  /// Set by `generation`, i.e., before any property may be recorded.
+  mutable std::atomic<bool> m_active{false};
+};
+
+} // namespace scipp::variable
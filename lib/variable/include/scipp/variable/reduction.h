@@ -12,39 +12,77 @@ namespace scipp::variable {
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable mean(const Variable &var);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable mean(const Variable &var,
                                                   const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+mean(const Variable &var, const scipp::span<const Dim> dims);
 
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable sum(const Variable &var);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable sum(const Variable &var,
                                                  const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+sum(const Variable &var, const scipp::span<const Dim> dims);
 
 // Logical reductions
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable any(const Variable &var);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable any(const Variable &var,
                                                  const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+any(const Variable &var, const scipp::span<const Dim> dims);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable all(const Variable &var);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable all(const Variable &var,
                                                  const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+all(const Variable &var, const scipp::span<const Dim> dims);
 
 // Other reductions
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable max(const Variable &var);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable max(const Variable &var,
                                                  const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+max(const Variable &var, const scipp::span<const Dim> dims);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable min(const Variable &var);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable min(const Variable &var,
                                                  const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+min(const Variable &var, const scipp::span<const Dim> dims);
 // Reduction operations ignoring or zeroing nans
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nanmax(const Variable &var);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nanmax(const Variable &var,
                                                     const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+nanmax(const Variable &var, const scipp::span<const Dim> dims);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nanmin(const Variable &var);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nanmin(const Variable &var,
                                                     const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+nanmin(const Variable &var, const scipp::span<const Dim> dims);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nansum(const Variable &var);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nansum(const Variable &var,
                                                     const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+nansum(const Variable &var, const scipp::span<const Dim> dims);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nanmean(const Variable &var);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nanmean(const Variable &var,
                                                      const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+nanmean(const Variable &var, const scipp::span<const Dim> dims);
+
+// Selection-based reductions
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable median(const Variable &var);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable median(const Variable &var,
+                                                    const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nanmedian(const Variable &var);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable nanmedian(const Variable &var,
+                                                       const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable quantile(const Variable &var,
+                                                      const double q);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+quantile(const Variable &var, const double q, const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable argmin(const Variable &var,
+                                                    const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable argmax(const Variable &var,
+                                                    const Dim dim);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+topk(const Variable &var, const scipp::index k, const Dim dim);
 
 // Reductions of all events within a bin.
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable bins_sum(const Variable &data);
@@ -57,6 +95,11 @@ namespace scipp::variable {
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable bins_any(const Variable &data);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable bins_mean(const Variable &data);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable bins_nanmean(const Variable &data);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable bins_median(const Variable &data);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+bins_nanmedian(const Variable &data);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable bins_argmin(const Variable &data);
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable bins_argmax(const Variable &data);
 
 // These reductions accumulate their results in their first argument
 // without erasing its current contents.
@@ -68,4 +111,18 @@ SCIPP_VARIABLE_EXPORT void max_into(Variable &accum, const Variable &var);
 SCIPP_VARIABLE_EXPORT void nanmax_into(Variable &accum, const Variable &var);
 SCIPP_VARIABLE_EXPORT void min_into(Variable &accum, const Variable &var);
 SCIPP_VARIABLE_EXPORT void nanmin_into(Variable &accum, const Variable &var);
+
+// As above, but skipping elements of `var` where `mask` is true.
+SCIPP_VARIABLE_EXPORT void masked_sum_into(Variable &accum, const Variable &var,
+                                           const Variable &mask);
+SCIPP_VARIABLE_EXPORT void masked_nansum_into(Variable &accum,
+                                              const Variable &var,
+                                              const Variable &mask);
+
+namespace detail {
+/// Full quantile reductions of at least this many elements use a parallel
+/// sample-select. Exposed for testing.
+SCIPP_VARIABLE_EXPORT scipp::index parallel_quantile_min_size();
+SCIPP_VARIABLE_EXPORT void set_parallel_quantile_min_size(scipp::index size);
+} // namespace detail
 } // namespace scipp::variable
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+#include "scipp/core/element_array_view.h"
+#include "scipp/variable/element_array_model.h"
+
+namespace scipp::variable {
+
+/// Implementation of VariableConcept for arrays of strings with elements of
+/// type std::string_view.
+///
+/// The characters of all elements are stored in contiguous buffers that are
+/// never modified after creation. Buffers are shared by all models that view
+/// them, such that copying, concatenating, and binning copies only the
+/// elements, i.e., the views, but neither characters nor allocates per element.
+///
+/// Buffers may wrap characters owned by another object, see `make` with an
+/// explicit buffer, e.g., to share strings imported from Arrow without copies.
+///
+/// Models share the buffers of all models whose elements are written into
+/// them, see `share_storage`. This is done by `copy`, `copy_batch`, and
+/// `transform_in_place`. Code writing elements of another model directly via
+/// `values` must call `variable::share_storage` first.
+class SCIPP_VARIABLE_EXPORT StringArrayModel
+    : public ElementArrayModel<std::string_view> {
+public:
+  using buffer_type = core::element_array<char>;
+
+  using ElementArrayModel::ElementArrayModel;
+
+  /// Return a model with copies of `strings`, all stored in a single buffer.
+  static std::shared_ptr<StringArrayModel>
+  make(const ElementArrayView<const std::string> &strings,
+       const units::Unit &unit);
+  /// Return a model with elements `views`, which must point into `buffer`.
+  static std::shared_ptr<StringArrayModel>
+  make(element_array<std::string_view> views,
+       std::shared_ptr<const buffer_type> buffer, const units::Unit &unit);
+
+  using ElementArrayModel::makeDefaultFromParent;
+  VariableConceptHandle
+  makeDefaultFromParent(scipp::index size) const override;
+  VariableConceptHandle clone() const override;
+
+  void copy_batch(scipp::span<const Variable> src,
+                  scipp::span<Variable> dest) const override;
+  void assign(const VariableConcept &other) override;
+
+  /// Size of the model, including the buffers, which may be shared.
+  scipp::index object_size() const override;
+
+  /// Keep the buffers of `other` alive as long as this model.
+  void share_storage(const VariableConcept &other) override;
+  const auto &buffers() const noexcept { return m_buffers; }
+
+private:
+  std::unordered_set<std::shared_ptr<const buffer_type>> m_buffers;
+};
+
+} // namespace scipp::variable
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <string_view>
 
 #include "scipp/common/overloaded.h"
@@ -79,6 +80,21 @@ template <class T> static constexpr auto array_params(T &&iterable) noexcept {
     return iterable;
 }
 
+template <class... Operands> constexpr scipp::index element_bytes() {
+  return (sizeof(typename std::decay_t<Operands>::value_type) + ...);
+}
+
+/// Grain size for threading over `index`, based on the element size of all
+/// operands. For binned operands every item is a bin of unknown size, so the
+/// range is split based on the number of threads only.
+template <class... Operands, class Index>
+scipp::index grainsize(const scipp::index size, const Index &index) {
+  if (index.has_bins())
+    return core::parallel::grainsize(size,
+                                     std::numeric_limits<scipp::index>::max());
+  return core::parallel::grainsize(size, element_bytes<Operands...>());
+}
+
 template <size_t N_Operands, bool in_place>
 inline constexpr auto stride_special_cases =
     std::array<std::array<scipp::index, N_Operands>, 0>{};
@@ -238,10 +254,129 @@ static void dispatch_inner_loop(
   }
 }
 
+template <size_t... Is>
+auto flat_stride_sequence_impl(std::index_sequence<Is...>)
+    -> std::integer_sequence<scipp::index, (static_cast<void>(Is), 1)...>;
+
+template <size_t N_Operands>
+using make_flat_stride_sequence = decltype(flat_stride_sequence_impl(
+    std::make_index_sequence<N_Operands>{}));
+
+/// True if all operands are dense and contiguous with identical dims, i.e., if
+/// element `i` of every operand is at flat index `i`. Since all operands are
+/// views with the dims of the output, this is the case if the strides of all
+/// operands match the strides of a contiguous array.
+template <class Out, class... Ts>
+bool is_flat(const Out &out, const Ts &...other) {
+  const auto params = array_params(out);
+  [[maybe_unused]] const auto flat = [&](const auto &operand) {
+    const auto p = array_params(operand);
+    return !p.bucketParams() && p.dims() == params.dims() &&
+           p.strides() == params.strides();
+  };
+  return !params.bucketParams() &&
+         params.strides() == core::Strides(params.dims()) &&
+         (flat(other) && ...);
+}
+
+/// Run `op` on all `size` elements of operands that satisfy `is_flat`. This
+/// avoids the setup and increment cost of MultiIndex, which dominates for
+/// small arrays.
+template <bool in_place, class Op, class... Operands>
+static void run_flat(Op &&op, const scipp::index size, Operands &&...operands) {
+  constexpr auto N = sizeof...(Operands);
+  const auto run = [&](const scipp::index begin, const scipp::index end) {
+    std::array<scipp::index, N> indices;
+    indices.fill(begin);
+    inner_loop<in_place>(op, indices, make_flat_stride_sequence<N>{},
+                         end - begin, std::forward<Operands>(operands)...);
+  };
+  constexpr auto bytes_per_item = element_bytes<Operands...>();
+  if (size <= core::parallel::min_items_per_task(bytes_per_item))
+    return run(0, size);
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(
+          0, size, core::parallel::grainsize(size, bytes_per_item)),
+      [&](const auto &range) { run(range.begin(), range.end()); });
+}
+
+/// Side length of the tiles used by `run_tiled`. A tile of 64x64 doubles is
+/// 32 KiB, i.e., tiles of a few operands fit into a typical L2 cache.
+constexpr scipp::index tile_size = 64;
+
+/// Number of bands of `tile_size` rows of the second dim, for every index of
+/// the outer dims. Bands are the unit of work of `run_tiled`.
+template <class Index> scipp::index tile_band_count(const Index &index) {
+  auto count = (index.shape(1) + tile_size - 1) / tile_size;
+  for (scipp::index dim = 2; dim < index.ndim(); ++dim)
+    count *= index.shape(dim);
+  return count;
+}
+
+/// Run `op` on all elements of the bands in [band_begin, band_end), iterating
+/// the two inner dims in tiles of `tile_size` x `tile_size` elements.
+///
+/// This is used if `index.prefers_tiling()`, i.e., if the operands disagree on
+/// the memory order. All operands then access memory in cache-sized blocks,
+/// instead of one of them missing the cache for every element.
+template <bool in_place, class Op, class Index, class... Operands>
+static void run_tiled(Op &&op, const Index &index,
+                      const scipp::index band_begin,
+                      const scipp::index band_end, Operands &&...operands) {
+  constexpr auto N = sizeof...(Operands);
+  const auto ncol = index.shape(0);
+  const auto nrow = index.shape(1);
+  const auto nband = (nrow + tile_size - 1) / tile_size;
+  const auto &col_strides = index.strides(0);
+  const auto &row_strides = index.strides(1);
+  for (scipp::index band = band_begin; band < band_end; ++band) {
+    std::array<scipp::index, N> base{};
+    auto outer = band / nband;
+    for (scipp::index dim = 2; dim < index.ndim(); ++dim) {
+      const auto coord = outer % index.shape(dim);
+      outer /= index.shape(dim);
+      for (size_t data = 0; data < N; ++data)
+        base[data] += coord * index.strides(dim)[data];
+    }
+    const auto row_begin = (band % nband) * tile_size;
+    const auto row_end = std::min(nrow, row_begin + tile_size);
+    for (scipp::index col = 0; col < ncol; col += tile_size) {
+      const auto n = std::min(tile_size, ncol - col);
+      for (scipp::index row = row_begin; row < row_end; ++row) {
+        auto indices = base;
+        for (size_t data = 0; data < N; ++data)
+          indices[data] += row * row_strides[data] + col * col_strides[data];
+        dispatch_inner_loop<in_place>(op, indices, col_strides, n,
+                                      std::forward<Operands>(operands)...);
+      }
+    }
+  }
+}
+
+/// Run `run_tiled` in parallel, threading over bands of rows.
+template <bool in_place, class Op, class Index, class... Operands>
+static void run_tiled_parallel(Op &&op, const Index &index,
+                               Operands &&...operands) {
+  const auto nband = tile_band_count(index);
+  const auto grain = core::parallel::grainsize(
+      nband, tile_size * index.shape(0) * element_bytes<Operands...>());
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, nband, grain), [&](const auto &range) {
+        run_tiled<in_place>(op, index, range.begin(), range.end(),
+                            std::forward<Operands>(operands)...);
+      });
+}
+
 template <class Op, class Out, class... Ts>
 static void transform_elements(Op op, Out &&out, Ts &&...other) {
+  if (is_flat(out, other...))
+    return run_flat<false>(op, out.size(), std::forward<Out>(out),
+                           std::forward<Ts>(other)...);
   const auto begin =
       core::MultiIndex(array_params(out), array_params(other)...);
+  if (begin.prefers_tiling())
+    return run_tiled_parallel<false>(op, begin, std::forward<Out>(out),
+                                     std::forward<Ts>(other)...);
 
   auto run = [&](auto &indices, const auto &end) {
     const auto inner_strides = indices.inner_strides();
@@ -264,8 +399,9 @@ static void transform_elements(Op op, Out &&out, Ts &&...other) {
     end.set_index(range.end());
     run(indices, end);
   };
-  core::parallel::parallel_for(core::parallel::blocked_range(0, out.size()),
-                               run_parallel);
+  const auto grain = grainsize<Out, Ts...>(out.size(), begin);
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, out.size(), grain), run_parallel);
 }
 
 template <class T> static constexpr auto maybe_eval(T &&_) {
@@ -440,10 +576,17 @@ template <bool dry_run> struct in_place {
   template <class Op, class T, class... Ts>
   static void transform_in_place_impl(Op op, T &&arg, Ts &&...other) {
     using namespace detail;
+    if constexpr (!dry_run)
+      if (is_flat(arg, other...))
+        return run_flat<true>(op, arg.size(), std::forward<T>(arg),
+                              std::forward<Ts>(other)...);
     const auto begin =
         core::MultiIndex(array_params(arg), array_params(other)...);
     if constexpr (dry_run)
       return;
+    if (!begin.has_stride_zero() && begin.prefers_tiling())
+      return detail::run_tiled_parallel<true>(op, begin, std::forward<T>(arg),
+                                              std::forward<Ts>(other)...);
 
     auto run = [&](auto &indices, const auto &end) {
       const auto inner_strides = indices.inner_strides();
@@ -473,8 +616,9 @@ template <bool dry_run> struct in_place {
         end.set_index(range.end());
         run(indices, end);
       };
-      core::parallel::parallel_for(core::parallel::blocked_range(0, arg.size()),
-                                   run_parallel);
+      const auto grain = detail::grainsize<T, Ts...>(arg.size(), begin);
+      core::parallel::parallel_for(
+          core::parallel::blocked_range(0, arg.size(), grain), run_parallel);
     }
   }
 
@@ -608,6 +752,8 @@ template <bool dry_run> struct in_place {
     op(unit, variableFactory().elem_unit(other)...);
     // Stop early in bad cases of changing units (if `var` is a slice):
     variableFactory().expect_can_set_elem_unit(var, unit);
+    if constexpr (!dry_run)
+      (share_storage(other, var), ...);
     // Wrapped implementation to convert multiple tuples into a parameter pack.
     transform_data(type_tuples<Ts...>(op), op, name, std::forward<Var>(var),
                    other...);
@@ -20,6 +20,8 @@ namespace scipp::variable {
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable islinspace(const Variable &var,
                                                         const Dim dim);
 
+SCIPP_VARIABLE_EXPORT Variable &mark_linspace(Variable &var);
+
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
 issorted(const Variable &x, const Dim dim,
          const SortOrder order = SortOrder::Ascending);
@@ -38,6 +40,10 @@ SCIPP_VARIABLE_EXPORT void fill(Variable &var, const Variable &value);
 
 SCIPP_VARIABLE_EXPORT void fill_zeros(Variable &var);
 
+/// True if the elements of `var` are stored contiguously in memory in the
+/// order of its dims.
+[[nodiscard]] SCIPP_VARIABLE_EXPORT bool is_contiguous(const Variable &var);
+
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable where(const Variable &condition,
                                                    const Variable &x,
                                                    const Variable &y);
@@ -207,8 +207,10 @@ Variable Variable::construct(const DType &type, Args &&...args) {
 template <class... Ts>
 Variable::Variable(const DType &type, Ts &&...args)
     : Variable{construct<double, float, int64_t, int32_t, bool, std::string,
-                         scipp::core::time_point>(type,
-                                                  std::forward<Ts>(args)...)} {}
+                         scipp::core::time_point, int16_t, int8_t, uint64_t,
+                         uint32_t, uint16_t, uint8_t, scipp::core::float16,
+                         scipp::core::categorical_string, std::string_view>(
+          type, std::forward<Ts>(args)...)} {}
 
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable copy(const Variable &var);
 [[maybe_unused]] SCIPP_VARIABLE_EXPORT Variable &copy(const Variable &var,
@@ -216,6 +218,8 @@ Variable::Variable(const DType &type, Ts &&...args)
 [[maybe_unused]] SCIPP_VARIABLE_EXPORT Variable copy(const Variable &var,
                                                      Variable &&out);
 
+SCIPP_VARIABLE_EXPORT void share_storage(const Variable &src, Variable &dest);
+
 [[nodiscard]] SCIPP_VARIABLE_EXPORT bool equals_nan(const Variable &a,
                                                     const Variable &b);
 } // namespace scipp::variable
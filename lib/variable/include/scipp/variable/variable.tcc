@@ -55,7 +55,7 @@ template <class T>
 auto make_model(const units::Unit unit, const Dimensions &dimensions,
                 element_array<T> values,
                 std::optional<element_array<T>> variances) {
-  if constexpr (std::is_same_v<model_t<T>, ElementArrayModel<T>>) {
+  if constexpr (std::is_base_of_v<ElementArrayModel<T>, model_t<T>>) {
     return std::make_unique<model_t<T>>(
         dimensions.volume(), unit, std::move(values), std::move(variances));
   } else {
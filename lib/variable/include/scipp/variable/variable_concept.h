@@ -6,9 +6,11 @@
 
 #include "scipp-variable_export.h"
 #include "scipp/common/index.h"
+#include "scipp/common/span.h"
 #include "scipp/core/dimensions.h"
 #include "scipp/core/dtype.h"
 #include "scipp/units/unit.h"
+#include "scipp/variable/property_cache.h"
 
 #include <memory>
 
@@ -54,16 +56,30 @@ public:
   virtual bool equals_nan(const Variable &a, const Variable &b) const = 0;
   virtual void copy(const Variable &src, Variable &dest) const = 0;
   virtual void copy(const Variable &src, Variable &&dest) const = 0;
+  /// Copy each of `src` into the corresponding `dest`. Equivalent to calling
+  /// `copy` for every pair, but implementations may combine the copies.
+  virtual void copy_batch(scipp::span<const Variable> src,
+                          scipp::span<Variable> dest) const;
   virtual void assign(const VariableConcept &other) = 0;
+  /// Keep storage referred to by the elements of `other` alive as long as
+  /// this, e.g., the characters of string_view elements. Called before
+  /// elements of `other` are written into this. No-op by default, for
+  /// elements that do not refer to external storage.
+  virtual void share_storage(const VariableConcept &other);
   virtual scipp::index dtype_size() const = 0;
   virtual scipp::index object_size() const = 0;
 
   virtual const VariableConceptHandle &bin_indices() const = 0;
 
+  /// Memoized properties of the elements. Implementations must clear the
+  /// cache on mutable access to the elements.
+  PropertyCache &property_cache() const noexcept { return m_property_cache; }
+
   friend class Variable;
 
 private:
   units::Unit m_unit;
+  mutable PropertyCache m_property_cache;
 };
 
 } // namespace scipp::variable
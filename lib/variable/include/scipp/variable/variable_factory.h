@@ -92,6 +92,8 @@ public:
   void set_elem_unit(Variable &var, const units::Unit &u) const;
   bool has_masks(const Variable &var) const;
   bool has_variances(const Variable &var) const;
+  /// Return the data of the buffer underlying a binned variable.
+  [[nodiscard]] const Variable &data(const Variable &var) const;
   template <class T, class Var> auto values(Var &&var) const {
     if (!is_bins(var))
       return var.template values<T>();
@@ -35,6 +35,22 @@ Variable copy(const Variable &var, Variable &&out) {
   return std::move(out);
 }
 
+/// Keep storage referred to by the elements of `src` alive as long as `dest`,
+/// see VariableConcept::share_storage. For binned variables this applies to
+/// the buffers. Called by transform_in_place for all inputs, so writing
+/// elements of `src` into `dest` in any other way requires calling this first.
+void share_storage(const Variable &src, Variable &dest) {
+  if (is_bins(src) || is_bins(dest)) {
+    if (is_bins(src) && is_bins(dest)) {
+      // Copy of the buffer, which shares the underlying model.
+      Variable buffer = variableFactory().data(dest);
+      share_storage(variableFactory().data(src), buffer);
+    }
+  } else if (src.dtype() == dest.dtype()) {
+    dest.data().share_storage(src.data());
+  }
+}
+
 namespace geometry {
 Variable position(const Variable &x, const Variable &y, const Variable &z) {
   return transform(x, y, z, element::geometry::position, "position");
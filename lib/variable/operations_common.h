@@ -17,6 +17,28 @@ SCIPP_VARIABLE_EXPORT Variable mean_impl(const Variable &var, const Dim dim,
                                          const Variable &masks_sum);
 SCIPP_VARIABLE_EXPORT Variable nanmean_impl(const Variable &var, const Dim dim,
                                             const Variable &masks_sum);
+SCIPP_VARIABLE_EXPORT Variable masked_sum(const Variable &var, const Dim dim,
+                                          const Variable &mask);
+SCIPP_VARIABLE_EXPORT Variable masked_nansum(const Variable &var,
+                                             const Dim dim,
+                                             const Variable &mask);
+SCIPP_VARIABLE_EXPORT Variable masked_sum(const Variable &var,
+                                          const scipp::span<const Dim> dims,
+                                          const Variable &mask);
+SCIPP_VARIABLE_EXPORT Variable masked_nansum(const Variable &var,
+                                             const scipp::span<const Dim> dims,
+                                             const Variable &mask);
+SCIPP_VARIABLE_EXPORT Variable quantile_impl(const Variable &var, const Dim dim,
+                                             const double q,
+                                             const bool skip_nan,
+                                             const Variable &mask = {});
+SCIPP_VARIABLE_EXPORT Variable argmin_impl(const Variable &var, const Dim dim,
+                                           const Variable &mask = {});
+SCIPP_VARIABLE_EXPORT Variable argmax_impl(const Variable &var, const Dim dim,
+                                           const Variable &mask = {});
+SCIPP_VARIABLE_EXPORT Variable topk_impl(const Variable &var,
+                                         const scipp::index k, const Dim dim,
+                                         const Variable &mask = {});
 
 template <class T> T normalize_impl(const T &numerator, T denominator) {
   // Numerator may be an int or a Eigen::Vector3d => use double
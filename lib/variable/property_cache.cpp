@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include "scipp/variable/property_cache.h"
+#include "scipp/variable/variable.h"
+
+namespace scipp::variable {
+
+PropertyCache::PropertyCache(const PropertyCache &other) { *this = other; }
+
+PropertyCache &PropertyCache::operator=(const PropertyCache &other) {
+  if (this == &other)
+    return *this;
+  if (!enabled())
+    return *this;
+  if (!other.m_active.load(std::memory_order_relaxed)) {
+    clear();
+    return *this;
+  }
+  const auto source = other.generation();
+  const auto target = generation();
+  for (size_t i = 0; i < n_property; ++i)
+    m_state[i].store(other.m_state[i].load());
+  set_min(other.min(), target);
+  set_max(other.max(), target);
+  // `other` was cleared while copying, parts of the copy may be outdated.
+  if (other.generation() != source)
+    clear();
+  return *this;
+}
+
+uint64_t PropertyCache::generation() const noexcept {
+  m_active.store(true);
+  return m_generation.load();
+}
+
+std::optional<bool> PropertyCache::get(const Property property) const noexcept {
+  switch (m_state[static_cast<size_t>(property)].load()) {
+  case State::False:
+    return false;
+  case State::True:
+    return true;
+  default:
+    return std::nullopt;
+  }
+}
+
+// The setters store first and check the generation afterwards. `clear`
+// increments the generation before resetting, so a value stored concurrently
+// with `clear` is either reset by `clear` or by the setter itself.
+
+void PropertyCache::set(const Property property, const bool value,
+                        const uint64_t generation) noexcept {
+  if (!enabled())
+    return;
+  auto &state = m_state[static_cast<size_t>(property)];
+  state.store(value ? State::True : State::False);
+  if (this->generation() != generation)
+    state.store(State::Unknown);
+}
+
+std::shared_ptr<const Variable> PropertyCache::min() const noexcept {
+  return std::atomic_load(&m_min);
+}
+
+std::shared_ptr<const Variable> PropertyCache::max() const noexcept {
+  return std::atomic_load(&m_max);
+}
+
+void PropertyCache::set_min(std::shared_ptr<const Variable> min,
+                            const uint64_t generation) noexcept {
+  if (!enabled())
+    return;
+  std::atomic_store(&m_min, std::move(min));
+  if (this->generation() != generation)
+    std::atomic_store(&m_min, std::shared_ptr<const Variable>{});
+}
+
+void PropertyCache::set_max(std::shared_ptr<const Variable> max,
+                            const uint64_t generation) noexcept {
+  if (!enabled())
+    return;
+  std::atomic_store(&m_max, std::move(max));
+  if (this->generation() != generation)
+    std::atomic_store(&m_max, std::shared_ptr<const Variable>{});
+}
+
+// Relaxed is sufficient: a `generation` that is not ordered before this call
+// by other means belongs to a computation concurrent with the modification,
+// which is undefined anyway.
+void PropertyCache::clear() noexcept {
+  if (!m_active.load(std::memory_order_relaxed))
+    return;
+  ++m_generation;
+  for (auto &state : m_state)
+    state.store(State::Unknown);
+  std::atomic_store(&m_min, std::shared_ptr<const Variable>{});
+  std::atomic_store(&m_max, std::shared_ptr<const Variable>{});
+}
+
+void PropertyCache::disable() noexcept {
+  m_disabled.store(true);
+  clear();
+}
+
+bool PropertyCache::enabled() const noexcept { return !m_disabled.load(); }
+
+} // namespace scipp::variable
@@ -64,7 +64,11 @@ void rebin_non_inner(const Dim dim, const Variable &oldT,
       accumulate_bin(newT.slice({dim, inew}), xn_low, xn_high);
     }
   };
-  core::parallel::parallel_for(core::parallel::blocked_range(0, newSize),
+  // Every output bin accumulates a slice of the input.
+  const auto grain = core::parallel::grainsize(
+      newSize, oldT.dims().volume() / std::max(newSize, scipp::index(1)) *
+                   scipp::index(sizeof(double)));
+  core::parallel::parallel_for(core::parallel::blocked_range(0, newSize, grain),
                                accumulate_bins);
 }
 
@@ -2,18 +2,28 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <atomic>
+
 #include "scipp/variable/reduction.h"
 #include "scipp/core/dtype.h"
+#include "scipp/core/element/arg_reduction.h"
 #include "scipp/core/element/arithmetic.h"
 #include "scipp/core/element/comparison.h"
 #include "scipp/core/element/logical.h"
+#include "scipp/core/element/quantile.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/tag_util.h"
 #include "scipp/variable/accumulate.h"
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/astype.h"
 #include "scipp/variable/bins.h"
 #include "scipp/variable/creation.h"
+#include "scipp/variable/shape.h"
 #include "scipp/variable/special_values.h"
+#include "scipp/variable/subspan_view.h"
+#include "scipp/variable/transform.h"
 #include "scipp/variable/util.h"
+#include "scipp/variable/variable_concept.h"
 #include "scipp/variable/variable_factory.h"
 
 #include "operations_common.h"
@@ -46,6 +56,38 @@ Variable reduce_dim(const Variable &var, const Dim dim,
   return reduce_to_dims(var, dims, op, init);
 }
 
+/// Reduce all of `dims` in a single accumulation pass into the final output,
+/// avoiding intermediate results of one reduction per dim.
+Variable reduce_dims(const Variable &var, const scipp::span<const Dim> dims,
+                     void (*const op)(Variable &, const Variable &),
+                     const FillValue init) {
+  auto target_dims = var.dims();
+  for (const auto dim : dims)
+    target_dims.erase(dim);
+  return reduce_to_dims(var, target_dims, op, init);
+}
+
+/// Reduce all dims of `var` using `op(var, dims)`. As in `reduce_all_dims`
+/// dense scalars are returned unchanged.
+template <class Op> Variable reduce_all(const Variable &var, const Op &op) {
+  if (var.dims().empty() && !is_bins(var))
+    return copy(var);
+  return op(var, var.dims().labels());
+}
+
+Variable reduce_masked(const Variable &var, const scipp::span<const Dim> dims,
+                       const Variable &mask,
+                       void (*const op)(Variable &, const Variable &,
+                                        const Variable &),
+                       const FillValue init) {
+  auto target_dims = var.dims();
+  for (const auto dim : dims)
+    target_dims.erase(dim);
+  auto accum = dense_special_like(var, target_dims, init);
+  op(accum, var, mask);
+  return accum;
+}
+
 Variable reduce_bins(const Variable &data,
                      void (*const op)(Variable &, const Variable &),
                      const FillValue init) {
@@ -65,14 +107,61 @@ Variable nansum(const Variable &var, const Dim dim) {
   return reduce_dim(var, dim, nansum_into, FillValue::ZeroNotBool);
 }
 
+/// Return the sum along given dimension, skipping elements where `mask` is
+/// true. `mask` must not depend on dimensions that `var` does not have.
+Variable masked_sum(const Variable &var, const Dim dim, const Variable &mask) {
+  return masked_sum(var, scipp::span{&dim, 1}, mask);
+}
+
+/// Return the sum along given dimension, skipping NaN values and elements
+/// where `mask` is true.
+Variable masked_nansum(const Variable &var, const Dim dim,
+                       const Variable &mask) {
+  return masked_nansum(var, scipp::span{&dim, 1}, mask);
+}
+
+/// Return the sum along all of the given dimensions, skipping elements where
+/// `mask` is true.
+Variable masked_sum(const Variable &var, const scipp::span<const Dim> dims,
+                    const Variable &mask) {
+  return reduce_masked(var, dims, mask, masked_sum_into,
+                       FillValue::ZeroNotBool);
+}
+
+/// Return the sum along all of the given dimensions, skipping NaN values and
+/// elements where `mask` is true.
+Variable masked_nansum(const Variable &var, const scipp::span<const Dim> dims,
+                       const Variable &mask) {
+  return reduce_masked(var, dims, mask, masked_nansum_into,
+                       FillValue::ZeroNotBool);
+}
+
+/// Return the sum along all of the given dimensions.
+Variable sum(const Variable &var, const scipp::span<const Dim> dims) {
+  return reduce_dims(var, dims, sum_into, FillValue::ZeroNotBool);
+}
+
+/// Return the sum along all of the given dimensions, nans treated as zero.
+Variable nansum(const Variable &var, const scipp::span<const Dim> dims) {
+  return reduce_dims(var, dims, nansum_into, FillValue::ZeroNotBool);
+}
+
 Variable any(const Variable &var, const Dim dim) {
   return reduce_dim(var, dim, any_into, FillValue::False);
 }
 
+Variable any(const Variable &var, const scipp::span<const Dim> dims) {
+  return reduce_dims(var, dims, any_into, FillValue::False);
+}
+
 Variable all(const Variable &var, const Dim dim) {
   return reduce_dim(var, dim, all_into, FillValue::True);
 }
 
+Variable all(const Variable &var, const scipp::span<const Dim> dims) {
+  return reduce_dims(var, dims, all_into, FillValue::True);
+}
+
 /// Return the maximum along given dimension.
 ///
 /// Variances are not considered when determining the maximum. If present, the
@@ -81,6 +170,10 @@ Variable max(const Variable &var, const Dim dim) {
   return reduce_dim(var, dim, max_into, FillValue::Lowest);
 }
 
+Variable max(const Variable &var, const scipp::span<const Dim> dims) {
+  return reduce_dims(var, dims, max_into, FillValue::Lowest);
+}
+
 /// Return the maximum along given dimension ignoring NaN values.
 ///
 /// Variances are not considered when determining the maximum. If present, the
@@ -89,6 +182,10 @@ Variable nanmax(const Variable &var, const Dim dim) {
   return reduce_dim(var, dim, nanmax_into, FillValue::Lowest);
 }
 
+Variable nanmax(const Variable &var, const scipp::span<const Dim> dims) {
+  return reduce_dims(var, dims, nanmax_into, FillValue::Lowest);
+}
+
 /// Return the minimum along given dimension.
 ///
 /// Variances are not considered when determining the minimum. If present, the
@@ -97,6 +194,10 @@ Variable min(const Variable &var, const Dim dim) {
   return reduce_dim(var, dim, min_into, FillValue::Max);
 }
 
+Variable min(const Variable &var, const scipp::span<const Dim> dims) {
+  return reduce_dims(var, dims, min_into, FillValue::Max);
+}
+
 /// Return the minimum along given dimension ignorning NaN values.
 ///
 /// Variances are not considered when determining the minimum. If present, the
@@ -105,6 +206,10 @@ Variable nanmin(const Variable &var, const Dim dim) {
   return reduce_dim(var, dim, nanmin_into, FillValue::Max);
 }
 
+Variable nanmin(const Variable &var, const scipp::span<const Dim> dims) {
+  return reduce_dims(var, dims, nanmin_into, FillValue::Max);
+}
+
 Variable mean_impl(const Variable &var, const Dim dim, const Variable &count) {
   return normalize_impl(sum(var, dim), count);
 }
@@ -141,6 +246,20 @@ template <class... Dim> Variable count(const Variable &var, Dim &&...dim) {
   return sum(end - begin, dim...);
 }
 
+Variable count(const Variable &var, const scipp::span<const Dim> dims) {
+  if (!is_bins(var)) {
+    scipp::index volume = 1;
+    for (const auto dim : dims)
+      volume *= var.dims()[dim];
+    return volume * units::none;
+  }
+  if (const auto unmasked = unmasked_events(var); unmasked.is_valid()) {
+    return sum(unmasked, dims);
+  }
+  const auto [begin, end] = unzip(var.bin_indices());
+  return sum(end - begin, dims);
+}
+
 Variable bins_count(const Variable &data) {
   if (const auto unmasked = unmasked_events(data); unmasked.is_valid()) {
     return bins_sum(unmasked);
@@ -157,44 +276,88 @@ Variable nanmean(const Variable &var, const Dim dim) {
   return nanmean_impl(var, dim, sum(isfinite(var), dim));
 }
 
+/// Return the mean along all of the given dimensions.
+Variable mean(const Variable &var, const scipp::span<const Dim> dims) {
+  return normalize_impl(sum(var, dims), count(var, dims));
+}
+
+/// Return the mean along all of the given dimensions, ignoring NaN values.
+Variable nanmean(const Variable &var, const scipp::span<const Dim> dims) {
+  return normalize_impl(nansum(var, dims), sum(isfinite(var), dims));
+}
+
 /// Return the sum along all dimensions.
 Variable sum(const Variable &var) {
-  return reduce_all_dims(var, [](auto &&..._) { return sum(_...); });
+  return reduce_all(var, [](auto &&..._) { return sum(_...); });
 }
 
 /// Return the sum along all dimensions, nans treated as zero.
 Variable nansum(const Variable &var) {
-  return reduce_all_dims(var, [](auto &&..._) { return nansum(_...); });
+  return reduce_all(var, [](auto &&..._) { return nansum(_...); });
+}
+
+namespace {
+/// As `reduce_all`, but memoize the result in the property cache of the buffer
+/// if `var` views the whole buffer. Only for reductions that do not depend on
+/// the order of elements, i.e., `min` and `max`.
+template <class Op>
+Variable reduce_all_memoized(const Variable &var, const bool minimum,
+                             const Op &op) {
+  if (var.dims().empty() || is_bins(var) || var.has_variances() ||
+      var.is_slice())
+    return reduce_all(var, op);
+  auto &cache = var.data().property_cache();
+  if (const auto known = minimum ? cache.min() : cache.max()) {
+    auto out = copy(*known);
+    out.setUnit(var.unit()); // the unit may have been changed since
+    return out;
+  }
+  const auto generation = cache.generation();
+  auto out = reduce_all(var, op);
+  auto memo = std::make_shared<const Variable>(copy(out));
+  if (minimum)
+    cache.set_min(std::move(memo), generation);
+  else
+    cache.set_max(std::move(memo), generation);
+  return out;
 }
+} // namespace
 
 /// Return the maximum along all dimensions.
+///
+/// The result is memoized, repeated calls are O(1) unless the variable is
+/// modified in the meantime.
 Variable max(const Variable &var) {
-  return reduce_all_dims(var, [](auto &&..._) { return max(_...); });
+  return reduce_all_memoized(var, false,
+                             [](auto &&..._) { return max(_...); });
 }
 
 /// Return the maximum along all dimensions ignorning NaN values.
 Variable nanmax(const Variable &var) {
-  return reduce_all_dims(var, [](auto &&..._) { return nanmax(_...); });
+  return reduce_all(var, [](auto &&..._) { return nanmax(_...); });
 }
 
 /// Return the minimum along all dimensions.
+///
+/// The result is memoized, repeated calls are O(1) unless the variable is
+/// modified in the meantime.
 Variable min(const Variable &var) {
-  return reduce_all_dims(var, [](auto &&..._) { return min(_...); });
+  return reduce_all_memoized(var, true, [](auto &&..._) { return min(_...); });
 }
 
 /// Return the minimum along all dimensions ignoring NaN values.
 Variable nanmin(const Variable &var) {
-  return reduce_all_dims(var, [](auto &&..._) { return nanmin(_...); });
+  return reduce_all(var, [](auto &&..._) { return nanmin(_...); });
 }
 
 /// Return the logical AND along all dimensions.
 Variable all(const Variable &var) {
-  return reduce_all_dims(var, [](auto &&..._) { return all(_...); });
+  return reduce_all(var, [](auto &&..._) { return all(_...); });
 }
 
 /// Return the logical OR along all dimensions.
 Variable any(const Variable &var) {
-  return reduce_all_dims(var, [](auto &&..._) { return any(_...); });
+  return reduce_all(var, [](auto &&..._) { return any(_...); });
 }
 
 /// Return the mean along all dimensions.
@@ -257,6 +420,429 @@ Variable bins_nanmean(const Variable &data) {
   return normalize_impl(bins_nansum(data), bins_sum(isfinite(data)));
 }
 
+namespace {
+void expect_valid_quantile(const double q) {
+  if (!(q >= 0.0 && q <= 1.0))
+    throw std::invalid_argument("Quantile must be in the range [0, 1], got " +
+                                std::to_string(q) + '.');
+}
+
+/// Return `var`, or a copy with `dim` transposed to the inner dimension if
+/// `var` is not contiguous along `dim`, as required by `subspan_view`.
+Variable contiguous_along(const Variable &var, const Dim dim) {
+  if (var.stride(dim) == 1)
+    return var;
+  std::vector<Dim> order;
+  for (const auto &label : var.dims())
+    if (label != dim)
+      order.push_back(label);
+  order.push_back(dim);
+  return copy(transpose(var, order));
+}
+
+Variable select_quantile(const double q, const bool skip_nan,
+                         const Variable &var) {
+  if (skip_nan)
+    return variable::transform(var, element::make_quantile<true>(q),
+                               "nanquantile");
+  return variable::transform(var, element::make_quantile<false>(q),
+                             "quantile");
+}
+
+Variable select_quantile(const double q, const bool skip_nan,
+                         const Variable &var, const Variable &mask) {
+  if (skip_nan)
+    return variable::transform(var, mask,
+                               element::make_masked_quantile<true>(q),
+                               "nanquantile");
+  return variable::transform(var, mask, element::make_masked_quantile<false>(q),
+                             "quantile");
+}
+
+// Full reductions yield a single output element, i.e., `transform` cannot
+// parallelize them. Above this size we therefore use a parallel sample-select.
+std::atomic<scipp::index> parallel_select_limit{16777216};
+
+/// Values and mask of a full reduction. The mask of element `i` is
+/// `mask[i / block]`, i.e., the mask is not broadcast to the values.
+template <class T> struct MaskedValues {
+  scipp::span<const T> values;
+  scipp::span<const bool> mask;
+  scipp::index block;
+
+  [[nodiscard]] bool masked(const scipp::index i) const {
+    return !mask.empty() && mask[i / block];
+  }
+
+  /// Call `op(i)` for all unmasked `i` in [begin, end).
+  template <class Op>
+  void for_each_unmasked(scipp::index begin, const scipp::index end,
+                         Op &&op) const {
+    if (mask.empty()) {
+      for (scipp::index i = begin; i < end; ++i)
+        op(i);
+      return;
+    }
+    while (begin < end) {
+      const auto m = begin / block;
+      const auto run_end = std::min(end, (m + 1) * block);
+      if (!mask[m])
+        for (scipp::index i = begin; i < run_end; ++i)
+          op(i);
+      begin = run_end;
+    }
+  }
+};
+
+/// Return the q-quantile of all unmasked elements of `data`.
+template <class T>
+double serial_quantile(const MaskedValues<T> &data, const double q,
+                       const bool skip_nan) {
+  const auto &values = data.values;
+  std::vector<T> selected;
+  selected.reserve(values.size());
+  bool nan = false;
+  data.for_each_unmasked(0, scipp::size(values), [&](const scipp::index i) {
+    if (numeric::isnan(values[i]))
+      nan = true;
+    else
+      selected.push_back(values[i]);
+  });
+  if (nan && !skip_nan)
+    return std::numeric_limits<double>::quiet_NaN();
+  return element::quantile_detail::select(selected, q);
+}
+
+/// Return the q-quantile of all unmasked elements of `data`.
+///
+/// A regular sample of the input is sorted to find two pivots that bracket the
+/// requested rank with high probability. A parallel pass then counts the
+/// elements below the lower pivot and collects the (few) elements between the
+/// pivots, so the final selection runs only on these candidates. If the
+/// pivots do not bracket the rank we fall back to a selection over all
+/// elements, i.e., the result is always exact.
+template <class T>
+double parallel_quantile(const MaskedValues<T> &data, const double q,
+                         const bool skip_nan) {
+  const auto &values = data.values;
+  const auto size = scipp::size(values);
+  const scipp::index nchunk = core::parallel::max_threads();
+  const auto chunk_size = (size + nchunk - 1) / nchunk;
+  const auto for_each_chunk = [&](auto &&op) {
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, nchunk, 1), [&](const auto &range) {
+          for (scipp::index c = range.begin(); c < range.end(); ++c)
+            op(c, std::min(c * chunk_size, size),
+               std::min((c + 1) * chunk_size, size));
+        });
+  };
+
+  std::vector<scipp::index> valid(nchunk);
+  std::vector<scipp::index> nans(nchunk);
+  for_each_chunk([&](const auto c, const auto begin, const auto end) {
+    data.for_each_unmasked(begin, end, [&](const scipp::index i) {
+      ++(numeric::isnan(values[i]) ? nans[c] : valid[c]);
+    });
+  });
+  constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+  const auto n = std::accumulate(valid.begin(), valid.end(), scipp::index{0});
+  if (n == 0 ||
+      (!skip_nan && std::any_of(nans.begin(), nans.end(),
+                                [](const auto count) { return count > 0; })))
+    return nan;
+  const double pos = q * static_cast<double>(n - 1);
+  const auto rank = static_cast<scipp::index>(std::floor(pos));
+  const double frac = pos - static_cast<double>(rank);
+  const auto last_rank = frac > 0.0 ? rank + 1 : rank;
+
+  std::vector<T> sample;
+  const auto sample_stride = std::max(size / 262144, scipp::index{1});
+  for (scipp::index i = 0; i < size; i += sample_stride)
+    if (!data.masked(i) && !numeric::isnan(values[i]))
+      sample.push_back(values[i]);
+  std::sort(sample.begin(), sample.end());
+  // The rank of the quantile within the sample follows a binomial
+  // distribution, its standard deviation is bounded by sqrt(N)/2. Use a margin
+  // of about 6 sigma on either side.
+  const auto nsample = scipp::size(sample);
+  const auto margin =
+      static_cast<scipp::index>(3.0 * std::sqrt(static_cast<double>(nsample)));
+  const auto center = static_cast<scipp::index>(
+      static_cast<double>(rank) / static_cast<double>(n) *
+      static_cast<double>(nsample));
+  const bool open_low = center - margin < 0;
+  const bool open_high = center + margin + 1 >= nsample;
+  const T low = open_low ? T{} : sample[center - margin];
+  const T high = open_high ? T{} : sample[center + margin + 1];
+
+  std::vector<scipp::index> below(nchunk);
+  std::vector<std::vector<T>> candidates(nchunk);
+  for_each_chunk([&](const auto c, const auto begin, const auto end) {
+    data.for_each_unmasked(begin, end, [&](const scipp::index i) {
+      if (numeric::isnan(values[i]))
+        return;
+      if (!open_low && values[i] < low)
+        ++below[c];
+      else if (open_high || values[i] <= high)
+        candidates[c].push_back(values[i]);
+    });
+  });
+  const auto nbelow =
+      std::accumulate(below.begin(), below.end(), scipp::index{0});
+  std::vector<T> selected;
+  for (const auto &chunk : candidates)
+    selected.insert(selected.end(), chunk.begin(), chunk.end());
+  if (nbelow > rank || nbelow + scipp::size(selected) <= last_rank)
+    // Unlikely: pivots do not bracket the rank, select from all elements.
+    return serial_quantile(data, q, true);
+  const auto nth = selected.begin() + (rank - nbelow);
+  std::nth_element(selected.begin(), nth, selected.end());
+  const auto lo = static_cast<double>(*nth);
+  if (frac == 0.0)
+    return lo;
+  const auto hi =
+      static_cast<double>(*std::min_element(nth + 1, selected.end()));
+  return lo + frac * (hi - lo);
+}
+
+template <class T> struct FullQuantile {
+  static Variable apply(const Variable &flat, const Variable &mask,
+                        const double q, const bool skip_nan) {
+    const auto values = contiguous_along(flat, flat.dims().inner());
+    const MaskedValues<T> data{
+        values.values<T>().as_span(),
+        mask.is_valid() ? mask.values<bool>().as_span()
+                        : scipp::span<const bool>{},
+        mask.is_valid() ? flat.dims().volume() / mask.dims().volume() : 1};
+    const auto result = flat.dims().volume() >= parallel_select_limit
+                            ? parallel_quantile(data, q, skip_nan)
+                            : serial_quantile(data, q, skip_nan);
+    return makeVariable<element::quantile_detail::result_t<T>>(
+        Values{static_cast<element::quantile_detail::result_t<T>>(result)},
+        flat.unit());
+  }
+};
+
+using QuantileTypes = core::CallDType<double, float, int64_t, int32_t>;
+
+bool supports_quantile(const DType type) {
+  return type == dtype<double> || type == dtype<float> ||
+         type == dtype<int64_t> || type == dtype<int32_t>;
+}
+} // namespace
+
+namespace detail {
+scipp::index parallel_quantile_min_size() { return parallel_select_limit; }
+
+void set_parallel_quantile_min_size(const scipp::index size) {
+  parallel_select_limit = size;
+}
+} // namespace detail
+
+/// Return the q-quantile along `dim`, or along all dimensions if `dim` is
+/// Dim::Invalid. Elements where the optional `mask` is true are skipped.
+Variable quantile_impl(const Variable &var, const Dim dim, const double q,
+                       const bool skip_nan, const Variable &mask) {
+  expect_valid_quantile(q);
+  if (is_bins(var))
+    throw except::BinnedDataError(
+        "Quantiles of binned data are only supported within bins, use, e.g., "
+        "bins_median or `da.bins.median()` instead.");
+  if (dim == Dim::Invalid) {
+    const Dim flat_dim = Dim::InternalAccumulate;
+    if (var.has_variances() || !supports_quantile(var.dtype()))
+      // Raises the appropriate error.
+      return quantile_impl(flatten(var, var.dims().labels(), flat_dim),
+                           flat_dim, q, skip_nan);
+    // Move the dims of the mask to the outside, such that every mask element
+    // applies to a contiguous block of the flattened values.
+    std::vector<Dim> order;
+    if (mask.is_valid())
+      for (const auto &label : mask.dims())
+        order.push_back(label);
+    for (const auto &label : var.dims())
+      if (!mask.is_valid() || !mask.dims().contains(label))
+        order.push_back(label);
+    const auto flat = flatten(transpose(var, order), order, flat_dim);
+    return QuantileTypes::apply<FullQuantile>(
+        var.dtype(), flat, mask.is_valid() ? copy(mask) : mask, q, skip_nan);
+  }
+  const auto data = subspan_view(contiguous_along(var, dim), dim);
+  if (mask.is_valid() && mask.dims().contains(dim))
+    return select_quantile(q, skip_nan, data,
+                           subspan_view(contiguous_along(mask, dim), dim));
+  return select_quantile(q, skip_nan, data);
+}
+
+/// Return the median along all dimensions.
+Variable median(const Variable &var) {
+  return quantile_impl(var, Dim::Invalid, 0.5, false);
+}
+
+/// Return the median along given dimension.
+Variable median(const Variable &var, const Dim dim) {
+  return quantile_impl(var, dim, 0.5, false);
+}
+
+/// Return the median along all dimensions ignoring NaN values.
+Variable nanmedian(const Variable &var) {
+  return quantile_impl(var, Dim::Invalid, 0.5, true);
+}
+
+/// Return the median along given dimension ignoring NaN values.
+Variable nanmedian(const Variable &var, const Dim dim) {
+  return quantile_impl(var, dim, 0.5, true);
+}
+
+/// Return the q-quantile along all dimensions.
+///
+/// Uses linear interpolation between the closest ranks, i.e., the same
+/// definition as numpy.quantile with default arguments.
+Variable quantile(const Variable &var, const double q) {
+  return quantile_impl(var, Dim::Invalid, q, false);
+}
+
+/// Return the q-quantile along given dimension.
+Variable quantile(const Variable &var, const double q, const Dim dim) {
+  return quantile_impl(var, dim, q, false);
+}
+
+namespace {
+Variable bins_quantile(const Variable &data, const double q,
+                       const bool skip_nan) {
+  // Operate directly on the subspans of the bin buffer, i.e., without copying
+  // (or applying masks to) the buffer first.
+  const auto indices = data.bin_indices();
+  const auto dim = variableFactory().elem_dim(data);
+  const auto &buffer = variableFactory().data(data);
+  if (const auto mask = variableFactory().irreducible_event_mask(data);
+      mask.is_valid())
+    return select_quantile(q, skip_nan, subspan_view(buffer, dim, indices),
+                           subspan_view(mask, dim, indices));
+  return select_quantile(q, skip_nan, subspan_view(buffer, dim, indices));
+}
+} // namespace
+
+/// Return the median of all events per bin.
+Variable bins_median(const Variable &data) {
+  return bins_quantile(data, 0.5, false);
+}
+
+/// Return the median of all events per bin. Ignoring NaN values.
+Variable bins_nanmedian(const Variable &data) {
+  return bins_quantile(data, 0.5, true);
+}
+
+namespace {
+void expect_not_binned(const Variable &var, const std::string_view name) {
+  if (is_bins(var))
+    throw except::BinnedDataError(
+        std::string(name) +
+        " of binned data is only supported within bins, use, e.g., bins_" +
+        std::string(name) + " instead.");
+}
+
+template <class Op, class MaskedOp>
+Variable arg_extremum(const Variable &var, const Dim dim, const Variable &mask,
+                      Op op, MaskedOp masked_op, const std::string_view name) {
+  expect_not_binned(var, name);
+  const auto data = subspan_view(contiguous_along(var, dim), dim);
+  if (mask.is_valid() && mask.dims().contains(dim))
+    return variable::transform(
+        data, subspan_view(contiguous_along(mask, dim), dim), masked_op, name);
+  return variable::transform(data, op, name);
+}
+} // namespace
+
+/// Return the index of the minimum along `dim`, or -1 if there are no
+/// elements. Elements where the optional `mask` is true are skipped.
+Variable argmin_impl(const Variable &var, const Dim dim, const Variable &mask) {
+  return arg_extremum(var, dim, mask, element::argmin, element::masked_argmin,
+                      "argmin");
+}
+
+/// Return the index of the maximum along `dim`, or -1 if there are no
+/// elements. Elements where the optional `mask` is true are skipped.
+Variable argmax_impl(const Variable &var, const Dim dim, const Variable &mask) {
+  return arg_extremum(var, dim, mask, element::argmax, element::masked_argmax,
+                      "argmax");
+}
+
+/// Return the `k` largest elements along `dim` in descending order. Elements
+/// where the optional `mask` is true are skipped.
+Variable topk_impl(const Variable &var, const scipp::index k, const Dim dim,
+                   const Variable &mask) {
+  expect_not_binned(var, "topk");
+  if (k < 0)
+    throw std::invalid_argument("topk requires k >= 0, got " +
+                                std::to_string(k) + '.');
+  auto dims = var.dims();
+  dims.erase(dim);
+  dims.addInner(dim, k);
+  auto out = empty(dims, var.unit(), var.dtype());
+  const auto data = subspan_view(contiguous_along(var, dim), dim);
+  if (mask.is_valid() && mask.dims().contains(dim))
+    transform_in_place(subspan_view(out, dim), data,
+                       subspan_view(contiguous_along(mask, dim), dim),
+                       element::masked_topk, "topk");
+  else
+    transform_in_place(subspan_view(out, dim), data, element::topk, "topk");
+  return out;
+}
+
+/// Return the index of the minimum along given dimension.
+///
+/// As in numpy, the index of the first NaN is returned if there is a NaN.
+/// Variances are not considered.
+Variable argmin(const Variable &var, const Dim dim) {
+  return argmin_impl(var, dim);
+}
+
+/// Return the index of the maximum along given dimension.
+///
+/// As in numpy, the index of the first NaN is returned if there is a NaN.
+/// Variances are not considered.
+Variable argmax(const Variable &var, const Dim dim) {
+  return argmax_impl(var, dim);
+}
+
+/// Return the k largest elements along given dimension in descending order.
+///
+/// NaN values are skipped. If there are less than k elements the remaining
+/// output elements are NaN for floating-point types and the lowest
+/// representable value for integer types.
+Variable topk(const Variable &var, const scipp::index k, const Dim dim) {
+  return topk_impl(var, k, dim);
+}
+
+namespace {
+template <class Op, class MaskedOp>
+Variable bins_arg_extremum(const Variable &data, Op op, MaskedOp masked_op,
+                           const std::string_view name) {
+  const auto indices = data.bin_indices();
+  const auto dim = variableFactory().elem_dim(data);
+  const auto &buffer = variableFactory().data(data);
+  if (const auto mask = variableFactory().irreducible_event_mask(data);
+      mask.is_valid())
+    return variable::transform(subspan_view(buffer, dim, indices),
+                               subspan_view(mask, dim, indices), masked_op,
+                               name);
+  return variable::transform(subspan_view(buffer, dim, indices), op, name);
+}
+} // namespace
+
+/// Return the index of the minimum within each bin, or -1 for empty bins.
+Variable bins_argmin(const Variable &data) {
+  return bins_arg_extremum(data, element::argmin, element::masked_argmin,
+                           "argmin");
+}
+
+/// Return the index of the maximum within each bin, or -1 for empty bins.
+Variable bins_argmax(const Variable &data) {
+  return bins_arg_extremum(data, element::argmax, element::masked_argmax,
+                           "argmax");
+}
+
 void sum_into(Variable &accum, const Variable &var) {
   if (accum.dtype() == dtype<float>) {
     auto x = astype(accum, dtype<double>);
@@ -277,6 +863,31 @@ void nansum_into(Variable &summed, const Variable &var) {
   }
 }
 
+void masked_sum_into(Variable &accum, const Variable &var,
+                     const Variable &mask) {
+  if (accum.dtype() == dtype<float>) {
+    auto x = astype(accum, dtype<double>);
+    masked_sum_into(x, var, mask);
+    copy(astype(x, dtype<float>), accum);
+  } else {
+    masked_accumulate_in_place(accum, var, mask, element::masked_add_equals,
+                               element::add_equals, "sum");
+  }
+}
+
+void masked_nansum_into(Variable &summed, const Variable &var,
+                        const Variable &mask) {
+  if (summed.dtype() == dtype<float>) {
+    auto accum = astype(summed, dtype<double>);
+    masked_nansum_into(accum, var, mask);
+    copy(astype(accum, dtype<float>), summed);
+  } else {
+    masked_accumulate_in_place(summed, var, mask,
+                               element::masked_nan_add_equals,
+                               element::nan_add_equals, "nansum");
+  }
+}
+
 void all_into(Variable &accum, const Variable &var) {
   accumulate_in_place(accum, var, core::element::logical_and_equals, "all");
 }
@@ -63,10 +63,13 @@ auto apply(const DType dtype, Args &&...args) {
   if (formatterRegistry().contains(dtype))
     return formatterRegistry().format(args...);
   return core::callDType<Callable>(
-      std::tuple<double, float, int64_t, int32_t, std::string, bool,
-                 scipp::core::time_point, Eigen::Vector3d, Eigen::Matrix3d,
-                 Variable, bucket<Variable>, scipp::index_pair, Eigen::Affine3d,
-                 scipp::core::Quaternion, scipp::core::Translation>{},
+      std::tuple<double, float, int64_t, int32_t, std::string, bool, int16_t,
+                 int8_t, uint64_t, uint32_t, uint16_t, uint8_t,
+                 scipp::core::float16, scipp::core::time_point, Eigen::Vector3d,
+                 Eigen::Matrix3d, Variable, bucket<Variable>, scipp::index_pair,
+                 Eigen::Affine3d, scipp::core::Quaternion,
+                 scipp::core::Translation, scipp::core::categorical_string,
+                 std::string_view>{},
       dtype, std::forward<Args>(args)...);
 }
 } // namespace
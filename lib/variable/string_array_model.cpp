@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#include <algorithm>
+
+#include "scipp/variable/element_array_variable.tcc"
+#include "scipp/variable/string_array_model.h"
+
+namespace scipp::variable {
+
+template <> struct model<std::string_view> { using type = StringArrayModel; };
+
+std::shared_ptr<StringArrayModel>
+StringArrayModel::make(const ElementArrayView<const std::string> &strings,
+                       const units::Unit &unit) {
+  scipp::index total = 0;
+  for (const auto &str : strings)
+    total += scipp::size(str);
+  auto buffer = std::make_shared<buffer_type>(total, core::init_for_overwrite);
+  element_array<std::string_view> views(strings.size(),
+                                        core::init_for_overwrite);
+  char *begin = buffer->data();
+  scipp::index i = 0;
+  for (const auto &str : strings) {
+    std::copy(str.begin(), str.end(), begin);
+    views.data()[i++] = std::string_view(begin, str.size());
+    begin += str.size();
+  }
+  return make(std::move(views), std::move(buffer), unit);
+}
+
+std::shared_ptr<StringArrayModel>
+StringArrayModel::make(element_array<std::string_view> views,
+                       std::shared_ptr<const buffer_type> buffer,
+                       const units::Unit &unit) {
+  const auto size = views.size();
+  auto model =
+      std::make_shared<StringArrayModel>(size, unit, std::move(views));
+  model->m_buffers.insert(std::move(buffer));
+  return model;
+}
+
+VariableConceptHandle
+StringArrayModel::makeDefaultFromParent(const scipp::index size) const {
+  auto model = std::make_shared<StringArrayModel>(
+      size, unit(), element_array<std::string_view>(size));
+  // Elements are typically copied from the parent.
+  model->m_buffers = m_buffers;
+  return model;
+}
+
+VariableConceptHandle StringArrayModel::clone() const {
+  return std::make_shared<StringArrayModel>(*this);
+}
+
+void StringArrayModel::copy_batch(const scipp::span<const Variable> src,
+                                  const scipp::span<Variable> dest) const {
+  for (size_t i = 0; i < std::min(src.size(), dest.size()); ++i)
+    variable::share_storage(src[i], dest[i]);
+  ElementArrayModel::copy_batch(src, dest);
+}
+
+void StringArrayModel::assign(const VariableConcept &other) {
+  *this = requireT<const StringArrayModel>(other);
+}
+
+scipp::index StringArrayModel::object_size() const {
+  auto size = static_cast<scipp::index>(sizeof(*this));
+  for (const auto &buffer : m_buffers)
+    size += scipp::size(*buffer);
+  return size;
+}
+
+void StringArrayModel::share_storage(const VariableConcept &other) {
+  if (&other == this || other.dtype() != scipp::dtype<std::string_view>)
+    return;
+  const auto &buffers = requireT<const StringArrayModel>(other).m_buffers;
+  m_buffers.insert(buffers.begin(), buffers.end());
+}
+
+template class SCIPP_EXPORT ElementArrayModel<std::string_view>;
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE_BASE(string_view, std::string_view)
+
+} // namespace scipp::variable
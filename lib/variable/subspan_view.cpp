@@ -64,8 +64,10 @@ Variable subspan_view_impl(Var &var, const Dim dim, Args &&...args) {
         "View over subspan can only be created for contiguous "
         "range of data.");
   return invoke_subspan_view<double, float, int64_t, int32_t, bool,
-                             core::time_point, std::string, Eigen::Vector3d>(
-      var.dtype(), var, dim, args...);
+                             core::time_point, std::string, Eigen::Vector3d,
+                             int16_t, int8_t, uint64_t, uint32_t, uint16_t,
+                             uint8_t, core::float16, core::categorical_string,
+                             std::string_view>(var.dtype(), var, dim, args...);
 }
 
 auto make_range(const scipp::index num, const scipp::index stride,
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "test_macros.h"
+
+#include "scipp/core/except.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/reduction.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/variable.h"
+
+using namespace scipp;
+
+class ArgReductionTest : public ::testing::Test {
+protected:
+  Variable var = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                      units::m, Values{5, 1, 3, 4, 6, 2});
+};
+
+TEST_F(ArgReductionTest, argmin) {
+  EXPECT_EQ(argmin(var, Dim::X),
+            makeVariable<int64_t>(Dims{Dim::Y}, Shape{2}, units::none,
+                                  Values{1, 2}));
+  EXPECT_EQ(argmin(var, Dim::Y),
+            makeVariable<int64_t>(Dims{Dim::X}, Shape{3}, units::none,
+                                  Values{1, 0, 1}));
+}
+
+TEST_F(ArgReductionTest, argmax) {
+  EXPECT_EQ(argmax(var, Dim::X),
+            makeVariable<int64_t>(Dims{Dim::Y}, Shape{2}, units::none,
+                                  Values{0, 1}));
+  EXPECT_EQ(argmax(var, Dim::Y),
+            makeVariable<int64_t>(Dims{Dim::X}, Shape{3}, units::none,
+                                  Values{0, 1, 0}));
+}
+
+TEST_F(ArgReductionTest, transposed_input) {
+  EXPECT_EQ(argmax(transpose(var), Dim::X), argmax(var, Dim::X));
+}
+
+TEST_F(ArgReductionTest, first_of_equal_elements) {
+  const auto x =
+      makeVariable<int32_t>(Dims{Dim::X}, Shape{4}, Values{1, 3, 3, 1});
+  EXPECT_EQ(argmax(x, Dim::X), makeVariable<int64_t>(Values{1}));
+  EXPECT_EQ(argmin(x, Dim::X), makeVariable<int64_t>(Values{0}));
+}
+
+TEST_F(ArgReductionTest, nan_is_found) {
+  const auto x =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1.0, 3.0, NAN, 4.0});
+  EXPECT_EQ(argmax(x, Dim::X), makeVariable<int64_t>(Values{2}));
+  EXPECT_EQ(argmin(x, Dim::X), makeVariable<int64_t>(Values{2}));
+}
+
+TEST_F(ArgReductionTest, empty_gives_minus_one) {
+  const auto x = makeVariable<double>(Dims{Dim::X}, Shape{0});
+  EXPECT_EQ(argmax(x, Dim::X), makeVariable<int64_t>(Values{-1}));
+}
+
+TEST_F(ArgReductionTest, variances_are_ignored) {
+  const auto x = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 3, 2},
+                                      Variances{9, 1, 9});
+  EXPECT_EQ(argmax(x, Dim::X), makeVariable<int64_t>(Values{1}));
+}
+
+TEST_F(ArgReductionTest, unknown_dim_fails) {
+  EXPECT_THROW_DISCARD(argmax(var, Dim::Z), except::DimensionError);
+  EXPECT_THROW_DISCARD(topk(var, 1, Dim::Z), except::DimensionError);
+}
+
+TEST_F(ArgReductionTest, topk) {
+  EXPECT_EQ(topk(var, 2, Dim::X),
+            makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2}, units::m,
+                                 Values{5, 3, 6, 4}));
+  EXPECT_EQ(topk(var, 1, Dim::Y),
+            makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{3, 1}, units::m,
+                                 Values{5, 6, 3}));
+  EXPECT_EQ(topk(var, 0, Dim::X),
+            makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 0}, units::m));
+}
+
+TEST_F(ArgReductionTest, topk_pads_if_k_exceeds_size) {
+  const auto ints =
+      makeVariable<int64_t>(Dims{Dim::X}, Shape{2}, Values{1, 2});
+  const auto lowest = std::numeric_limits<int64_t>::lowest();
+  EXPECT_EQ(topk(ints, 3, Dim::X),
+            makeVariable<int64_t>(Dims{Dim::X}, Shape{3},
+                                  Values{2, 1, lowest}));
+  const auto x =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1.0, NAN, 2.0});
+  const auto result = topk(x, 3, Dim::X);
+  EXPECT_EQ(result.slice({Dim::X, 0, 2}),
+            makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{2, 1}));
+  EXPECT_TRUE(std::isnan(result.values<double>()[2]));
+}
+
+TEST_F(ArgReductionTest, topk_fails_with_variances_or_negative_k) {
+  const auto x = makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{1, 2},
+                                      Variances{1, 2});
+  EXPECT_THROW_DISCARD(topk(x, 1, Dim::X), except::VariancesError);
+  EXPECT_THROW_DISCARD(topk(var, -1, Dim::X), std::invalid_argument);
+}
+
+TEST_F(ArgReductionTest, binned) {
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{3},
+      Values{std::pair{0, 3}, std::pair{3, 3}, std::pair{3, 7}});
+  const auto buffer = makeVariable<double>(Dims{Dim::X}, Shape{7},
+                                           Values{3, 1, 2, 8, 5, 7, 6});
+  const auto binned = make_bins(indices, Dim::X, buffer);
+  EXPECT_EQ(bins_argmin(binned),
+            makeVariable<int64_t>(Dims{Dim::Y}, Shape{3}, units::none,
+                                  Values{1, -1, 1}));
+  EXPECT_EQ(bins_argmax(binned),
+            makeVariable<int64_t>(Dims{Dim::Y}, Shape{3}, units::none,
+                                  Values{0, -1, 0}));
+  EXPECT_THROW_DISCARD(argmax(binned, Dim::Y), except::BinnedDataError);
+}
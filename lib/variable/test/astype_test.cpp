@@ -13,7 +13,12 @@ template <class T> class AsTypeTest : public ::testing::Test {};
 
 using type_pairs =
     ::testing::Types<std::pair<float, double>, std::pair<double, float>,
-                     std::pair<int32_t, float>, std::pair<double, double>>;
+                     std::pair<int32_t, float>, std::pair<double, double>,
+                     std::pair<uint8_t, double>, std::pair<double, uint32_t>,
+                     std::pair<int16_t, int64_t>, std::pair<uint64_t, int8_t>,
+                     std::pair<uint16_t, uint16_t>,
+                     std::pair<core::float16, float>,
+                     std::pair<int64_t, core::float16>>;
 TYPED_TEST_SUITE(AsTypeTest, type_pairs);
 
 TYPED_TEST(AsTypeTest, dense) {
@@ -75,3 +80,28 @@ TEST(AsTypeTest, buffer_handling) {
   const auto required_copy = astype(var, dtype<double>, CopyPolicy::TryAvoid);
   EXPECT_FALSE(required_copy.is_same(var));
 }
+
+TEST(AsTypeTest, float16_rounds_on_storage) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m,
+                                        Values{2049.0, 0.1, 1e6});
+  const auto half = astype(var, dtype<core::float16>);
+  EXPECT_EQ(half.unit(), units::m);
+  EXPECT_EQ(astype(half, dtype<double>),
+            makeVariable<double>(
+                Dims{Dim::X}, Shape{3}, units::m,
+                Values{2048.0, double(core::float16(0.1)),
+                       std::numeric_limits<double>::infinity()}));
+}
+
+TEST(AsTypeTest, string_to_categorical_string_and_back) {
+  const auto var = makeVariable<std::string>(Dims{Dim::X}, Shape{3},
+                                             Values{"a", "b", "a"});
+  const auto categorical = astype(var, dtype<core::categorical_string>);
+  EXPECT_EQ(categorical.dtype(), dtype<core::categorical_string>);
+  EXPECT_EQ(categorical.unit(), var.unit());
+  const auto values = categorical.values<core::categorical_string>();
+  EXPECT_EQ(values[0].str(), "a");
+  EXPECT_EQ(values[1].str(), "b");
+  EXPECT_EQ(values[0].code(), values[2].code());
+  EXPECT_EQ(astype(categorical, dtype<std::string>), var);
+}
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "test_macros.h"
+
+#include "scipp/variable/astype.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/categorical_string_model.h"
+#include "scipp/variable/shape.h"
+
+using namespace scipp;
+
+namespace {
+Variable make_strings(const std::vector<std::string> &strings) {
+  return makeVariable<std::string>(Dims{Dim::X}, Shape{scipp::size(strings)},
+                                   Values(strings.begin(), strings.end()));
+}
+
+Variable make_categorical(const std::vector<std::string> &strings) {
+  return astype(make_strings(strings), dtype<core::categorical_string>);
+}
+
+std::vector<std::string> to_strings(const Variable &var) {
+  const auto values = var.values<core::categorical_string>();
+  std::vector<std::string> out;
+  for (const auto &value : values)
+    out.emplace_back(value.str());
+  return out;
+}
+
+const variable::CategoricalStringArrayModel &model(const Variable &var) {
+  return dynamic_cast<const variable::CategoricalStringArrayModel &>(
+      var.data());
+}
+} // namespace
+
+TEST(CategoricalStringArrayModelTest, astype_round_trip) {
+  const auto strings = makeVariable<std::string>(
+      Dims{Dim::X}, Shape{4}, units::m, Values{"a", "", "b", "a"});
+  const auto categorical = astype(strings, dtype<core::categorical_string>);
+  EXPECT_EQ(categorical.dtype(), dtype<core::categorical_string>);
+  EXPECT_EQ(categorical.unit(), units::m);
+  EXPECT_EQ(astype(categorical, dtype<std::string>), strings);
+}
+
+TEST(CategoricalStringArrayModelTest, dictionary_is_per_variable) {
+  const auto a = make_categorical({"a", "b", "a"});
+  const auto b = make_categorical({"a"});
+  ASSERT_EQ(model(a).dictionaries().size(), 1);
+  ASSERT_EQ(model(b).dictionaries().size(), 1);
+  EXPECT_NE(*model(a).dictionaries().begin(), *model(b).dictionaries().begin());
+  EXPECT_EQ((*model(a).dictionaries().begin())->size(), 2);
+  const auto values = a.values<core::categorical_string>();
+  EXPECT_EQ(values[0].code(), values[2].code());
+  EXPECT_NE(values[0].code(), b.values<core::categorical_string>()[0].code());
+}
+
+TEST(CategoricalStringArrayModelTest, equal_across_variables) {
+  EXPECT_EQ(make_categorical({"a", "b"}), make_categorical({"a", "b"}));
+  EXPECT_NE(make_categorical({"a", "b"}), make_categorical({"a", "c"}));
+}
+
+TEST(CategoricalStringArrayModelTest, copy_outlives_source) {
+  auto var = make_categorical({"abc", "de", "abc"});
+  const auto copied = copy(var);
+  EXPECT_FALSE(copied.is_same(var));
+  var = Variable{};
+  EXPECT_EQ(to_strings(copied),
+            (std::vector<std::string>{"abc", "de", "abc"}));
+}
+
+TEST(CategoricalStringArrayModelTest, copy_of_slice) {
+  auto var = make_categorical({"abc", "de", "f"});
+  const auto sliced = copy(var.slice({Dim::X, 1, 3}));
+  var = Variable{};
+  EXPECT_EQ(to_strings(sliced), (std::vector<std::string>{"de", "f"}));
+}
+
+TEST(CategoricalStringArrayModelTest, assign_slice_from_other_variable) {
+  auto var = make_categorical({"abc", "de", "f"});
+  auto other = make_categorical({"xyz"});
+  copy(other, var.slice({Dim::X, 1, 2}));
+  other = Variable{};
+  EXPECT_EQ(to_strings(var), (std::vector<std::string>{"abc", "xyz", "f"}));
+  EXPECT_EQ(model(var).dictionaries().size(), 2);
+}
+
+TEST(CategoricalStringArrayModelTest, concat) {
+  auto a = make_categorical({"abc", "de"});
+  auto b = make_categorical({"f", "abc"});
+  const auto ab = concat(std::vector{a, b}, Dim::X);
+  a = Variable{};
+  b = Variable{};
+  EXPECT_EQ(to_strings(ab),
+            (std::vector<std::string>{"abc", "de", "f", "abc"}));
+}
+
+TEST(CategoricalStringArrayModelTest, copy_binned) {
+  auto buffer = make_categorical({"abc", "de", "f"});
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{2}, Values{std::pair{0, 1}, std::pair{1, 3}});
+  auto binned = make_bins(indices, Dim::X, buffer);
+  buffer = Variable{};
+  const auto copied = copy(binned.slice({Dim::Y, 1}));
+  binned = Variable{};
+  EXPECT_EQ(to_strings(copied.bin_buffer<Variable>()),
+            (std::vector<std::string>{"de", "f"}));
+}
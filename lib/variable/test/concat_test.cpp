@@ -135,3 +135,39 @@ TEST_F(ConcatTest, multiple) {
     EXPECT_EQ(abc, a_bc);
   }
 }
+
+TEST_F(ConcatTest, many_inputs_with_variances) {
+  // Inner extent large enough for contiguous block copies.
+  const auto chunk = makeVariable<double>(
+      Dims{Dim::X, Dim::Y}, Shape{2, 16}, units::m, Values{}, Variances{});
+  std::vector<Variable> chunks;
+  for (scipp::index i = 0; i < 1000; ++i)
+    chunks.emplace_back(chunk + static_cast<double>(i) * units::m);
+  for (const auto &dim : {Dim::X, Dim::Y, Dim::Z}) {
+    const auto out = concat(chunks, dim);
+    const auto extent = dim == Dim::Z ? 1 : chunk.dims()[dim];
+    for (scipp::index i = 0; i < 1000; ++i) {
+      const auto slice = dim == Dim::Z
+                             ? out.slice({dim, i})
+                             : out.slice({dim, i * extent, (i + 1) * extent});
+      EXPECT_EQ(slice, chunks[i]);
+    }
+  }
+}
+
+TEST_F(ConcatTest, mixed_memory_layouts) {
+  const auto var = makeVariable<float>(Dims{Dim::X, Dim::Y}, Shape{4, 40},
+                                       units::m, Values{}, Variances{});
+  auto a = var + 1.0f * units::m;
+  auto b = copy(transpose(var + 2.0f * units::m));
+  auto c = (var + 3.0f * units::m).slice({Dim::Y, 5, 35});
+  auto d = (var + 4.0f * units::m).slice({Dim::X, 1});
+  const auto out = concat(std::vector{a, b, c}, Dim::Y);
+  EXPECT_EQ(out.slice({Dim::Y, 0, 40}), a);
+  EXPECT_EQ(out.slice({Dim::Y, 40, 80}), var + 2.0f * units::m);
+  EXPECT_EQ(out.slice({Dim::Y, 80, 110}), c);
+  const auto with_new = concat(std::vector{a, b, d}, Dim::X);
+  EXPECT_EQ(with_new.slice({Dim::X, 0, 4}), a);
+  EXPECT_EQ(with_new.slice({Dim::X, 4, 8}), var + 2.0f * units::m);
+  EXPECT_EQ(with_new.slice({Dim::X, 8}), d);
+}
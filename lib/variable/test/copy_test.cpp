@@ -85,3 +85,33 @@ TEST_F(CopyTest, broadcast_transpose_slice) {
   EXPECT_EQ(copied.data().size(), 8);
   EXPECT_TRUE(equals(var.values<double>(), {5, 8, 5, 8, 6, 9, 6, 9}));
 }
+
+TEST_F(CopyTest, large_slice) {
+  auto var = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{300, 400},
+                                  units::m, Values{}, Variances{});
+  auto values = var.values<double>();
+  auto variances = var.variances<double>();
+  for (scipp::index i = 0; i < var.dims().volume(); ++i) {
+    values[i] = static_cast<double>(i);
+    variances[i] = static_cast<double>(2 * i);
+  }
+  const auto sliced = var.slice({Dim::X, 10, 290}).slice({Dim::Y, 3, 397});
+  const auto copied = copy(sliced);
+  check_copied(copied, sliced);
+  EXPECT_EQ(copied.offset(), 0);
+  EXPECT_EQ(copied.data().size(), 280 * 394);
+}
+
+TEST_F(CopyTest, into_slice_from_broadcast) {
+  auto out = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{4, 16},
+                                  units::m, Values{}, Variances{});
+  const auto row = makeVariable<double>(Dims{Dim::Y}, Shape{16}, units::m,
+                                        Values{}, Variances{}) +
+                   1.0 * units::m;
+  copy(broadcast(row, Dimensions({Dim::X, Dim::Y}, {2, 16})),
+       out.slice({Dim::X, 1, 3}));
+  EXPECT_EQ(out.slice({Dim::X, 0}), row - row);
+  EXPECT_EQ(out.slice({Dim::X, 1}), row);
+  EXPECT_EQ(out.slice({Dim::X, 2}), row);
+  EXPECT_EQ(out.slice({Dim::X, 3}), row - row);
+}
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "test_macros.h"
+
+#include "scipp/core/except.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/reduction.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/variable.h"
+
+using namespace scipp;
+
+class MedianTest : public ::testing::Test {
+protected:
+  Variable var = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                      units::m, Values{5, 1, 3, 4, 6, 2});
+};
+
+TEST_F(MedianTest, all_dims) {
+  EXPECT_EQ(median(var), makeVariable<double>(units::m, Values{3.5}));
+}
+
+TEST_F(MedianTest, inner_dim) {
+  EXPECT_EQ(median(var, Dim::X), makeVariable<double>(Dims{Dim::Y}, Shape{2},
+                                                      units::m, Values{3, 4}));
+}
+
+TEST_F(MedianTest, outer_dim) {
+  EXPECT_EQ(median(var, Dim::Y),
+            makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m,
+                                 Values{4.5, 3.5, 2.5}));
+}
+
+TEST_F(MedianTest, transposed_input) {
+  EXPECT_EQ(median(transpose(var), Dim::X), median(var, Dim::X));
+  EXPECT_EQ(median(transpose(var)), median(var));
+}
+
+TEST_F(MedianTest, unknown_dim_fails) {
+  EXPECT_THROW_DISCARD(median(var, Dim::Z), except::DimensionError);
+}
+
+TEST_F(MedianTest, variances_fail) {
+  const auto with_variances = makeVariable<double>(
+      Dims{Dim::X}, Shape{2}, Values{1, 2}, Variances{1, 2});
+  EXPECT_THROW_DISCARD(median(with_variances), except::VariancesError);
+  EXPECT_THROW_DISCARD(median(with_variances, Dim::X), except::VariancesError);
+}
+
+TEST_F(MedianTest, int_input_gives_double) {
+  const auto ints =
+      makeVariable<int64_t>(Dims{Dim::X}, Shape{4}, Values{4, 1, 3, 2});
+  EXPECT_EQ(median(ints), makeVariable<double>(Values{2.5}));
+}
+
+TEST_F(MedianTest, float_input_gives_float) {
+  const auto floats =
+      makeVariable<float>(Dims{Dim::X}, Shape{3}, Values{4, 1, 3});
+  EXPECT_EQ(median(floats), makeVariable<float>(Values{3}));
+}
+
+TEST_F(MedianTest, empty_gives_nan) {
+  const auto empty = makeVariable<double>(Dims{Dim::X}, Shape{0});
+  EXPECT_TRUE(std::isnan(median(empty).value<double>()));
+}
+
+TEST_F(MedianTest, nan_propagates) {
+  const auto x =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1.0, NAN, 3.0});
+  EXPECT_TRUE(std::isnan(median(x).value<double>()));
+  EXPECT_EQ(nanmedian(x), makeVariable<double>(Values{2}));
+  EXPECT_EQ(nanmedian(x, Dim::X), makeVariable<double>(Values{2}));
+}
+
+TEST_F(MedianTest, quantile) {
+  const auto x =
+      makeVariable<double>(Dims{Dim::X}, Shape{5}, Values{4, 0, 3, 1, 2});
+  EXPECT_EQ(quantile(x, 0.0), makeVariable<double>(Values{0}));
+  EXPECT_EQ(quantile(x, 0.25), makeVariable<double>(Values{1}));
+  EXPECT_EQ(quantile(x, 0.125), makeVariable<double>(Values{0.5}));
+  EXPECT_EQ(quantile(x, 0.75), makeVariable<double>(Values{3}));
+  EXPECT_EQ(quantile(x, 1.0), makeVariable<double>(Values{4}));
+  EXPECT_EQ(quantile(x, 0.5, Dim::X), median(x));
+}
+
+TEST_F(MedianTest, quantile_out_of_range_fails) {
+  EXPECT_THROW_DISCARD(quantile(var, -0.1), std::invalid_argument);
+  EXPECT_THROW_DISCARD(quantile(var, 1.1, Dim::X), std::invalid_argument);
+}
+
+TEST_F(MedianTest, binned) {
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{3}, Values{std::pair{0, 3}, std::pair{3, 3},
+                                     std::pair{3, 7}});
+  const auto buffer =
+      makeVariable<double>(Dims{Dim::X}, Shape{7}, units::m,
+                           Values{3.0, 1.0, 2.0, NAN, 5.0, 7.0, 6.0});
+  const auto binned = make_bins(indices, Dim::X, buffer);
+  const auto result = bins_median(binned);
+  EXPECT_EQ(result.slice({Dim::Y, 0}),
+            makeVariable<double>(units::m, Values{2}));
+  EXPECT_TRUE(std::isnan(result.values<double>()[1]));
+  EXPECT_TRUE(std::isnan(result.values<double>()[2]));
+  const auto nan_skipped = bins_nanmedian(binned);
+  EXPECT_EQ(nan_skipped.slice({Dim::Y, 0}),
+            makeVariable<double>(units::m, Values{2}));
+  EXPECT_TRUE(std::isnan(nan_skipped.values<double>()[1]));
+  EXPECT_EQ(nan_skipped.slice({Dim::Y, 2}),
+            makeVariable<double>(units::m, Values{6}));
+}
+
+class ParallelQuantileTest : public ::testing::Test {
+protected:
+  // Force the parallel sample-select for all full reductions.
+  ParallelQuantileTest() {
+    variable::detail::set_parallel_quantile_min_size(1);
+  }
+  ~ParallelQuantileTest() override {
+    variable::detail::set_parallel_quantile_min_size(limit);
+  }
+
+  scipp::index limit = variable::detail::parallel_quantile_min_size();
+};
+
+TEST_F(ParallelQuantileTest, matches_select_along_dim) {
+  std::vector<double> values(100000);
+  for (size_t i = 0; i < values.size(); ++i)
+    values[i] = static_cast<double>((i * 7919) % 1009) + 0.5 * (i % 3);
+  const auto var =
+      makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{100, 1000}, units::m,
+                           Values(values.begin(), values.end()));
+  const auto flat = flatten(var, std::vector<Dim>{Dim::Y, Dim::X}, Dim::Z);
+  for (const auto q : {0.0, 0.1, 0.5, 0.77, 1.0}) {
+    EXPECT_EQ(quantile(var, q), quantile(flat, q, Dim::Z));
+    EXPECT_EQ(quantile(transpose(var), q), quantile(flat, q, Dim::Z));
+  }
+}
+
+TEST_F(ParallelQuantileTest, int_input) {
+  const auto ints = makeVariable<int32_t>(Dims{Dim::X}, Shape{6},
+                                          Values{5, 3, 3, 3, 9, 1});
+  EXPECT_EQ(median(ints), makeVariable<double>(Values{3}));
+  EXPECT_EQ(quantile(ints, 0.9), quantile(ints, 0.9, Dim::X));
+}
+
+TEST_F(ParallelQuantileTest, nan) {
+  const auto x = makeVariable<double>(Dims{Dim::X}, Shape{4},
+                                      Values{1.0, NAN, 3.0, 2.0});
+  EXPECT_TRUE(std::isnan(median(x).value<double>()));
+  EXPECT_EQ(nanmedian(x), makeVariable<double>(Values{2}));
+  const auto all_nan =
+      makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{NAN, NAN});
+  EXPECT_TRUE(std::isnan(nanmedian(all_nan).value<double>()));
+}
+
+TEST_F(ParallelQuantileTest, empty_gives_nan) {
+  const auto empty = makeVariable<float>(Dims{Dim::X}, Shape{0});
+  EXPECT_TRUE(std::isnan(median(empty).value<float>()));
+}
@@ -830,6 +830,53 @@ TEST(VariableTest, rotate) {
   EXPECT_EQ(vec_new, rotated);
 }
 
+namespace {
+Variable make_vectors_2d() {
+  std::vector<Eigen::Vector3d> vectors;
+  for (int i = 0; i < 6; ++i)
+    vectors.emplace_back(i, 2.0 * i - 1.0, 0.5 - i);
+  return makeVariable<Eigen::Vector3d>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                       units::m,
+                                       Values(vectors.begin(), vectors.end()));
+}
+
+template <class T>
+Variable expected_transformed(const T &transformation, const Variable &vec) {
+  auto expected = copy(vec);
+  for (auto &v : expected.values<Eigen::Vector3d>())
+    v = transformation * v;
+  return expected;
+}
+} // namespace
+
+TEST(VariableTest, rotate_many_vectors_by_single_matrix) {
+  const Eigen::Matrix3d rot =
+      Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 3).normalized())
+          .toRotationMatrix();
+  const auto rot_var = makeVariable<Eigen::Matrix3d>(Values{rot});
+  const auto vec = make_vectors_2d();
+  const auto expected = expected_transformed(rot, vec);
+  EXPECT_EQ(rot_var * vec, expected);
+  // Transposed and sliced inputs are not contiguous and handled by transform.
+  EXPECT_EQ(rot_var * transpose(vec), transpose(expected));
+  EXPECT_EQ(rot_var * vec.slice({Dim::X, 1, 3}),
+            expected.slice({Dim::X, 1, 3}));
+}
+
+TEST(VariableTest, apply_single_transform_to_many_vectors) {
+  Eigen::Affine3d affine(Eigen::AngleAxisd(0.3, Eigen::Vector3d::UnitZ()));
+  affine.translation() << 1.0, -2.0, 3.0;
+  const auto affine_var =
+      makeVariable<Eigen::Affine3d>(units::m, Values{affine});
+  const auto vec = make_vectors_2d();
+  const auto expected = expected_transformed(affine, vec);
+  EXPECT_EQ(affine_var * vec, expected);
+  EXPECT_EQ(affine_var * transpose(vec), transpose(expected));
+  EXPECT_THROW_DISCARD(
+      makeVariable<Eigen::Affine3d>(units::mm, Values{affine}) * vec,
+      except::UnitError);
+}
+
 TEST(VariableTest, combine_translations) {
   Eigen::Vector3d translation1(1, 2, 3);
   Eigen::Vector3d translation2(4, 5, 6);
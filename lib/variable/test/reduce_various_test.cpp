@@ -74,6 +74,26 @@ TEST(ReduceTest, min_max_all_dims) {
   EXPECT_EQ(max(min(var)), min(var));
 }
 
+TEST(ReduceTest, min_max_all_dims_memoized_result_is_updated) {
+  auto var = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{2, 2},
+                                  units::m, Values{1, 2, 3, 4});
+  EXPECT_EQ(min(var), makeVariable<double>(units::m, Values{1}));
+  EXPECT_EQ(max(var), makeVariable<double>(units::m, Values{4}));
+  var.setUnit(units::s);
+  EXPECT_EQ(min(var), makeVariable<double>(units::s, Values{1}));
+  var.values<double>()[3] = 5.0;
+  EXPECT_EQ(max(var), makeVariable<double>(units::s, Values{5}));
+  var.slice({Dim::X, 0}).setSlice({Dim::Y, 0}, -1.0 * units::s);
+  EXPECT_EQ(min(var), makeVariable<double>(units::s, Values{-1}));
+}
+
+TEST(ReduceTest, min_max_all_dims_of_slice) {
+  const auto var = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{2, 2},
+                                        Values{1, 2, 3, 4});
+  EXPECT_EQ(max(var), makeVariable<double>(Values{4}));
+  EXPECT_EQ(max(var.slice({Dim::X, 0})), makeVariable<double>(Values{2}));
+}
+
 TEST(ReduceTest, all_any_all_dims) {
   const auto var = makeVariable<bool>(Dims{Dim::X, Dim::Y}, Shape{2, 2},
                                       Values{true, false, false, false});
@@ -158,3 +178,58 @@ TEST_F(ReduceBinnedTest, slice) {
   EXPECT_EQ(mean(binned.slice({Dim::Y, 1, 2})),
             mean(buffer.slice({Dim::X, 2, 6})));
 }
+
+TEST_F(ReduceBinnedTest, multiple_dims) {
+  const std::vector<Dim> dims{Dim::Y, Dim::Z};
+  EXPECT_EQ(sum(binned, dims), sum(binned));
+  EXPECT_EQ(max(binned, dims), max(binned));
+  EXPECT_EQ(mean(binned, dims), mean(binned));
+}
+
+class ReduceMultipleDimsTest : public ::testing::Test {
+protected:
+  Variable var = makeVariable<double>(
+      Dims{Dim::X, Dim::Y, Dim::Z}, Shape{2, 3, 2}, units::m,
+      Values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+};
+
+TEST_F(ReduceMultipleDimsTest, matches_repeated_reduction) {
+  for (const auto &dims : {std::vector<Dim>{Dim::X, Dim::Y},
+                           std::vector<Dim>{Dim::Y, Dim::Z},
+                           std::vector<Dim>{Dim::Z, Dim::X}}) {
+    EXPECT_EQ(sum(var, dims), sum(sum(var, dims[0]), dims[1]));
+    EXPECT_EQ(nansum(var, dims), nansum(nansum(var, dims[0]), dims[1]));
+    EXPECT_EQ(max(var, dims), max(max(var, dims[0]), dims[1]));
+    EXPECT_EQ(min(var, dims), min(min(var, dims[0]), dims[1]));
+    EXPECT_EQ(mean(var, dims), mean(mean(var, dims[0]), dims[1]));
+  }
+}
+
+TEST_F(ReduceMultipleDimsTest, outer_and_inner) {
+  EXPECT_EQ(sum(var, std::vector<Dim>{Dim::X, Dim::Z}),
+            makeVariable<double>(Dims{Dim::Y}, Shape{3}, units::m,
+                                 Values{18, 26, 34}));
+}
+
+TEST_F(ReduceMultipleDimsTest, no_dims_is_noop) {
+  EXPECT_EQ(sum(var, std::vector<Dim>{}), var);
+}
+
+TEST_F(ReduceMultipleDimsTest, bool_sum_gives_int) {
+  const auto mask = makeVariable<bool>(
+      var.dims(), Values{false, false, false, false, true, true, true, true,
+                         true, true, true, true});
+  EXPECT_EQ(sum(mask, std::vector<Dim>{Dim::X, Dim::Y}),
+            makeVariable<int64_t>(Dims{Dim::Z}, Shape{2}, Values{4, 4}));
+  EXPECT_EQ(any(mask, std::vector<Dim>{Dim::X, Dim::Y}),
+            any(any(mask, Dim::X), Dim::Y));
+  EXPECT_EQ(all(mask, std::vector<Dim>{Dim::X, Dim::Y}),
+            all(all(mask, Dim::X), Dim::Y));
+}
+
+TEST_F(ReduceMultipleDimsTest, bad_dim_fails) {
+  EXPECT_THROW_DISCARD(sum(var, std::vector<Dim>{Dim::X, Dim::Time}),
+                       except::DimensionError);
+  EXPECT_THROW_DISCARD(sum(var, std::vector<Dim>{Dim::X, Dim::X}),
+                       except::DimensionError);
+}
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "test_macros.h"
+
+#include "scipp/variable/astype.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/shape.h"
+#include "scipp/variable/sort.h"
+#include "scipp/variable/string_array_model.h"
+#include "scipp/variable/transform.h"
+#include "scipp/variable/variable_factory.h"
+
+using namespace scipp;
+
+namespace {
+Variable make_strings(const std::vector<std::string> &strings) {
+  return astype(makeVariable<std::string>(Dims{Dim::X},
+                                          Shape{scipp::size(strings)},
+                                          Values(strings.begin(),
+                                                 strings.end())),
+                dtype<std::string_view>);
+}
+
+std::vector<std::string> to_strings(const Variable &var) {
+  const auto values = var.values<std::string_view>();
+  return {values.begin(), values.end()};
+}
+} // namespace
+
+TEST(StringArrayModelTest, astype_round_trip) {
+  const auto strings = makeVariable<std::string>(
+      Dims{Dim::X}, Shape{3}, units::m,
+      Values{"a", "", "a string too long for small string optimization"});
+  const auto views = astype(strings, dtype<std::string_view>);
+  EXPECT_EQ(views.dtype(), dtype<std::string_view>);
+  EXPECT_EQ(views.unit(), units::m);
+  EXPECT_EQ(astype(views, dtype<std::string>), strings);
+}
+
+TEST(StringArrayModelTest, characters_are_contiguous) {
+  const auto var = make_strings({"abc", "de", "f"});
+  const auto values = var.values<std::string_view>();
+  EXPECT_EQ(values[1].data(), values[0].data() + 3);
+  EXPECT_EQ(values[2].data(), values[1].data() + 2);
+  const auto &model = dynamic_cast<const variable::StringArrayModel &>(
+      var.data());
+  EXPECT_EQ(model.buffers().size(), 1);
+}
+
+TEST(StringArrayModelTest, copy_shares_characters) {
+  auto var = make_strings({"abc", "de", "f"});
+  const auto *chars = var.values<std::string_view>()[0].data();
+  const auto copied = copy(var);
+  EXPECT_FALSE(copied.is_same(var));
+  EXPECT_EQ(copied.values<std::string_view>()[0].data(), chars);
+  var = Variable{};
+  EXPECT_EQ(to_strings(copied), (std::vector<std::string>{"abc", "de", "f"}));
+}
+
+TEST(StringArrayModelTest, copy_of_slice) {
+  auto var = make_strings({"abc", "de", "f"});
+  const auto sliced = copy(var.slice({Dim::X, 1, 3}));
+  var = Variable{};
+  EXPECT_EQ(to_strings(sliced), (std::vector<std::string>{"de", "f"}));
+}
+
+TEST(StringArrayModelTest, assign_slice_from_other_variable) {
+  auto var = make_strings({"abc", "de", "f"});
+  auto other = make_strings({"xyz"});
+  copy(other, var.slice({Dim::X, 1, 2}));
+  other = Variable{};
+  EXPECT_EQ(to_strings(var), (std::vector<std::string>{"abc", "xyz", "f"}));
+}
+
+TEST(StringArrayModelTest, transform_into_output_without_parent) {
+  auto var = make_strings({"abc", "de"});
+  auto out = variable::variableFactory().create(
+      dtype<std::string_view>, var.dims(), var.unit(), false);
+  variable::transform_in_place<std::string_view>(
+      out, var, [](auto &a, const auto &b) { a = b; }, "copy");
+  var = Variable{};
+  EXPECT_EQ(to_strings(out), (std::vector<std::string>{"abc", "de"}));
+}
+
+TEST(StringArrayModelTest, concat_many_shares_each_buffer_once) {
+  std::vector<Variable> pieces;
+  for (int i = 0; i < 100; ++i)
+    pieces.push_back(make_strings({"abc"}));
+  const auto var = concat(pieces, Dim::X);
+  const auto &model =
+      dynamic_cast<const variable::StringArrayModel &>(var.data());
+  EXPECT_EQ(model.buffers().size(), 100);
+  const auto copied = concat(std::vector{var, var}, Dim::X);
+  EXPECT_EQ(dynamic_cast<const variable::StringArrayModel &>(copied.data())
+                .buffers()
+                .size(),
+            100);
+}
+
+TEST(StringArrayModelTest, concat) {
+  auto a = make_strings({"abc", "de"});
+  auto b = make_strings({"f"});
+  const auto ab = concat(std::vector{a, b}, Dim::X);
+  a = Variable{};
+  b = Variable{};
+  EXPECT_EQ(to_strings(ab), (std::vector<std::string>{"abc", "de", "f"}));
+}
+
+TEST(StringArrayModelTest, equals_compares_characters) {
+  EXPECT_EQ(make_strings({"abc", "de"}), make_strings({"abc", "de"}));
+  EXPECT_NE(make_strings({"abc", "de"}), make_strings({"abc", "df"}));
+}
+
+TEST(StringArrayModelTest, sort) {
+  const auto var = make_strings({"b", "c", "a"});
+  EXPECT_EQ(to_strings(sort(var, Dim::X, SortOrder::Ascending)),
+            (std::vector<std::string>{"a", "b", "c"}));
+}
+
+TEST(StringArrayModelTest, copy_binned) {
+  auto buffer = make_strings({"abc", "de", "f"});
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{2}, Values{std::pair{0, 1}, std::pair{1, 3}});
+  auto binned = make_bins(indices, Dim::X, buffer);
+  buffer = Variable{};
+  const auto copied = copy(binned.slice({Dim::Y, 1}));
+  binned = Variable{};
+  EXPECT_EQ(to_strings(copied.bin_buffer<Variable>()),
+            (std::vector<std::string>{"de", "f"}));
+}
@@ -69,3 +69,38 @@ TEST(SumPrecisionTest, sum_float) {
   EXPECT_EQ(nansum(var, Dim::X),
             makeVariable<float>(Values{init + (N / 2) * 1.0}));
 }
+
+TEST_F(SumTest, masked_sum_into) {
+  auto accum = makeVariable<double>(Dims{Dim::Y}, Shape{2}, units::m);
+  const auto mask =
+      makeVariable<bool>(Dims{Dim::X}, Shape{2}, Values{false, true});
+  masked_sum_into(accum, var, mask);
+  EXPECT_EQ(accum, makeVariable<double>(Dims{Dim::Y}, Shape{2}, units::m,
+                                        Values{1.0, 3.0}));
+}
+
+TEST_F(SumTest, masked_sum_into_bool) {
+  auto accum = makeVariable<int64_t>(Dims{Dim::X}, Shape{2}, units::m);
+  const auto mask =
+      makeVariable<bool>(Dims{Dim::Y}, Shape{2}, Values{true, false});
+  masked_sum_into(accum, var_bool, mask);
+  EXPECT_EQ(accum, makeVariable<int64_t>(Dims{Dim::X}, Shape{2}, units::m,
+                                         Values{1, 1}));
+}
+
+TEST_F(SumTest, masked_sum_into_large) {
+  // Large enough to be chunked across threads by accumulate.
+  const scipp::index n = 100000;
+  const auto ones = copy(broadcast(makeVariable<float>(Values{1.0}),
+                                   Dimensions{Dim::X, n}));
+  auto mask = makeVariable<bool>(Dims{Dim::X}, Shape{n});
+  for (scipp::index i = 0; i < n; i += 3)
+    mask.values<bool>()[i] = true;
+  const auto expected = static_cast<double>(n - (n + 2) / 3);
+  auto accum = makeVariable<float>(Values{0.0});
+  masked_sum_into(accum, ones, mask);
+  EXPECT_EQ(accum, makeVariable<float>(Values{expected}));
+  auto nan_accum = makeVariable<double>(Values{0.0});
+  masked_nansum_into(nan_accum, ones, mask);
+  EXPECT_EQ(nan_accum, makeVariable<double>(Values{expected}));
+}
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
+#include <numeric>
 #include <vector>
 
 #include "test_macros.h"
@@ -210,6 +211,30 @@ TEST_P(TransformBinaryDenseTest, transposed_layout) {
   EXPECT_EQ(b_in_place, ba);
 }
 
+TEST_F(TransformBinaryTest, transposed_layout_larger_than_tile) {
+  // Operands with different memory order are processed in tiles, make sure
+  // that partial tiles and outer dims are handled.
+  const Dimensions dims{{Dim::X, 3}, {Dim::Y, 130}, {Dim::Z, 70}};
+  auto a = makeVariable<double>(dims, Values{}, Variances{});
+  std::iota(a.values<double>().begin(), a.values<double>().end(), 0.0);
+  std::iota(a.variances<double>().begin(), a.variances<double>().end(), 1.0);
+  const auto b = copy(transpose(a, std::vector<Dim>{Dim::Z, Dim::Y, Dim::X}));
+  for (scipp::index x = 0; x < 3; ++x)
+    for (scipp::index y = 0; y < 130; ++y)
+      for (scipp::index z = 0; z < 70; ++z) {
+        ASSERT_EQ(b.values<double>()[(z * 130 + y) * 3 + x],
+                  a.values<double>()[(x * 130 + y) * 70 + z]);
+        ASSERT_EQ(b.variances<double>()[(z * 130 + y) * 3 + x],
+                  a.variances<double>()[(x * 130 + y) * 70 + z]);
+      }
+
+  const auto expected = transform<pair_self_t<double>>(a, a, op, name);
+  EXPECT_EQ(transform<pair_self_t<double>>(a, b, op, name), expected);
+  auto a_in_place = copy(a);
+  transform_in_place<double>(a_in_place, b, op_in_place, name);
+  EXPECT_EQ(a_in_place, expected);
+}
+
 TEST_F(TransformBinaryTest, dims_and_shape_fail_in_place) {
   auto a = makeVariable<double>(Dims{Dim::X}, Shape{2});
   auto b = makeVariable<double>(Dims{Dim::Y}, Shape{2});
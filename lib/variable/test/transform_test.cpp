@@ -11,6 +11,7 @@
 
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/bins.h"
+#include "scipp/variable/shape.h"
 #include "scipp/variable/transform.h"
 #include "scipp/variable/util.h"
 #include "scipp/variable/variable.h"
@@ -105,6 +106,33 @@ TEST(TransformTest, combined_uncertainty_propagation) {
   EXPECT_EQ(abb, a_2_step);
 }
 
+TEST(TransformTest, flat_and_strided_operands_give_same_result) {
+  // Large enough to be split into multiple tasks.
+  const Dimensions dims{{Dim::Y, 300}, {Dim::X, 400}};
+  auto a = makeVariable<double>(dims, Values{}, Variances{});
+  auto b = makeVariable<double>(dims, Values{}, Variances{});
+  for (scipp::index i = 0; i < dims.volume(); ++i) {
+    a.values<double>()[i] = 0.5 * i;
+    a.variances<double>()[i] = 0.1 * i;
+    b.values<double>()[i] = 3.0 - i;
+    b.variances<double>()[i] = 0.2;
+  }
+  // Transposing `b` in memory prevents iteration with a single flat index.
+  const auto b_transposed = transpose(copy(transpose(b)));
+  EXPECT_EQ(b_transposed, b);
+  const auto op = [](const auto &x, const auto &y) { return x * y + y; };
+  const auto flat = transform<pair_self_t<double>>(a, b, op, name);
+  EXPECT_EQ(flat, transform<pair_self_t<double>>(a, b_transposed, op, name));
+
+  const auto op_in_place = [](auto &x, const auto &y) { x = x * y + y; };
+  auto strided = copy(a);
+  transform_in_place<pair_self_t<double>>(a, b, op_in_place, name);
+  transform_in_place<pair_self_t<double>>(strided, b_transposed, op_in_place,
+                                          name);
+  EXPECT_EQ(a, flat);
+  EXPECT_EQ(strided, flat);
+}
+
 // It is possible to use transform with functors that call non-built-in
 // functions. To do so we have to define that function for the ValueAndVariance
 // helper. If this turns out to be a useful feature we should move
@@ -2,11 +2,14 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include <optional>
+
 #include "scipp/core/except.h"
 #include "scipp/units/unit.h"
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/reduction.h"
 #include "scipp/variable/util.h"
+#include "scipp/variable/variable_concept.h"
 
 #include "test_macros.h"
 
@@ -82,6 +85,136 @@ TEST(LinspaceTest, increasing_2d) {
             expected);
 }
 
+namespace {
+using Property = variable::PropertyCache::Property;
+
+auto cached(const Variable &var, const Property property) {
+  return var.data().property_cache().get(property);
+}
+} // namespace
+
+TEST(LinspaceTest, memoizes_islinspace_of_result) {
+  const auto var = linspace(1.0 * units::one, 4.0 * units::one, Dim::X, 4);
+  EXPECT_EQ(cached(var, Property::Linspace), true);
+  const auto decreasing =
+      linspace(4.0 * units::one, 1.0 * units::one, Dim::X, 4);
+  EXPECT_EQ(cached(decreasing, Property::Linspace), false);
+}
+
+TEST(LinspaceTest, mutable_access_clears_memoized_linspace) {
+  auto var = linspace(1.0 * units::one, 4.0 * units::one, Dim::X, 4);
+  var.values<double>()[1] = 3.0;
+  EXPECT_EQ(cached(var, Property::Linspace), std::nullopt);
+  EXPECT_FALSE(islinspace(var, Dim::X).value<bool>());
+}
+
+TEST(LinspaceTest, islinspace_of_slice_of_linspace) {
+  const auto var = linspace(1.0 * units::one, 8.0 * units::one, Dim::X, 8);
+  EXPECT_TRUE(islinspace(var.slice({Dim::X, 2, 6}), Dim::X).value<bool>());
+  // Single element is not a linspace, the fast path must not change this.
+  EXPECT_EQ(islinspace(var.slice({Dim::X, 2, 3}), Dim::X),
+            islinspace(copy(var.slice({Dim::X, 2, 3})), Dim::X));
+}
+
+TEST(LinspaceTest, mark_linspace_ignores_views) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1, 2, 4, 8});
+  auto slice = var.slice({Dim::X, 0, 2});
+  mark_linspace(slice);
+  EXPECT_EQ(cached(var, Property::Linspace), std::nullopt);
+  auto var2d = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                                    Values{1, 2, 3, 4});
+  mark_linspace(var2d);
+  EXPECT_EQ(cached(var2d, Property::Linspace), std::nullopt);
+}
+
+TEST(LinspaceTest, mark_linspace_ignores_unsupported_dtypes) {
+  auto var = makeVariable<int8_t>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  EXPECT_NO_THROW(mark_linspace(var));
+  EXPECT_EQ(cached(var, Property::Linspace), std::nullopt);
+  auto flags = makeVariable<bool>(Dims{Dim::X}, Shape{2}, Values{false, true});
+  EXPECT_NO_THROW(mark_linspace(flags));
+}
+
+TEST(PropertyCacheTest, issorted_is_memoized) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1, 2, 4, 8});
+  EXPECT_TRUE(allsorted(var, Dim::X, SortOrder::Ascending));
+  EXPECT_FALSE(allsorted(var, Dim::X, SortOrder::Descending));
+  EXPECT_EQ(cached(var, Property::SortedAscending), true);
+  EXPECT_EQ(cached(var, Property::SortedDescending), false);
+  var.values<double>()[0] = 10.0;
+  EXPECT_EQ(cached(var, Property::SortedAscending), std::nullopt);
+  EXPECT_FALSE(allsorted(var, Dim::X, SortOrder::Ascending));
+}
+
+TEST(PropertyCacheTest, sorted_carries_over_to_strided_slice) {
+  const auto var =
+      makeVariable<double>(Dims{Dim::X}, Shape{6}, Values{1, 2, 3, 5, 7, 8});
+  EXPECT_TRUE(allsorted(var, Dim::X, SortOrder::Ascending));
+  const auto sliced = var.slice({Dim::X, 1, 6, 2});
+  EXPECT_TRUE(allsorted(sliced, Dim::X, SortOrder::Ascending));
+  // Nothing is memoized for a slice.
+  EXPECT_EQ(cached(copy(sliced), Property::SortedAscending), std::nullopt);
+}
+
+TEST(PropertyCacheTest, unsorted_whole_buffer_does_not_apply_to_slice) {
+  const auto var =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1, 2, 3, 0});
+  EXPECT_FALSE(allsorted(var, Dim::X, SortOrder::Ascending));
+  EXPECT_TRUE(
+      allsorted(var.slice({Dim::X, 0, 3}), Dim::X, SortOrder::Ascending));
+}
+
+TEST(PropertyCacheTest, setslice_clears_cache) {
+  auto var = linspace(1.0 * units::one, 4.0 * units::one, Dim::X, 4);
+  EXPECT_TRUE(allsorted(var, Dim::X, SortOrder::Ascending));
+  var.setSlice({Dim::X, 0}, 10.0 * units::one);
+  EXPECT_FALSE(islinspace(var, Dim::X).value<bool>());
+  EXPECT_FALSE(allsorted(var, Dim::X, SortOrder::Ascending));
+}
+
+TEST(PropertyCacheTest, in_place_operation_clears_cache) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  EXPECT_TRUE(allsorted(var, Dim::X, SortOrder::Ascending));
+  var *= -1.0 * units::one;
+  EXPECT_FALSE(allsorted(var, Dim::X, SortOrder::Ascending));
+  EXPECT_TRUE(allsorted(var, Dim::X, SortOrder::Descending));
+}
+
+TEST(PropertyCacheTest, disable) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  var.data().property_cache().disable();
+  EXPECT_TRUE(allsorted(var, Dim::X, SortOrder::Ascending));
+  EXPECT_EQ(cached(var, Property::SortedAscending), std::nullopt);
+  // A copy has a new buffer, which is not exposed.
+  const auto var_copy = copy(var);
+  EXPECT_TRUE(allsorted(var_copy, Dim::X, SortOrder::Ascending));
+  EXPECT_EQ(cached(var_copy, Property::SortedAscending), true);
+}
+
+TEST(PropertyCacheTest, set_after_clear_is_dropped) {
+  variable::PropertyCache cache;
+  const auto generation = cache.generation();
+  cache.clear();
+  cache.set(Property::Linspace, true, generation);
+  cache.set_min(std::make_shared<const Variable>(1.0 * units::one),
+                generation);
+  EXPECT_EQ(cache.get(Property::Linspace), std::nullopt);
+  EXPECT_EQ(cache.min(), nullptr);
+  cache.set(Property::Linspace, true, cache.generation());
+  EXPECT_EQ(cache.get(Property::Linspace), true);
+}
+
+TEST(PropertyCacheTest, clear_is_noop_until_generation_is_obtained) {
+  variable::PropertyCache cache;
+  cache.clear();
+  const auto generation = cache.generation();
+  EXPECT_EQ(generation, 0);
+  cache.set(Property::Linspace, true, generation);
+  cache.clear();
+  EXPECT_EQ(cache.generation(), 1);
+  EXPECT_EQ(cache.get(Property::Linspace), std::nullopt);
+}
+
 TEST(UtilTest, values_variances) {
   const auto var = makeVariable<double>(Values{1}, Variances{2}, units::m);
   EXPECT_EQ(values(var), 1.0 * units::m);
@@ -2,6 +2,8 @@
 // Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <optional>
+
 #include "scipp/variable/util.h"
 #include "scipp/core/element/util.h"
 #include "scipp/core/except.h"
@@ -11,6 +13,8 @@
 #include "scipp/variable/reduction.h"
 #include "scipp/variable/subspan_view.h"
 #include "scipp/variable/transform.h"
+#include "scipp/variable/variable_concept.h"
+#include "scipp/variable/variable_factory.h"
 
 using namespace scipp::core;
 
@@ -40,19 +44,113 @@ Variable linspace(const Variable &start, const Variable &stop, const Dim dim,
                      range,
          out.slice({dim, i}));
   copy(stop, out.slice({dim, num - 1})); // endpoint included
-  return out;
+  return mark_linspace(out);
 }
 
+namespace {
+using Property = PropertyCache::Property;
+
+/// Return the memoized `property` of the 1-D `var`, if known.
+///
+/// Properties are memoized for the whole buffer in memory order. Sortedness
+/// therefore carries over to any 1-D view with positive stride, and linear
+/// spacing to any 1-D view with unit stride and at least two elements.
+std::optional<bool> lookup(const Variable &var, const Dim dim,
+                           const Property property) {
+  if (var.ndim() != 1 || !var.dims().contains(dim) || is_bins(var) ||
+      var.has_variances())
+    return std::nullopt;
+  const auto &cache = var.data().property_cache();
+  if (!var.is_slice())
+    if (const auto value = cache.get(property))
+      return value;
+  const auto known = [&cache](const Property p) {
+    return cache.get(p) == std::optional{true};
+  };
+  const auto stride = var.stride(dim);
+  switch (property) {
+  case Property::Linspace:
+    if (stride == 1 && var.dims()[dim] >= 2 && known(Property::Linspace))
+      return true;
+    break;
+  case Property::SortedAscending:
+    // islinspace implies strictly increasing elements.
+    if (stride >= 1 &&
+        (known(Property::SortedAscending) || known(Property::Linspace)))
+      return true;
+    break;
+  case Property::SortedDescending:
+    if (stride >= 1 && known(Property::SortedDescending))
+      return true;
+    break;
+  }
+  return std::nullopt;
+}
+
+/// Return the generation of the property cache of `var`, to be obtained before
+/// computing a property that is passed to `record`.
+uint64_t generation(const Variable &var) {
+  return var.data().property_cache().generation();
+}
+
+/// Memoize `property` if `var` is a 1-D view of its whole buffer and has not
+/// been modified since `generation` was obtained.
+bool record(const Variable &var, const Property property, const bool value,
+            const uint64_t generation) {
+  if (var.ndim() == 1 && !var.is_slice() && !is_bins(var) &&
+      !var.has_variances())
+    var.data().property_cache().set(property, value, generation);
+  return value;
+}
+} // namespace
+
+/// Return a variable of True, if variable values are evenly spaced and
+/// increasing along given dim.
+///
+/// The result for 1-D variables is memoized, repeated calls are O(1) unless the
+/// variable is modified in the meantime.
 Variable islinspace(const Variable &var, const Dim dim) {
-  return transform(subspan_view(var, dim), core::element::islinspace,
-                   "islinspace");
+  if (const auto known = lookup(var, dim, Property::Linspace))
+    return makeVariable<bool>(units::one, Values{*known});
+  const auto before = generation(var);
+  auto out = transform(subspan_view(var, dim), core::element::islinspace,
+                       "islinspace");
+  if (var.ndim() == 1)
+    record(var, Property::Linspace, out.value<bool>(), before);
+  return out;
+}
+
+/// Memoize whether `var` is evenly spaced and increasing, such that subsequent
+/// calls to `islinspace` need not inspect its elements.
+///
+/// This is called by creation functions such as `linspace`, such that the
+/// result of the first call to `islinspace` is known in advance.
+/// Variables of dtypes not supported by `islinspace` are returned unchanged.
+Variable &mark_linspace(Variable &var) {
+  const auto type = var.dtype();
+  if (var.ndim() != 1 || var.has_variances() ||
+      !(type == dtype<double> || type == dtype<float> ||
+        type == dtype<int64_t> || type == dtype<int32_t> ||
+        type == dtype<core::time_point>))
+    return var;
+  if (!lookup(var, var.dim(), Property::Linspace))
+    static_cast<void>(islinspace(var, var.dim()));
+  return var;
 }
 
 /// Return a variable of True, if variable values are sorted along given dim.
 ///
 /// If `order` is SortOrder::Ascending, checks if values are non-decreasing.
 /// If `order` is SortOrder::Descending, checks if values are non-increasing.
+/// The result for 1-D variables is memoized, repeated calls are O(1) unless the
+/// variable is modified in the meantime.
 Variable issorted(const Variable &x, const Dim dim, const SortOrder order) {
+  const auto property = order == SortOrder::Ascending
+                            ? Property::SortedAscending
+                            : Property::SortedDescending;
+  if (const auto known = lookup(x, dim, property))
+    return makeVariable<bool>(units::none, Values{*known});
+  const auto before = generation(x);
   auto dims = x.dims();
   dims.erase(dim);
   auto out = variable::ones(dims, units::none, dtype<bool>);
@@ -67,6 +165,8 @@ Variable issorted(const Variable &x, const Dim dim, const SortOrder order) {
     accumulate_in_place(out, x.slice({dim, 0, size - 1}),
                         x.slice({dim, 1, size}),
                         core::element::issorted_nonascending, "issorted");
+  if (x.ndim() == 1)
+    record(x, property, out.value<bool>(), before);
   return out;
 }
 
@@ -100,6 +200,10 @@ void fill_zeros(Variable &var) {
   transform_in_place(var, core::element::fill_zeros, "fill_zeros");
 }
 
+bool is_contiguous(const Variable &var) {
+  return core::Strides(var.strides()) == core::Strides(var.dims());
+}
+
 /// Return elements chosen from x or y depending on condition.
 Variable where(const Variable &condition, const Variable &x,
                const Variable &y) {
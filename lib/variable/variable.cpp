@@ -18,7 +18,8 @@ namespace scipp::variable {
 namespace {
 /// Types that default to unit=units::dimensionless. Everything else is
 /// units::none.
-const std::tuple<double, float, int64_t, int32_t, core::time_point,
+const std::tuple<double, float, int64_t, int32_t, int16_t, int8_t, uint64_t,
+                 uint32_t, uint16_t, uint8_t, core::float16, core::time_point,
                  Eigen::Vector3d, Eigen::Matrix3d, Eigen::Affine3d,
                  core::Quaternion, core::Translation>
     default_dimensionless_dtypes;
@@ -1,8 +1,21 @@
+#include <stdexcept>
+
 #include "scipp/variable/variable_concept.h"
 #include "scipp/core/dimensions.h"
+#include "scipp/variable/variable.h"
 
 namespace scipp::variable {
 
 VariableConcept::VariableConcept(const units::Unit &unit) : m_unit(unit) {}
 
+void VariableConcept::copy_batch(const scipp::span<const Variable> src,
+                                 const scipp::span<Variable> dest) const {
+  if (src.size() != dest.size())
+    throw std::invalid_argument("Number of sources and destinations differs.");
+  for (size_t i = 0; i < src.size(); ++i)
+    copy(src[i], dest[i]);
+}
+
+void VariableConcept::share_storage(const VariableConcept &) {}
+
 } // namespace scipp::variable
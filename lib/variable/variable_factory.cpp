@@ -70,6 +70,10 @@ bool VariableFactory::has_variances(const Variable &var) const {
   return m_makers.at(var.dtype())->has_variances(var);
 }
 
+const Variable &VariableFactory::data(const Variable &var) const {
+  return m_makers.at(var.dtype())->data(var);
+}
+
 Variable VariableFactory::empty_like(const Variable &prototype,
                                      const std::optional<Dimensions> &shape,
                                      const Variable &sizes) {
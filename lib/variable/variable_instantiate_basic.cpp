@@ -14,6 +14,13 @@ INSTANTIATE_ELEMENT_ARRAY_VARIABLE(float64, double)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(float32, float)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(int64, int64_t)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(int32, int32_t)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(int16, int16_t)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(int8, int8_t)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(uint64, uint64_t)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(uint32, uint32_t)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(uint16, uint16_t)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(uint8, uint8_t)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(float16, scipp::core::float16)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(bool, bool)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(datetime64, scipp::core::time_point)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(Variable, Variable)
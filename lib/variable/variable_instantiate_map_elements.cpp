@@ -32,6 +32,36 @@ INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_float32_to_int64_t,
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_float32_to_int32_t,
                                    std::unordered_map<int32_t, int32_t>)
 
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_int16_to_int64_t,
+                                   std::unordered_map<int16_t, int64_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_int16_to_int32_t,
+                                   std::unordered_map<int16_t, int32_t>)
+
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_int8_to_int64_t,
+                                   std::unordered_map<int8_t, int64_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_int8_to_int32_t,
+                                   std::unordered_map<int8_t, int32_t>)
+
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_uint64_to_int64_t,
+                                   std::unordered_map<uint64_t, int64_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_uint64_to_int32_t,
+                                   std::unordered_map<uint64_t, int32_t>)
+
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_uint32_to_int64_t,
+                                   std::unordered_map<uint32_t, int64_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_uint32_to_int32_t,
+                                   std::unordered_map<uint32_t, int32_t>)
+
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_uint16_to_int64_t,
+                                   std::unordered_map<uint16_t, int64_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_uint16_to_int32_t,
+                                   std::unordered_map<uint16_t, int32_t>)
+
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_uint8_to_int64_t,
+                                   std::unordered_map<uint8_t, int64_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_uint8_to_int32_t,
+                                   std::unordered_map<uint8_t, int32_t>)
+
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_bool_to_int64_t,
                                    std::unordered_map<bool, int64_t>)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_bool_to_int32_t,
@@ -42,6 +72,13 @@ INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_string_to_int64_t,
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(unordered_map_string_to_int32_t,
                                    std::unordered_map<std::string, int32_t>)
 
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(
+    unordered_map_categorical_string_to_int64_t,
+    std::unordered_map<core::categorical_string, int64_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(
+    unordered_map_categorical_string_to_int32_t,
+    std::unordered_map<core::categorical_string, int32_t>)
+
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(
     unordered_map_datetime64_to_int64_t,
     std::unordered_map<core::time_point, int64_t>)
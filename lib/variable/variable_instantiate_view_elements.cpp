@@ -20,6 +20,24 @@ INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_int64, scipp::span<const int64_t>)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_int32, scipp::span<const int32_t>)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_int64, scipp::span<int64_t>)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_int32, scipp::span<int32_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_int16, scipp::span<const int16_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_int16, scipp::span<int16_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_int8, scipp::span<const int8_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_int8, scipp::span<int8_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_uint64,
+                                   scipp::span<const uint64_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_uint64, scipp::span<uint64_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_uint32,
+                                   scipp::span<const uint32_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_uint32, scipp::span<uint32_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_uint16,
+                                   scipp::span<const uint16_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_uint16, scipp::span<uint16_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_uint8, scipp::span<const uint8_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_uint8, scipp::span<uint8_t>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_float16,
+                                   scipp::span<const core::float16>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_float16, scipp::span<core::float16>)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_bool, scipp::span<const bool>)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_bool, scipp::span<bool>)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_datetime64,
@@ -29,6 +47,14 @@ INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_datetime64,
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_string,
                                    scipp::span<const std::string>)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_string, scipp::span<std::string>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_categorical_string,
+                                   scipp::span<const core::categorical_string>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_categorical_string,
+                                   scipp::span<core::categorical_string>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_string_view,
+                                   scipp::span<const std::string_view>)
+INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_string_view,
+                                   scipp::span<std::string_view>)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_const_vector_3_float64,
                                    scipp::span<const Eigen::Vector3d>)
 INSTANTIATE_ELEMENT_ARRAY_VARIABLE(span_vector_3_float64,
@@ -68,11 +68,12 @@ from .core import less, greater, less_equal, greater_equal, equal, not_equal, id
 from .core import counts_to_density, density_to_counts
 from .core import cumsum
 from .core import merge
+from .core import get_num_threads, set_num_threads
 from .core import groupby
 from .core import logical_not, logical_and, logical_or, logical_xor
 from .core import abs, nan_to_num, norm, reciprocal, pow, sqrt, exp, log, log10, round, floor, ceil, erf, erfc, midpoints
 from .core import dot, islinspace, issorted, allsorted, cross, sort, values, variances, stddevs, where
-from .core import mean, nanmean, sum, nansum, min, max, nanmin, nanmax, all, any
+from .core import argmin, argmax, topk, mean, nanmean, median, nanmedian, quantile, sum, nansum, min, max, nanmin, nanmax, all, any
 from .core import broadcast, concat, fold, flatten, squeeze, transpose
 from .core import sin, cos, tan, asin, acos, atan, atan2
 from .core import isnan, isinf, isfinite, isposinf, isneginf, to_unit
@@ -91,11 +92,16 @@ from . import _binding
 _binding.bind_get()
 _binding.bind_pop()
 _binding.bind_conversion_to_builtin(Variable)
+for _cls in (Variable, DataArray, Dataset):
+    _binding.bind_pickle(_cls)
+del _cls
 # Assign method binding for all containers
 for _cls in (Variable, DataArray, Dataset):
     _binding.bind_functions_as_methods(_cls, globals(),
-                                       ('sum', 'nansum', 'mean', 'nanmean', 'max',
-                                        'min', 'nanmax', 'nanmin', 'all', 'any'))
+                                       ('sum', 'nansum', 'mean', 'nanmean', 'median',
+                                        'nanmedian', 'quantile', 'max', 'min', 'nanmax',
+                                        'nanmin', 'all', 'any', 'argmin', 'argmax',
+                                        'topk'))
 del _cls
 # Assign method binding for both Variable and DataArray
 for _cls in (Variable, DataArray):
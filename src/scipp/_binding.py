@@ -57,6 +57,15 @@ def bind_conversion_to_builtin(cls):
     setattr(cls, '__float__', _convert_to_method(name='__float__', func=_float_dunder))
 
 
+def _reduce(self):
+    from .serialization import serialize, deserialize
+    return deserialize, serialize(self)
+
+
+def bind_pickle(cls):
+    setattr(cls, '__reduce__', _convert_to_method(name='__reduce__', func=_reduce))
+
+
 class _NoDefaultType:
 
     def __repr__(self):
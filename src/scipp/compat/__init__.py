@@ -3,7 +3,8 @@
 # @file
 # @author Jan-Lukas Wynen
 
+from .arrow_compat import from_arrow, to_arrow
 from .pandas_compat import from_pandas
 from .xarray_compat import from_xarray, to_xarray
 
-__all__ = ['from_pandas', 'from_xarray', 'to_xarray']
+__all__ = ['from_arrow', 'from_pandas', 'from_xarray', 'to_arrow', 'to_xarray']
@@ -0,0 +1,90 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+
+from __future__ import annotations
+
+from typing import TYPE_CHECKING
+
+from .._scipp.core import Variable, _from_arrow_c_array, _to_arrow_c_array
+
+if TYPE_CHECKING:
+    import pyarrow as pa
+
+
+class _ArrowExport:
+    """Implements the Arrow PyCapsule interface for a variable."""
+
+    def __init__(self, var: Variable):
+        self._var = var
+
+    def __arrow_c_array__(self, requested_schema=None):
+        if requested_schema is not None:
+            raise NotImplementedError(
+                "Exporting to Arrow with a requested schema is not supported.")
+        return _to_arrow_c_array(self._var)
+
+
+def to_arrow(var: Variable) -> pa.Array:
+    """Convert a variable to a pyarrow array.
+
+    Numeric and datetime values are shared with ``var`` if it is contiguous,
+    i.e., not a slice or transpose. Multi-dimensional variables are flattened,
+    their dims and the unit are stored in the field metadata such that
+    :py:func:`scipp.compat.from_arrow` can restore them.
+
+    Binned variables are converted to a large list array of structs, with one
+    field for the data and each coord, mask, and attr of the bin contents. The
+    bin indices are used as list offsets. Only binned variables with a single
+    dimension are supported, use :py:func:`scipp.flatten` to combine multiple
+    dimensions first.
+
+    Parameters
+    ----------
+    var:
+        The variable to convert. Must not have variances, except for the data
+        of binned variables.
+
+    Raises
+    ------
+    scipp.DimensionError
+        If ``var`` is binned and has more than one dimension.
+
+    Returns
+    -------
+    :
+        The converted pyarrow array.
+
+    See Also
+    --------
+    scipp.compat.from_arrow
+    """
+    import pyarrow as pa
+    return pa.array(_ArrowExport(var))
+
+
+def from_arrow(array: pa.Array) -> Variable:
+    """Convert a pyarrow array to a read-only variable.
+
+    Numeric, datetime, and string arrays are shared without copying. Arrays
+    created by :py:func:`scipp.compat.to_arrow` retain dims and unit, other
+    arrays have the single dim ``'row'``. Large lists of structs are converted
+    to binned variables, where fields without role metadata become coords of
+    the bin contents, except for a field named ``'data'``.
+
+    Parameters
+    ----------
+    array:
+        The array to convert. Must not contain null values.
+
+    Returns
+    -------
+    :
+        The converted variable.
+
+    See Also
+    --------
+    scipp.compat.to_arrow
+    """
+    if hasattr(array, 'combine_chunks'):
+        array = array.combine_chunks()
+    return _from_arrow_c_array(*array.__arrow_c_array__())
@@ -65,11 +65,12 @@ from .comparison import less, greater, less_equal, greater_equal, equal, not_equ
 from .counts import counts_to_density, density_to_counts
 from .cumulative import cumsum
 from .dataset import irreducible_mask, merge
+from .execution_config import get_num_threads, set_num_threads
 from .groupby import groupby
 from .logical import logical_not, logical_and, logical_or, logical_xor
 from .math import abs, cross, dot, nan_to_num, norm, reciprocal, pow, sqrt, exp, log, log10, round, floor, ceil, erf, erfc, midpoints
 from .operations import islinspace, issorted, allsorted, sort, values, variances, stddevs, where, to
-from .reduction import mean, nanmean, sum, nansum, min, max, nanmin, nanmax, all, any
+from .reduction import argmin, argmax, topk, mean, nanmean, median, nanmedian, quantile, sum, nansum, min, max, nanmin, nanmax, all, any
 from .shape import broadcast, concat, fold, flatten, squeeze, transpose
 from .trigonometry import sin, cos, tan, asin, acos, atan, atan2
 from .unary import isnan, isinf, isfinite, isposinf, isneginf, to_unit
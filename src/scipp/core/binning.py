@@ -521,6 +521,9 @@ def _make_groups(x, arg):
             unique = np.unique(values[:len(values) // pivot])
     else:
         unique = np.unique(coord.values)
+    if coord.dtype == _cpp.DType.categorical_string:
+        # np.unique returns plain strings, keep the encoding of the input
+        return array(dims=[arg], values=unique, unit=coord.unit, dtype=coord.dtype)
     return array(dims=[arg], values=unique, unit=coord.unit)
 
 
@@ -236,6 +236,68 @@ class Bins:
         """
         return _call_cpp_func(_cpp.bins_nanmean, self._obj)
 
+    def median(self) -> Union[_cpp.Variable, _cpp.DataArray]:
+        """Median of events in each bin.
+
+        Returns
+        -------
+        :
+            The median of each of the input bins.
+
+        See Also
+        --------
+        scipp.median:
+            For calculating the median of non-bin data or across bins.
+        """
+        return _call_cpp_func(_cpp.bins_median, self._obj)
+
+    def nanmedian(self) -> Union[_cpp.Variable, _cpp.DataArray]:
+        """Median of events in each bin ignoring NaN's.
+
+        Returns
+        -------
+        :
+            The median of each of the input bins without NaN's.
+
+        See Also
+        --------
+        scipp.nanmedian:
+            For calculating the median of non-bin data or across bins.
+        """
+        return _call_cpp_func(_cpp.bins_nanmedian, self._obj)
+
+    def argmin(self) -> Union[_cpp.Variable, _cpp.DataArray]:
+        """Index of the minimum of events in each bin.
+
+        Returns
+        -------
+        :
+            The index of the minimum within each of the input bins, or -1 for
+            empty bins.
+
+        See Also
+        --------
+        scipp.argmin:
+            For finding the minimum of non-bin data.
+        """
+        return _call_cpp_func(_cpp.bins_argmin, self._obj)
+
+    def argmax(self) -> Union[_cpp.Variable, _cpp.DataArray]:
+        """Index of the maximum of events in each bin.
+
+        Returns
+        -------
+        :
+            The index of the maximum within each of the input bins, or -1 for
+            empty bins.
+
+        See Also
+        --------
+        scipp.argmax:
+            For finding the maximum of non-bin data.
+        """
+        return _call_cpp_func(_cpp.bins_argmax, self._obj)
+
     def max(self) -> Union[_cpp.Variable, _cpp.DataArray]:
         """Maximum of events in each bin.
 
@@ -0,0 +1,42 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+# @author Simon Heybrock
+
+from typing import Optional
+
+from .._scipp import core as _cpp
+
+
+def get_num_threads() -> int:
+    """Return the maximum number of threads used by scipp.
+
+    Returns
+    -------
+    :
+        The number of threads set with :py:func:`scipp.set_num_threads`, or the
+        number of available cores if it was not set.
+    """
+    return _cpp.get_num_threads()
+
+
+def set_num_threads(n: Optional[int] = None) -> None:
+    """Set the maximum number of threads used by scipp.
+
+    This must not be called while other threads run scipp operations.
+
+    Parameters
+    ----------
+    n:
+        Maximum number of threads. If ``None``, all available cores are used.
+
+    Examples
+    --------
+
+      >>> sc.set_num_threads(2)
+      >>> sc.get_num_threads()
+      2
+      >>> sc.set_num_threads()
+    """
+    if n is not None and n < 1:
+        raise ValueError(f"Number of threads must be positive, got {n}.")
+    _cpp.set_num_threads(0 if n is None else n)
@@ -3,13 +3,20 @@
 # @author Simon Heybrock
 
 from __future__ import annotations
-from typing import Optional
+from typing import Optional, Sequence, Union
 
 from .._scipp import core as _cpp
 from ..typing import VariableLikeType
 
 
-def mean(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+def _reduce_dims(name: str, x: VariableLikeType,
+                 dims: Sequence[str]) -> VariableLikeType:
+    # All dims are reduced in a single pass, applying masks once.
+    return getattr(_cpp, name)(x, dim=list(dims))
+
+
+def mean(x: VariableLikeType,
+         dim: Union[str, Sequence[str], None] = None) -> VariableLikeType:
     """Arithmetic mean of elements in the input.
 
     If the input has variances, the variances stored in the output are based on
@@ -26,7 +33,7 @@ def mean(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     x: scipp.typing.VariableLike
         Input data.
     dim:
-        Dimension along which to calculate the mean. If not
+        Dimension or dimensions along which to calculate the mean. If not
         given, the mean over all dimensions is calculated.
 
     Returns
@@ -41,11 +48,14 @@ def mean(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     """
     if dim is None:
         return _cpp.mean(x)
+    elif not isinstance(dim, str):
+        return _reduce_dims('mean', x, dim)
     else:
         return _cpp.mean(x, dim=dim)
 
 
-def nanmean(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+def nanmean(x: VariableLikeType,
+            dim: Union[str, Sequence[str], None] = None) -> VariableLikeType:
     """Arithmetic mean of elements in the input ignoring NaN's.
 
     If the input has variances, the variances stored in the output are based on
@@ -62,7 +72,7 @@ def nanmean(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     x: scipp.typing.VariableLike
         Input data.
     dim:
-        Dimension along which to calculate the mean. If not
+        Dimension or dimensions along which to calculate the mean. If not
         given, the nanmean over all dimensions is calculated.
 
     Returns
@@ -77,25 +87,126 @@ def nanmean(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     """
     if dim is None:
         return _cpp.nanmean(x)
+    elif not isinstance(dim, str):
+        return _reduce_dims('nanmean', x, dim)
     else:
         return _cpp.nanmean(x, dim=dim)
 
 
-def sum(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+def median(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+    """Median of elements in the input.
+
+    If the number of elements is even, the median is the average of the two
+    middle elements, as in :py:func:`numpy.median`. Masked elements are ignored.
+    The median is computed using a selection algorithm with linear average
+    complexity, i.e., the input is not sorted.
+
+    Parameters
+    ----------
+    x: scipp.typing.VariableLike
+        Input data. Variances are not supported.
+    dim:
+        Dimension along which to calculate the median. If not
+        given, the median over all dimensions is calculated.
+
+    Returns
+    -------
+    : Same type as x
+        The median of the input values.
+        The result has dtype float64, unless the input is float32.
+
+    See Also
+    --------
+    scipp.nanmedian:
+        Ignore NaN's when calculating the median.
+    scipp.quantile:
+        Compute arbitrary quantiles.
+    """
+    if dim is None:
+        return _cpp.median(x)
+    else:
+        return _cpp.median(x, dim=dim)
+
+
+def nanmedian(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+    """Median of elements in the input ignoring NaN's.
+
+    See :py:func:`scipp.median` for details.
+
+    Parameters
+    ----------
+    x: scipp.typing.VariableLike
+        Input data. Variances are not supported.
+    dim:
+        Dimension along which to calculate the median. If not
+        given, the median over all dimensions is calculated.
+
+    Returns
+    -------
+    : Same type as x
+        The median of the input values which are not NaN.
+
+    See Also
+    --------
+    scipp.median:
+        Compute the median without special handling of NaN.
+    """
+    if dim is None:
+        return _cpp.nanmedian(x)
+    else:
+        return _cpp.nanmedian(x, dim=dim)
+
+
+def quantile(x: VariableLikeType,
+             q: float,
+             dim: Optional[str] = None) -> VariableLikeType:
+    """Quantile of elements in the input.
+
+    Values between data points are obtained using linear interpolation, as in
+    :py:func:`numpy.quantile` with the default ``method='linear'``.
+    Masked elements are ignored, NaN values propagate to the result.
+
+    Parameters
+    ----------
+    x: scipp.typing.VariableLike
+        Input data. Variances are not supported.
+    q:
+        Quantile to compute, must be in the range [0, 1].
+    dim:
+        Dimension along which to calculate the quantile. If not
+        given, the quantile over all dimensions is calculated.
+
+    Returns
+    -------
+    : Same type as x
+        The q-th quantile of the input values.
+
+    See Also
+    --------
+    scipp.median:
+        Equivalent to ``quantile`` with ``q=0.5``.
+    """
+    if dim is None:
+        return _cpp.quantile(x, q)
+    else:
+        return _cpp.quantile(x, q, dim=dim)
+
+
+def sum(x: VariableLikeType,
+        dim: Union[str, Sequence[str], None] = None) -> VariableLikeType:
     """Sum of elements in the input.
 
     If the input data is in single precision (dtype='float32') this internally uses
     double precision (dtype='float64') to reduce the effect of accumulated rounding
-    errors. If multiple dimensions are reduced, the current implementation casts back
-    to float32 after handling each dimension, i.e., the result is equivalent to what
-    would be obtained from manually summing individual dimensions.
+    errors. Variables are reduced over multiple dimensions in a single pass, so the
+    result is cast back to float32 only once.
 
     Parameters
     ----------
     x: scipp.typing.VariableLike
         Input data.
     dim:
-        Optional dimension along which to calculate the sum. If not
+        Optional dimension or dimensions along which to calculate the sum. If not
         given, the sum over all dimensions is calculated.
 
     Returns
@@ -110,11 +221,14 @@ def sum(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     """
     if dim is None:
         return _cpp.sum(x)
+    elif not isinstance(dim, str):
+        return _reduce_dims('sum', x, dim)
     else:
         return _cpp.sum(x, dim=dim)
 
 
-def nansum(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+def nansum(x: VariableLikeType,
+           dim: Union[str, Sequence[str], None] = None) -> VariableLikeType:
     """Sum of elements in the input ignoring NaN's.
 
     See :py:func:`scipp.sum` on how rounding errors for float32 inputs are handled.
@@ -124,7 +238,7 @@ def nansum(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     x: scipp.typing.VariableLike
         Input data.
     dim:
-        Optional dimension along which to calculate the sum. If not
+        Optional dimension or dimensions along which to calculate the sum. If not
         given, the sum over all dimensions is calculated.
 
     Returns
@@ -139,11 +253,14 @@ def nansum(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     """
     if dim is None:
         return _cpp.nansum(x)
+    elif not isinstance(dim, str):
+        return _reduce_dims('nansum', x, dim)
     else:
         return _cpp.nansum(x, dim=dim)
 
 
-def min(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+def min(x: VariableLikeType,
+        dim: Union[str, Sequence[str], None] = None) -> VariableLikeType:
     """Minimum of elements in the input.
 
     Parameters
@@ -151,7 +268,7 @@ def min(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     x: scipp.typing.VariableLike
         Input data.
     dim:
-        Optional dimension along which to calculate the min. If not
+        Optional dimension or dimensions along which to calculate the min. If not
         given, the min over all dimensions is calculated.
 
     Returns
@@ -170,11 +287,14 @@ def min(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     """
     if dim is None:
         return _cpp.min(x)
+    elif not isinstance(dim, str):
+        return _reduce_dims('min', x, dim)
     else:
         return _cpp.min(x, dim=dim)
 
 
-def max(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+def max(x: VariableLikeType,
+        dim: Union[str, Sequence[str], None] = None) -> VariableLikeType:
     """Maximum of elements in the input.
 
     Parameters
@@ -182,7 +302,7 @@ def max(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     x: scipp.typing.VariableLike
         Input data.
     dim:
-        Optional dimension along which to calculate the max. If not
+        Optional dimension or dimensions along which to calculate the max. If not
         given, the max over all dimensions is calculated.
 
     Returns
@@ -201,11 +321,14 @@ def max(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     """
     if dim is None:
         return _cpp.max(x)
+    elif not isinstance(dim, str):
+        return _reduce_dims('max', x, dim)
     else:
         return _cpp.max(x, dim=dim)
 
 
-def nanmin(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+def nanmin(x: VariableLikeType,
+           dim: Union[str, Sequence[str], None] = None) -> VariableLikeType:
     """Minimum of elements in the input ignoring NaN's.
 
     Parameters
@@ -213,7 +336,7 @@ def nanmin(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     x: scipp.typing.VariableLike
         Input data.
     dim:
-        Optional dimension along which to calculate the min. If not
+        Optional dimension or dimensions along which to calculate the min. If not
         given, the min over all dimensions is calculated.
 
     Returns
@@ -232,11 +355,14 @@ def nanmin(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     """
     if dim is None:
         return _cpp.nanmin(x)
+    elif not isinstance(dim, str):
+        return _reduce_dims('nanmin', x, dim)
     else:
         return _cpp.nanmin(x, dim=dim)
 
 
-def nanmax(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+def nanmax(x: VariableLikeType,
+           dim: Union[str, Sequence[str], None] = None) -> VariableLikeType:
     """Maximum of elements in the input ignoring NaN's.
 
     Parameters
@@ -244,7 +370,7 @@ def nanmax(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     x: scipp.typing.VariableLike
         Input data.
     dim:
-        Optional dimension along which to calculate the max. If not
+        Optional dimension or dimensions along which to calculate the max. If not
         given, the max over all dimensions is calculated.
 
     Returns
@@ -263,11 +389,14 @@ def nanmax(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     """
     if dim is None:
         return _cpp.nanmax(x)
+    elif not isinstance(dim, str):
+        return _reduce_dims('nanmax', x, dim)
     else:
         return _cpp.nanmax(x, dim=dim)
 
 
-def all(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+def all(x: VariableLikeType,
+        dim: Union[str, Sequence[str], None] = None) -> VariableLikeType:
     """Logical AND over input values.
 
     Parameters
@@ -275,7 +404,7 @@ def all(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     x: scipp.typing.VariableLike
         Input data.
     dim:
-        Optional dimension along which to calculate the AND. If not
+        Optional dimension or dimensions along which to calculate the AND. If not
         given, the AND over all dimensions is calculated.
 
     Returns
@@ -291,11 +420,14 @@ def all(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     """
     if dim is None:
         return _cpp.all(x)
+    elif not isinstance(dim, str):
+        return _reduce_dims('all', x, dim)
     else:
         return _cpp.all(x, dim=dim)
 
 
-def any(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
+def any(x: VariableLikeType,
+        dim: Union[str, Sequence[str], None] = None) -> VariableLikeType:
     """Logical OR over input values.
 
     Parameters
@@ -303,7 +435,7 @@ def any(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     x: scipp.typing.VariableLike
         Input data.
     dim:
-        Optional dimension along which to calculate the OR. If not
+        Optional dimension or dimensions along which to calculate the OR. If not
         given, the OR over all dimensions is calculated.
 
     Returns
@@ -319,5 +451,93 @@ def any(x: VariableLikeType, dim: Optional[str] = None) -> VariableLikeType:
     """
     if dim is None:
         return _cpp.any(x)
+    elif not isinstance(dim, str):
+        return _reduce_dims('any', x, dim)
     else:
         return _cpp.any(x, dim=dim)
+
+
+def argmin(x: VariableLikeType, dim: str) -> VariableLikeType:
+    """Index of the minimum of elements in the input along a dimension.
+
+    Masked elements are skipped. As in :py:func:`numpy.argmin`, the index of the
+    first NaN is returned if there are NaN's. Variances are not considered.
+
+    Parameters
+    ----------
+    x: scipp.typing.VariableLike
+        Input data.
+    dim:
+        Dimension along which to find the minimum.
+
+    Returns
+    -------
+    : Same type as x
+        Index of the minimum along ``dim`` with dtype int64, or -1 if there are
+        no unmasked elements.
+
+    See Also
+    --------
+    scipp.argmax:
+        Index of the maximum.
+    """
+    return _cpp.argmin(x, dim=dim)
+
+
+def argmax(x: VariableLikeType, dim: str) -> VariableLikeType:
+    """Index of the maximum of elements in the input along a dimension.
+
+    Masked elements are skipped. As in :py:func:`numpy.argmax`, the index of the
+    first NaN is returned if there are NaN's. Variances are not considered.
+
+    Parameters
+    ----------
+    x: scipp.typing.VariableLike
+        Input data.
+    dim:
+        Dimension along which to find the maximum.
+
+    Returns
+    -------
+    : Same type as x
+        Index of the maximum along ``dim`` with dtype int64, or -1 if there are
+        no unmasked elements.
+
+    See Also
+    --------
+    scipp.argmin:
+        Index of the minimum.
+    scipp.topk:
+        The k largest elements.
+    """
+    return _cpp.argmax(x, dim=dim)
+
+
+def topk(x: VariableLikeType, k: int, dim: str) -> VariableLikeType:
+    """The k largest elements in the input along a dimension, in descending order.
+
+    Masked elements and NaN's are skipped. If there are fewer than ``k`` elements
+    the remainder of the output is filled with NaN, or with the lowest representable
+    value for integer dtypes.
+
+    Parameters
+    ----------
+    x: scipp.typing.VariableLike
+        Input data. Variances are not supported.
+    k:
+        Number of elements to return.
+    dim:
+        Dimension along which to find the largest elements.
+
+    Returns
+    -------
+    : Same type as x
+        The ``k`` largest elements, with length ``k`` along ``dim``.
+        Coordinates and masks depending on ``dim`` are dropped.
+
+    See Also
+    --------
+    scipp.argmax:
+        Index of the maximum.
+    """
+    return _cpp.topk(x, k=k, dim=dim)
@@ -591,10 +591,11 @@ def linspace(dim: str,
       <scipp.Variable> (x: 4)    float64              [m]  [1.5, 2, 2.5, 3]
     """
     range_args, unit = _normalize_range_args(unit=unit, start=start, stop=stop)
-    return array(dims=[dim],
-                 values=_np.linspace(**range_args, num=num, endpoint=endpoint),
-                 unit=unit,
-                 dtype=dtype)
+    return _cpp._mark_linspace(
+        array(dims=[dim],
+              values=_np.linspace(**range_args, num=num, endpoint=endpoint),
+              unit=unit,
+              dtype=dtype))
 
 
 def geomspace(dim: str,
@@ -772,7 +773,8 @@ def arange(dim: str,
                                              start=start,
                                              stop=stop,
                                              step=step)
-    return array(dims=[dim], values=_np.arange(**range_args), unit=unit, dtype=dtype)
+    return _cpp._mark_linspace(
+        array(dims=[dim], values=_np.arange(**range_args), unit=unit, dtype=dtype))
 
 
 @contextmanager
@@ -5,4 +5,5 @@
 
 # flake8: noqa
 
+from .binary import load, save
 from .hdf5 import open_hdf5
@@ -0,0 +1,52 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+# @file
+
+from __future__ import annotations
+from pathlib import Path
+from typing import Union
+
+from ..typing import VariableLike
+
+
+def save(obj: VariableLike, filename: Union[str, Path]):
+    """Write an object to a file in the native binary format of scipp.
+
+    The file consists of a small header and the raw memory of all buffers of
+    the object, including bin indices and event buffers. Writing is a single
+    pass over the data, so this is suited for checkpointing intermediate
+    results. Files use the byte order of the machine that wrote them and the
+    format may change between releases. Use
+    :py:meth:`scipp.DataArray.to_hdf5` for archiving data.
+
+    :param obj: Variable, data array, or dataset to write.
+    :param filename: Name of the file to write, replaced if it exists. The
+                     file is replaced only once writing is complete, so
+                     objects loaded from it remain valid.
+    :raises: DTypeError if the object contains variables of unsupported dtype,
+             such as ``PyObject``.
+
+    See also
+    --------
+    scipp.io.load
+    """
+    from .._scipp import core
+    core._save(obj, filename=str(filename))
+
+
+def load(filename: Union[str, Path], *, mmap: bool = True) -> VariableLike:
+    """Read an object written by :py:func:`scipp.io.save`.
+
+    :param filename: Name of the file to read.
+    :param mmap: If True, map the file into memory and use the mapped memory
+                 for the buffers of all variables. Data is read from disk on
+                 first access. Modifying the returned object does not modify
+                 the file. If False, read the full file into memory.
+    :return: Variable, data array, or dataset stored in the file.
+
+    See also
+    --------
+    scipp.io.save
+    """
+    from .._scipp import core
+    return core._load(str(filename), mmap=mmap)
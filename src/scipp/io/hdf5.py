@@ -4,8 +4,9 @@
 # @author Simon Heybrock
 
 from __future__ import annotations
+import copy
 from pathlib import Path
-from typing import Union
+from typing import Dict, List, Optional, Tuple, Union
 
 from ..logging import get_logger
 from ..typing import VariableLike
@@ -17,10 +18,11 @@ def _dtype_lut():
     # handling, but will do as we add support for other types such as
     # variable-length strings.
     dtypes = [
-        d.float64, d.float32, d.int64, d.int32, d.bool, d.datetime64, d.string,
-        d.Variable, d.DataArray, d.Dataset, d.VariableView, d.DataArrayView,
-        d.DatasetView, d.vector3, d.linear_transform3, d.affine_transform3,
-        d.translation3, d.rotation3
+        d.float64, d.float32, d.float16, d.int64, d.int32, d.int16, d.int8,
+        d.uint64, d.uint32, d.uint16, d.uint8, d.bool, d.datetime64, d.string,
+        d.categorical_string, d.Variable, d.DataArray, d.Dataset, d.VariableView,
+        d.DataArrayView, d.DatasetView, d.vector3, d.linear_transform3,
+        d.affine_transform3, d.translation3, d.rotation3
     ]
     names = [str(dtype) for dtype in dtypes]
     return dict(zip(names, dtypes))
@@ -144,6 +146,20 @@ class StringDataIO:
                 data.values[i] = values[i]
 
 
+class CategoricalStringDataIO:
+    write = StringDataIO.write
+
+    @staticmethod
+    def read(group, data):
+        # Elements refer to the dictionary of the variable, so they can only be
+        # assigned all at once.
+        values = group['values'].asstr()[()]
+        if len(data.shape) == 0:
+            data.value = values
+        else:
+            data.values = values.ravel().tolist()
+
+
 def _write_scipp_header(group, what):
     from .._scipp import __version__
     group.attrs['scipp-version'] = __version__
@@ -163,7 +179,8 @@ def _data_handler_lut():
     from .._scipp.core import DType as d
     handler = {}
     for dtype in [
-            d.float64, d.float32, d.int64, d.int32, d.bool, d.datetime64, d.vector3,
+            d.float64, d.float32, d.float16, d.int64, d.int32, d.int16, d.int8,
+            d.uint64, d.uint32, d.uint16, d.uint8, d.bool, d.datetime64, d.vector3,
             d.linear_transform3, d.rotation3, d.translation3, d.affine_transform3
     ]:
         handler[str(dtype)] = NumpyDataIO
@@ -173,6 +190,8 @@ def _data_handler_lut():
         handler[str(dtype)] = ScippDataIO
     for dtype in [d.string]:
         handler[str(dtype)] = StringDataIO
+    for dtype in [d.categorical_string]:
+        handler[str(dtype)] = CategoricalStringDataIO
     return handler
 
 
@@ -324,16 +343,264 @@ class HDF5IO:
         return cls._handlers[group.attrs['scipp-type']].read(group, **kwargs)
 
 
-def to_hdf5(obj: VariableLike, filename: Union[str, Path]):
-    """
-    Writes object out to file in hdf5 format.
-    """
+def _to_hdf5_h5py(obj: VariableLike, filename: Union[str, Path]):
     import h5py
     with h5py.File(filename, 'w') as f:
         HDF5IO.write(f, obj)
 
 
-def open_hdf5(filename: Union[str, Path]) -> VariableLike:
+def to_hdf5(obj: VariableLike,
+            filename: Union[str, Path],
+            *,
+            compression: Optional[str] = None,
+            compression_opts: Optional[int] = None,
+            shuffle: bool = False,
+            chunk_size: Optional[int] = None):
+    """
+    Writes object out to file in hdf5 format.
+
+    Values and variances are written directly from memory by a native writer.
+    Objects containing dtypes not supported by the native writer, such as
+    ``PyObject`` or nested scipp objects, are written using h5py.
+
+    :param obj: Object to write.
+    :param filename: Name of the file to write, replaced if it exists.
+    :param compression: Compression filter, ``None`` or ``'gzip'``.
+    :param compression_opts: Compression level, 0-9 for gzip. Defaults to 4.
+    :param shuffle: Apply the shuffle filter before compression.
+    :param chunk_size: Target size of chunks in bytes. Defaults to contiguous
+                       storage without compression and 1 MiB with compression.
+    """
+    from .._scipp import core as _cpp
+    from ..core import DTypeError
+    try:
+        _cpp._to_hdf5(obj,
+                      str(filename),
+                      compression=compression,
+                      compression_opts=compression_opts,
+                      shuffle=shuffle,
+                      chunk_bytes=chunk_size)
+    except DTypeError:
+        _to_hdf5_h5py(obj, filename)
+
+
+def _open_hdf5_h5py(filename: Union[str, Path]) -> VariableLike:
     import h5py
     with h5py.File(filename, 'r') as f:
         return HDF5IO.read(f)
+
+
+def _as_slices(slices: Dict[str, Union[int, slice]],
+               sizes: Dict[str, int]) -> List[Tuple[str, int, Optional[int]]]:
+    from ..core import DimensionError
+    out = []
+    for dim, s in slices.items():
+        if dim not in sizes:
+            raise DimensionError(f"Cannot slice dimension '{dim}', expected one of "
+                                 f"{list(sizes)}.")
+        if isinstance(s, slice):
+            begin, end, stride = s.indices(sizes[dim])
+            if stride != 1:
+                raise ValueError("Slices with stride are not supported.")
+            out.append((dim, begin, max(begin, end)))
+        else:
+            index = s + sizes[dim] if s < 0 else s
+            out.append((dim, index, None))
+    return out
+
+
+class LazyHDF5:
+    """
+    Proxy of a Variable, DataArray, or Dataset stored in an HDF5 file.
+
+    Slicing the proxy, by position or by label, does not read data but returns
+    a new proxy recording the slice. Only the coord is read for label-based
+    slicing. Data is read on the first access of any other attribute, e.g.,
+    ``values`` or ``coords``, by arithmetic operations, or by :py:meth:`load`.
+    Only the selected parts of the file are read.
+
+    Free functions such as :py:func:`scipp.sum` do not accept the proxy and
+    raise ``TypeError``. Use :py:meth:`load` to pass the data to them, e.g.,
+    ``sc.sum(lazy['x', 0:10].load())``.
+    """
+
+    def __init__(self, filename: Union[str, Path]):
+        from .._scipp import core as _cpp
+        self._filename = str(filename)
+        self._type = _cpp._hdf5_object_type(self._filename)
+        self._file_sizes = _cpp._hdf5_sizes(self._filename)
+        # Dim to (begin, end) in the file, end is None for positions.
+        self._slices = {}
+        self._loaded = None
+
+    @property
+    def sizes(self) -> Dict[str, int]:
+        """Sizes of the object after slicing, without reading data."""
+        sizes = {}
+        for dim, size in self._file_sizes.items():
+            if dim not in self._slices:
+                sizes[dim] = size
+            elif (end := self._slices[dim][1]) is not None:
+                sizes[dim] = end - self._slices[dim][0]
+        return sizes
+
+    @property
+    def dims(self) -> Tuple[str, ...]:
+        return tuple(self.sizes)
+
+    @property
+    def shape(self) -> Tuple[int, ...]:
+        return tuple(self.sizes.values())
+
+    @property
+    def ndim(self) -> int:
+        return len(self.sizes)
+
+    def _params(self) -> List[Tuple[str, int, Optional[int]]]:
+        return [(dim, begin, end) for dim, (begin, end) in self._slices.items()]
+
+    def _sliced(self, dim: str, begin: int, end: Optional[int]) -> LazyHDF5:
+        offset = self._slices.get(dim, (0, None))[0]
+        out = copy.copy(self)
+        out._slices = {
+            **self._slices, dim: (offset + begin, None if end is None else offset + end)
+        }
+        out._loaded = None
+        return out
+
+    def _label_slice_params(self, dim: str, **kwargs) -> Tuple:
+        from .._scipp import core as _cpp
+        from ..core import DTypeError
+        try:
+            return _cpp._hdf5_slice_params(self._filename, self._params(), dim,
+                                           **kwargs)
+        except DTypeError:
+            # The coord cannot be read natively, e.g., since the file was
+            # written by h5py. Positions are found in the loaded object.
+            return _label_slice_params_in_memory(self.load(), dim, **kwargs)
+
+    def __getitem__(self, key) -> LazyHDF5:
+        from ..core import DimensionError, Variable
+        dim, index = key
+        sizes = self.sizes
+        if isinstance(index, Variable):
+            dim, i = self._label_slice_params(dim, value=index)
+            return self._sliced(dim, i, None)
+        if isinstance(index, slice) and (isinstance(index.start, Variable)
+                                         or isinstance(index.stop, Variable)):
+            if index.step is not None:
+                raise RuntimeError("Step cannot be specified for value based slicing.")
+            dim, begin, end = self._label_slice_params(dim,
+                                                       begin=index.start,
+                                                       end=index.stop)
+            return self._sliced(dim, begin, end)
+        if dim not in sizes:
+            raise DimensionError(f"Expected dimension to be in {list(sizes)}, "
+                                 f"got {dim}.")
+        if isinstance(index, slice):
+            begin, end, stride = index.indices(sizes[dim])
+            if stride != 1:
+                raise ValueError("Slices with stride are not supported.")
+            return self._sliced(dim, begin, max(begin, end))
+        if not -sizes[dim] <= index < sizes[dim]:
+            raise IndexError(f"The requested index {index} is out of range. "
+                             f"Dimension size is {sizes[dim]}.")
+        return self._sliced(dim, index % sizes[dim], None)
+
+    def load(self) -> VariableLike:
+        """Read the selected part of the object from the file."""
+        if self._loaded is None:
+            self._loaded = open_hdf5(self._filename,
+                                     slices={
+                                         dim: begin if end is None else slice(
+                                             begin, end)
+                                         for dim, (begin, end) in self._slices.items()
+                                     })
+        return self._loaded
+
+    def __getattr__(self, name):
+        # Only called for attributes not defined by the proxy.
+        if name.startswith('__'):
+            raise AttributeError(name)
+        return getattr(self.load(), name)
+
+    def __repr__(self) -> str:
+        return (f'<scipp.io.hdf5.LazyHDF5 ({self._type}) sizes={self.sizes}, '
+                f'file={self._filename!r}>')
+
+
+def _label_slice_params_in_memory(obj: VariableLike,
+                                  dim: str,
+                                  *,
+                                  value=None,
+                                  begin=None,
+                                  end=None) -> Tuple:
+    """
+    Return the positions selected by label-based slicing of ``obj``, in the
+    format returned by ``_hdf5_slice_params``.
+    """
+    from ..core import DataArray, arange
+    positions = DataArray(arange(dim, obj.sizes[dim], unit=None),
+                          coords={dim: obj.coords[dim]})
+    if value is not None:
+        return dim, int(positions[dim, value].value)
+    selected = positions[dim, begin:end].data
+    first = int(selected.values[0]) if selected.shape[0] > 0 else 0
+    return dim, first, first + selected.shape[0]
+
+
+def _forward_operator(name):
+
+    def op(self, *args):
+        return getattr(self.load(), name)(*args)
+
+    op.__name__ = name
+    return op
+
+
+for _name in [
+        '__add__', '__radd__', '__sub__', '__rsub__', '__mul__', '__rmul__',
+        '__truediv__', '__rtruediv__', '__floordiv__', '__rfloordiv__', '__mod__',
+        '__rmod__', '__pow__', '__rpow__', '__neg__', '__abs__', '__eq__', '__ne__',
+        '__lt__', '__le__', '__gt__', '__ge__'
+]:
+    setattr(LazyHDF5, _name, _forward_operator(_name))
+del _name
+
+
+def open_hdf5(filename: Union[str, Path],
+              *,
+              slices: Optional[Dict[str, Union[int, slice]]] = None,
+              lazy: bool = False) -> Union[VariableLike, LazyHDF5]:
+    """
+    Read an object written by :py:func:`scipp.io.to_hdf5` or
+    :py:meth:`scipp.DataArray.to_hdf5`.
+
+    Compressed data is decompressed in parallel. If ``slices`` are given only
+    the selected parts of the data are read from the file.
+
+    :param filename: Name of the file to read.
+    :param slices: Dict of dim to integer index or slice without stride. The
+                   result is equivalent to slicing the full object.
+    :param lazy: If True, return a :py:class:`LazyHDF5` proxy, which reads data
+                 only when it is accessed. Slicing the proxy selects which parts
+                 are read.
+    """
+    from .._scipp import core as _cpp
+    from ..core import DTypeError
+    filename = str(filename)
+    if slices is None:
+        slices = {}
+    if lazy:
+        out = LazyHDF5(filename)
+        for dim, s in slices.items():
+            out = out[dim, s]
+        return out
+    try:
+        return _cpp._open_hdf5(filename,
+                               _as_slices(slices, _cpp._hdf5_sizes(filename)))
+    except DTypeError:
+        obj = _open_hdf5_h5py(filename)
+        for dim, s in slices.items():
+            obj = obj[dim, s]
+        return obj.copy()
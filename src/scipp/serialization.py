@@ -1,32 +1,143 @@
 # SPDX-License-Identifier: BSD-3-Clause
 # Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
 # @author Simon Heybrock
-from .core import Variable, DataArray, Dataset
+from ._scipp import core as _cpp
+from .core import Variable, DataArray, Dataset, DTypeError
 from typing import List, Dict, Tuple, Union
 
+# Frames are buffers, e.g., NumPy arrays or bytes
+Frames = List
 
-def serialize(var: Union[Variable, DataArray, Dataset]) -> Tuple[Dict, List[bytes]]:
-    """Serialize scipp object."""
+
+def _serialize_variable(var: Variable, frames: Frames) -> Dict:
+    if var.bins is not None:
+        constituents = var.bins.constituents
+        return {
+            'kind': 'binned',
+            'dim': constituents['dim'],
+            'begin': _serialize_variable(constituents['begin'], frames),
+            'end': _serialize_variable(constituents['end'], frames),
+            'data': _serialize(constituents['data'], frames)
+        }
+    header, var_frames = _cpp._variable_to_frames(var)
+    header['kind'] = 'Variable'
+    header['frames'] = [len(frames), len(frames) + len(var_frames)]
+    frames.extend(var_frames)
+    return header
+
+
+def _serialize_mapping(mapping, frames: Frames) -> Dict:
+    return {
+        str(name): _serialize_variable(var, frames)
+        for name, var in mapping.items()
+    }
+
+
+def _serialize_data_array(da: DataArray, frames: Frames, coords: bool = True) -> Dict:
+    header = {
+        'kind': 'DataArray',
+        'name': da.name,
+        'data': _serialize_variable(da.data, frames),
+        'masks': _serialize_mapping(da.masks, frames),
+        'attrs': _serialize_mapping(da.attrs, frames)
+    }
+    if coords:
+        header['coords'] = _serialize_mapping(da.coords, frames)
+    return header
+
+
+def _serialize(obj: Union[Variable, DataArray, Dataset], frames: Frames) -> Dict:
+    if isinstance(obj, Variable):
+        return _serialize_variable(obj, frames)
+    if isinstance(obj, DataArray):
+        return _serialize_data_array(obj, frames)
+    # Items share the dataset coords, which are serialized once
+    return {
+        'kind': 'Dataset',
+        'coords': _serialize_mapping(obj.coords, frames),
+        'items': {
+            name: _serialize_data_array(da, frames, coords=False)
+            for name, da in obj.items()
+        }
+    }
+
+
+def _deserialize_variable(header: Dict, frames: Frames) -> Variable:
+    if header['kind'] == 'binned':
+        return _cpp.bins(begin=_deserialize_variable(header['begin'], frames),
+                         end=_deserialize_variable(header['end'], frames),
+                         dim=header['dim'],
+                         data=_deserialize(header['data'], frames))
+    begin, end = header['frames']
+    return _cpp._variable_from_frames(header, list(frames[begin:end]))
+
+
+def _deserialize_mapping(header: Dict, frames: Frames) -> Dict:
+    return {
+        name: _deserialize_variable(item, frames)
+        for name, item in header.items()
+    }
+
+
+def _deserialize(header: Dict, frames: Frames) -> Union[Variable, DataArray, Dataset]:
+    kind = header['kind']
+    if kind == 'Dataset':
+        return Dataset(coords=_deserialize_mapping(header['coords'], frames),
+                       data={
+                           name: _deserialize(item, frames)
+                           for name, item in header['items'].items()
+                       })
+    if kind == 'DataArray':
+        return DataArray(data=_deserialize_variable(header['data'], frames),
+                         coords=_deserialize_mapping(header.get('coords', {}), frames),
+                         masks=_deserialize_mapping(header['masks'], frames),
+                         attrs=_deserialize_mapping(header['attrs'], frames),
+                         name=header['name'])
+    return _deserialize_variable(header, frames)
+
+
+def _serialize_hdf5(var: Union[Variable, DataArray, Dataset]) -> Tuple[Dict, Frames]:
     from io import BytesIO
     from .io.hdf5 import HDF5IO
     import h5py
-    header = {}
     buf = BytesIO()
     with h5py.File(buf, "w") as f:
         HDF5IO.write(f, var)
-    frames = [buf.getvalue()]
-    return header, frames
+    return {}, [buf.getvalue()]
 
 
-def deserialize(header: Dict,
-                frames: List[bytes]) -> Union[Variable, DataArray, Dataset]:
-    """Deserialize scipp object."""
+def _deserialize_hdf5(frames: Frames) -> Union[Variable, DataArray, Dataset]:
     from io import BytesIO
     from .io.hdf5 import HDF5IO
     import h5py
     return HDF5IO.read(h5py.File(BytesIO(frames[0]), "r"))
 
 
+def serialize(var: Union[Variable, DataArray, Dataset]) -> Tuple[Dict, Frames]:
+    """Serialize scipp object.
+
+    Returns a header describing the structure, dims, units, and dtypes of ``var``,
+    and a list of frames holding the data. Frames refer to the memory of ``var``
+    without copying if the underlying variables are contiguous. Objects with dtypes
+    that do not support this, such as ``PyObject``, are serialized using HDF5.
+    """
+    frames = []
+    try:
+        return {'scipp': _serialize(var, frames)}, frames
+    except DTypeError:
+        return _serialize_hdf5(var)
+
+
+def deserialize(header: Dict, frames: Frames) -> Union[Variable, DataArray, Dataset]:
+    """Deserialize scipp object.
+
+    Writable frames are used without copying, read-only frames are copied.
+    """
+    if 'scipp' in header:
+        return _deserialize(header['scipp'], frames)
+    return _deserialize_hdf5(frames)
+
+
 try:
     from distributed.protocol import register_serialization
     register_serialization(Variable, serialize, deserialize)
@@ -186,6 +186,67 @@ def test_group_after_bin_considers_event_value():
     assert da.sizes == {'label': 10}
 
 
+@pytest.mark.parametrize('dtype',
+                         ['int8', 'int16', 'uint8', 'uint16', 'uint32', 'uint64'])
+def test_group_by_narrow_integer_coord(dtype):
+    table = sc.data.table_xyz(100)
+    table.coords['label'] = (table.coords['x'] * 10).to(dtype=dtype)
+    table.coords['pulse'] = sc.arange('row', 100, dtype='uint16', unit=None)
+    da = table.group('label')
+    assert da.coords['label'].dtype == dtype
+    assert da.sizes['label'] == len(np.unique(table.coords['label'].values))
+    assert da.bins.size().sum().value == 100
+    assert da.bins.coords['pulse'].dtype == 'uint16'
+    assert sc.identical(da.bins.concat().value.coords['pulse'].sum(),
+                        table.coords['pulse'].sum())
+
+
+def test_group_by_categorical_string_coord():
+    table = sc.data.table_xyz(100)
+    labels = ['bank1', 'bank2', 'bank3']
+    table.coords['bank'] = sc.array(dims=['row'],
+                                    values=[labels[i % 3] for i in range(100)],
+                                    dtype=sc.DType.categorical_string)
+    da = table.group('bank')
+    assert da.coords['bank'].dtype == sc.DType.categorical_string
+    assert list(da.coords['bank'].values) == labels
+    assert da.bins.size().sum().value == 100
+    plain = table.copy()
+    plain.coords['bank'] = sc.array(dims=['row'],
+                                    values=[labels[i % 3] for i in range(100)])
+    assert sc.identical(da.bins.size().data, plain.group('bank').bins.size().data)
+
+
+def test_categorical_string_values_can_be_assigned():
+    var = sc.array(dims=['x'], values=['a', 'b'], dtype=sc.DType.categorical_string)
+    var.values = ['c', 'a']
+    assert list(var.values) == ['c', 'a']
+    var['x', 1].value = 'd'
+    assert list(var.values) == ['c', 'd']
+    with pytest.raises(ValueError):
+        var.values[0] = 'e'
+
+
+def test_categorical_string_outlives_source():
+    var = sc.array(dims=['x'], values=['a', 'b'], dtype=sc.DType.categorical_string)
+    copied = var.copy()
+    concatenated = sc.concat([var, var['x', :1]], 'x')
+    del var
+    assert list(copied.values) == ['a', 'b']
+    assert list(concatenated.values) == ['a', 'b', 'a']
+
+
+def test_bin_string_view_coord():
+    table = sc.data.table_xyz(100)
+    names = [f'event-{i}' for i in range(100)]
+    table.coords['name'] = sc.array(dims=['row'],
+                                    values=names,
+                                    dtype=sc.DType.string_view)
+    da = table.bin(x=4)
+    del table
+    assert da.bins.coords['name'].dtype == sc.DType.string_view
+    assert sorted(da.bins.concat().value.coords['name'].values) == sorted(names)
+
 def test_group_by_2d():
     table = sc.data.table_xyz(100)
     table.coords['label'] = (table.coords['x'] * 10).to(dtype='int64')
@@ -261,6 +261,57 @@ def test_bins_mean_with_masks():
     assert binned.bins.mean().unit == sc.units.counts
 
 
+def test_bins_median():
+    data = sc.DataArray(data=sc.Variable(dims=['position'],
+                                         unit=sc.units.counts,
+                                         values=[0.4, 0.25, 0.75, np.nan, 0.5]),
+                        coords={
+                            'x':
+                            sc.Variable(dims=['position'],
+                                        unit=sc.units.m,
+                                        values=[1, 2, 3, 4, 5])
+                        },
+                        masks={
+                            'test-mask':
+                            sc.Variable(dims=['position'],
+                                        values=[True, False, False, False, False])
+                        })
+    xbins = sc.Variable(dims=['x'], unit=sc.units.m, values=[0, 5, 6, 7])
+    binned = data.bin(x=xbins)
+
+    # First bin contains NaN
+    assert isnan(binned.bins.median().values[0])
+    # Median of [0.25, 0.75] (0.4 is masked)
+    assert binned.bins.nanmedian().values[0] == 0.5
+    assert binned.bins.median().values[1] == 0.5
+    assert isnan(binned.bins.median().values[2])
+    assert binned.bins.median().unit == sc.units.counts
+
+
+def test_bins_argmin_argmax():
+    data = sc.DataArray(data=sc.Variable(dims=['position'],
+                                         values=[0.4, 0.2, 0.3, 0.1, 0.5]),
+                        coords={
+                            'x':
+                            sc.Variable(dims=['position'],
+                                        unit=sc.units.m,
+                                        values=[1, 2, 3, 4, 5])
+                        },
+                        masks={
+                            'test-mask':
+                            sc.Variable(dims=['position'],
+                                        values=[True, False, False, False, False])
+                        })
+    xbins = sc.Variable(dims=['x'], unit=sc.units.m, values=[0, 5, 6, 7])
+    binned = data.bin(x=xbins)
+
+    # Index within bin, 0.4 is masked
+    assert binned.bins.argmax().values[0] == 2
+    assert binned.bins.argmin().values[0] == 3
+    assert binned.bins.argmax().values[1] == 0
+    assert binned.bins.argmax().values[2] == -1
+
+
 def test_bins_mean_using_bins():
     # Call to sc.bins gives different data structure compared to sc.bin
 
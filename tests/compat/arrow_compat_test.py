@@ -0,0 +1,97 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+
+import numpy as np
+import pytest
+import scipp as sc
+from scipp.compat import from_arrow, to_arrow
+
+pa = pytest.importorskip('pyarrow', minversion='14')
+
+
+def _address(var):
+    return var.values.__array_interface__['data'][0]
+
+
+def test_to_arrow_does_not_copy():
+    var = sc.arange('x', 5.0, unit='m')
+    array = to_arrow(var)
+    assert array.type == pa.float64()
+    assert array.buffers()[1].address == _address(var)
+    assert array.to_pylist() == [0.0, 1.0, 2.0, 3.0, 4.0]
+
+
+def test_from_arrow_does_not_copy():
+    array = pa.array(np.arange(5, dtype=np.int64))
+    var = from_arrow(array)
+    assert var.dims == ('row', )
+    assert var.dtype == sc.DType.int64
+    assert _address(var) == array.buffers()[1].address
+    assert not var.values.flags.writeable
+
+
+def test_round_trip_restores_dims_and_unit():
+    var = sc.array(dims=['y', 'x'], values=np.arange(6.0).reshape(2, 3), unit='m')
+    result = from_arrow(to_arrow(var))
+    assert sc.identical(result, var)
+    assert _address(result) == _address(var)
+
+
+def test_round_trip_slice_copies():
+    var = sc.array(dims=['y', 'x'], values=np.arange(6.0).reshape(2, 3), unit='m')
+    assert sc.identical(from_arrow(to_arrow(var['x', 1:])), var['x', 1:])
+
+
+def test_round_trip_datetime():
+    var = sc.datetimes(dims=['x'], values=[1, 2, 3], unit='us')
+    array = to_arrow(var)
+    assert array.type == pa.timestamp('us')
+    assert sc.identical(from_arrow(array), var)
+
+
+def test_round_trip_strings():
+    var = sc.array(dims=['x'], values=['a', '', 'bcd'])
+    array = to_arrow(var)
+    assert array.type == pa.large_string()
+    assert array.to_pylist() == ['a', '', 'bcd']
+    assert list(from_arrow(array).values) == ['a', '', 'bcd']
+
+
+def test_from_arrow_raises_with_nulls():
+    with pytest.raises(ValueError):
+        from_arrow(pa.array([1.0, None]))
+
+
+def test_to_arrow_raises_with_variances():
+    with pytest.raises(sc.VariancesError):
+        to_arrow(sc.array(dims=['x'], values=[1.0], variances=[1.0]))
+
+
+def test_round_trip_binned():
+    table = sc.data.table_xyz(100)
+    table.masks['m'] = table.coords['x'] > sc.scalar(0.5, unit='m')
+    binned = table.bin(x=4)
+    array = to_arrow(binned.data)
+    assert pa.types.is_large_list(array.type)
+    assert array.type.value_type.get_field_index('data') >= 0
+    result = from_arrow(array)
+    assert sc.identical(result, binned.data)
+
+
+def test_to_arrow_raises_with_multi_dimensional_binned():
+    binned = sc.data.table_xyz(100).bin(x=2, y=2)
+    with pytest.raises(sc.DimensionError):
+        to_arrow(binned.data)
+    assert sc.identical(from_arrow(to_arrow(binned.data.flatten(to='xy'))),
+                        binned.data.flatten(to='xy'))
+
+
+def test_from_arrow_list_of_struct_without_metadata():
+    array = pa.array([[{'x': 1.0, 'data': 2.0}], [], [{'x': 3.0, 'data': 4.0}]],
+                     type=pa.large_list(
+                         pa.struct([('x', pa.float64()), ('data', pa.float64())])))
+    var = from_arrow(array)
+    assert var.dims == ('row', )
+    assert var.bins.size().values.tolist() == [1, 0, 1]
+    assert sc.identical(var.bins.constituents['data'].coords['x'],
+                        sc.array(dims=['event'], values=[1.0, 3.0]))
@@ -84,6 +84,69 @@ def test_dtype_numpy_element_type_construction():
     assert sc.DType(np.int32) == sc.DType.int32
 
 
+NARROW_NUMERIC_DTYPES = ('int8', 'int16', 'uint8', 'uint16', 'uint32', 'uint64',
+                         'float16')
+
+
+@pytest.mark.parametrize('name', NARROW_NUMERIC_DTYPES)
+def test_narrow_dtype_numpy_construction(name):
+    assert sc.DType(np.dtype(name)) == getattr(sc.DType, name)
+    assert sc.DType(name) == name
+    assert getattr(sc.DType, name) == np.dtype(name)
+
+
+@pytest.mark.parametrize('name', NARROW_NUMERIC_DTYPES)
+def test_narrow_dtype_values_roundtrip(name):
+    values = np.arange(6, dtype=name).reshape(2, 3)
+    var = sc.array(dims=['x', 'y'], values=values)
+    assert var.dtype == name
+    assert var.unit == sc.units.dimensionless
+    assert var.values.dtype == np.dtype(name)
+    np.testing.assert_array_equal(var.values, values)
+    assert sc.identical(var.copy(), var)
+    assert sc.identical(sc.concat([var, var], 'x')['x', 2:], var)
+
+
+@pytest.mark.parametrize('name', NARROW_NUMERIC_DTYPES)
+def test_narrow_dtype_scalar(name):
+    var = sc.scalar(np.dtype(name).type(7))
+    assert var.dtype == name
+    assert var.value == 7
+    var.value = 3
+    assert var.value == 3
+
+
+@pytest.mark.parametrize('name', NARROW_NUMERIC_DTYPES)
+def test_narrow_dtype_astype(name):
+    var = sc.array(dims=['x'], values=[1.0, 2.0, 100.0])
+    narrow = var.astype(name)
+    assert narrow.dtype == name
+    assert sc.identical(narrow.astype('float64'), var)
+    assert sc.identical(narrow.astype('int64'), var.astype('int64'))
+
+
+def test_float16_rounds_on_storage():
+    var = sc.array(dims=['x'], values=[1.0, 2049.0, 1e6], dtype='float16')
+    np.testing.assert_array_equal(var.values,
+                                  np.array([1.0, 2049.0, 1e6], dtype=np.float16))
+
+
+def test_float16_cannot_have_variances():
+    with pytest.raises(sc.VariancesError):
+        sc.array(dims=['x'], values=[1.0], variances=[1.0], dtype='float16')
+
+
+@pytest.mark.parametrize('name', ('int8', 'int16', 'uint8', 'uint16', 'uint32'))
+def test_sum_of_narrow_integers_is_int64(name):
+    var = sc.array(dims=['x'], values=np.full(1000, 100, dtype=name))
+    assert sc.identical(var.sum(), sc.scalar(100000))
+
+
+def test_sum_of_float16_is_float32():
+    var = sc.array(dims=['x'], values=np.full(1000, 100, dtype='float16'))
+    assert sc.identical(var.sum(), sc.scalar(100000, dtype='float32'))
+
+
 def test_repr():
     assert repr(sc.DType('int32')) == "DType('int32')"
     assert repr(sc.DType('float')) == "DType('float64')"
@@ -0,0 +1,65 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+# @author Simon Heybrock
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+import pytest
+
+import scipp as sc
+
+
+@pytest.fixture
+def restore_num_threads():
+    yield
+    sc.set_num_threads()
+
+
+def test_default_num_threads_is_positive():
+    assert sc.get_num_threads() >= 1
+
+
+def test_set_num_threads(restore_num_threads):
+    sc.set_num_threads(2)
+    assert sc.get_num_threads() == 2
+    sc.set_num_threads()
+    assert sc.get_num_threads() >= 1
+
+
+def test_set_num_threads_rejects_non_positive(restore_num_threads):
+    with pytest.raises(ValueError):
+        sc.set_num_threads(0)
+    with pytest.raises(ValueError):
+        sc.set_num_threads(-1)
+
+
+@pytest.mark.parametrize("n", [1, 3])
+def test_results_do_not_depend_on_num_threads(restore_num_threads, n):
+    var = sc.array(dims=['x', 'y'], values=np.arange(1e6).reshape(1000, 1000))
+    expected = sc.sum(var, 'x')
+    sc.set_num_threads(n)
+    assert sc.identical(sc.sum(var, 'x'), expected)
+    assert sc.identical(var + var, 2.0 * var)
+
+
+@pytest.mark.parametrize("n", [1, 3, 7])
+def test_float_sums_do_not_depend_on_num_threads(restore_num_threads, n):
+    rng = np.random.default_rng(1234)
+    var = sc.array(dims=['x', 'y'], values=rng.random((100_000, 10)))
+    expected_outer = sc.sum(var, 'x')
+    expected_all = sc.sum(var)
+    expected_mean = sc.mean(var, 'x')
+    sc.set_num_threads(n)
+    assert sc.identical(sc.sum(var, 'x'), expected_outer)
+    assert sc.identical(sc.sum(var), expected_all)
+    assert sc.identical(sc.mean(var, 'x'), expected_mean)
+
+
+def test_concurrent_calls_with_single_thread(restore_num_threads):
+    tables = [sc.data.table_xyz(10_000) for _ in range(8)]
+    expected = [table.hist(x=10, y=10) for table in tables]
+    sc.set_num_threads(1)
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        results = list(executor.map(lambda t: t.hist(x=10, y=10), tables))
+    for result, reference in zip(results, expected):
+        assert sc.allclose(result.data, reference.data)
@@ -0,0 +1,107 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+# @file
+import scipp as sc
+import numpy as np
+import pytest
+import sys
+
+
+def roundtrip(obj, path, mmap):
+    name = path / 'test.scipp'
+    sc.io.save(obj, name)
+    return sc.io.load(name, mmap=mmap)
+
+
+x = sc.Variable(dims=['x'], values=np.arange(4.0), unit=sc.units.m)
+y = sc.Variable(dims=['y'], values=np.arange(6.0), unit=sc.units.angstrom)
+xy = sc.Variable(dims=['y', 'x'],
+                 values=np.random.rand(6, 4),
+                 variances=np.random.rand(6, 4),
+                 unit=sc.units.kg)
+da = sc.DataArray(xy,
+                  coords={
+                      'x': x,
+                      'y': y
+                  },
+                  masks={'m': sc.array(dims=['x'], values=[True, False, True, True])},
+                  attrs={'a': sc.scalar('abc')})
+
+
+@pytest.fixture(params=[True, False], ids=['mmap', 'read'])
+def mmap(request):
+    return request.param
+
+
+@pytest.mark.parametrize('var', [
+    x, xy, xy['x', 1:3], xy.transpose(),
+    sc.scalar(1, unit=None),
+    sc.array(dims=['x'], values=['a', '', 'äöü']),
+    sc.array(dims=['x'], values=['a', '', 'a'], dtype=sc.DType.categorical_string),
+    sc.array(dims=['x'], values=[True, False]),
+    sc.datetimes(dims=['x'], values=[0, 1000], unit='s'),
+    sc.vectors(dims=['x'], values=np.random.rand(4, 3), unit='m'),
+    sc.spatial.linear_transforms(dims=['x'], values=np.random.rand(4, 3, 3))
+])
+def test_variable(tmp_path, mmap, var):
+    assert sc.identical(roundtrip(var, tmp_path, mmap), var)
+
+
+def test_data_array(tmp_path, mmap):
+    assert sc.identical(roundtrip(da, tmp_path, mmap), da)
+
+
+def test_dataset(tmp_path, mmap):
+    ds = sc.Dataset(data={'a': da, 'b': y * y})
+    assert sc.identical(roundtrip(ds, tmp_path, mmap), ds)
+
+
+def test_binned(tmp_path, mmap):
+    table = sc.data.table_xyz(100)
+    binned = table.bin(x=4, y=3)
+    assert sc.identical(roundtrip(binned, tmp_path, mmap), binned)
+    assert sc.identical(roundtrip(binned['x', 1:3], tmp_path, mmap),
+                        binned['x', 1:3].copy())
+
+
+def test_loaded_object_can_be_modified(tmp_path, mmap):
+    loaded = roundtrip(da, tmp_path, mmap)
+    loaded.values[0, 0] = 100.0
+    assert sc.identical(sc.io.load(tmp_path / 'test.scipp'), da)
+
+
+def _mapped_ranges(path):
+    ranges = []
+    with open('/proc/self/maps') as maps:
+        for line in maps:
+            if line.rstrip().endswith(str(path)):
+                begin, end = line.split()[0].split('-')
+                ranges.append((int(begin, 16), int(end, 16)))
+    return ranges
+
+
+@pytest.mark.skipif(not sys.platform.startswith('linux'),
+                    reason='Requires /proc/self/maps')
+def test_values_of_mapped_object_use_mapping_without_copy(tmp_path):
+    name = tmp_path / 'test.scipp'
+    sc.io.save(xy, name)
+    loaded = sc.io.load(name, mmap=True)
+    values = loaded.values
+    values[0, 0] = -1.0
+    address = values.__array_interface__['data'][0]
+    assert any(begin <= address < end for begin, end in _mapped_ranges(name.resolve()))
+    assert loaded.values.__array_interface__['data'][0] == address
+    assert sc.identical(sc.io.load(name), xy)
+
+
+def test_loaded_object_can_be_saved_to_same_file(tmp_path, mmap):
+    loaded = roundtrip(da, tmp_path, mmap)
+    sc.io.save(loaded, tmp_path / 'test.scipp')
+    assert sc.identical(loaded, da)
+    assert sc.identical(sc.io.load(tmp_path / 'test.scipp', mmap=mmap), da)
+    assert [p.name for p in tmp_path.iterdir()] == ['test.scipp']
+
+
+def test_unsupported_dtype_raises(tmp_path):
+    with pytest.raises(sc.DTypeError):
+        sc.io.save(sc.scalar({'a': 1}), tmp_path / 'test.scipp')
@@ -9,6 +9,7 @@ import numpy as np
 import tempfile
 import h5py
 import os
+import pytest
 
 
 def roundtrip(obj):
@@ -200,6 +201,15 @@ def test_data_array_dtype_string():
     check_roundtrip(a['x', 0])
 
 
+def test_variable_categorical_string():
+    var = sc.array(dims=['x'],
+                   values=['bank1', '', 'bank2', 'bank1'],
+                   dtype=sc.DType.categorical_string)
+    result = check_roundtrip(var)
+    assert result.dtype == sc.DType.categorical_string
+    check_roundtrip(var['x', 2])
+
+
 def test_data_array_unsupported_PyObject_coord():
     obj = sc.scalar(dict())
     a = sc.DataArray(data=x, coords={'obj': obj})
@@ -302,3 +312,129 @@ def test_unicode_is_escaped_in_names():
     assert_is_valid_hdf5_name(collection_element_name('λ', 1))
     assert_is_valid_hdf5_name(collection_element_name('Å/travel_time', 2))
     assert_is_valid_hdf5_name(collection_element_name('λ in Å', 3))
+
+
+def test_compressed_roundtrip_is_readable_by_h5py():
+    da = sc.DataArray(data=sc.arange('x', 100000.0, unit='counts').fold(
+        dim='x', sizes={
+            'y': 100,
+            'x': 1000
+        }),
+                      coords={'x': sc.arange('x', 1001.0, unit='m')})
+    with tempfile.TemporaryDirectory() as path:
+        name = f'{path}/test.hdf5'
+        da.to_hdf5(filename=name,
+                   compression='gzip',
+                   compression_opts=6,
+                   shuffle=True,
+                   chunk_size=8192)
+        assert sc.identical(sc.io.open_hdf5(filename=name), da)
+        with h5py.File(name, 'r') as f:
+            assert f['data/values'].compression == 'gzip'
+            assert f['data/values'].shuffle
+            assert sc.identical(sc.io.hdf5.HDF5IO.read(f), da)
+
+
+def test_file_written_by_h5py_is_readable():
+    with tempfile.TemporaryDirectory() as path:
+        name = f'{path}/test.hdf5'
+        with h5py.File(name, 'w') as f:
+            sc.io.hdf5.HDF5IO.write(f, array_2d)
+        assert sc.identical(sc.io.open_hdf5(filename=name), array_2d)
+
+
+def test_open_hdf5_slices():
+    with tempfile.TemporaryDirectory() as path:
+        name = f'{path}/test.hdf5'
+        array_2d.to_hdf5(filename=name)
+        for slices in [{'x': 1}, {'x': -1}, {'y': slice(1, 4)}, {'x': slice(2, None)},
+                       {'x': 0, 'y': slice(None, 2)}]:
+            expected = array_2d
+            for dim, s in slices.items():
+                expected = expected[dim, s]
+            assert sc.identical(sc.io.open_hdf5(filename=name, slices=slices),
+                                expected.copy())
+
+
+def test_open_hdf5_slices_with_h5py_fallback():
+    a = sc.DataArray(data=x, coords={'variable': sc.scalar(x)})
+    with tempfile.TemporaryDirectory() as path:
+        name = f'{path}/test.hdf5'
+        a.to_hdf5(filename=name)
+        assert sc.identical(sc.io.open_hdf5(filename=name, slices={'x': slice(1, 3)}),
+                            a['x', 1:3].copy())
+
+
+def test_open_hdf5_slices_with_stride_raises():
+    with tempfile.TemporaryDirectory() as path:
+        name = f'{path}/test.hdf5'
+        x.to_hdf5(filename=name)
+        with pytest.raises(ValueError):
+            sc.io.open_hdf5(filename=name, slices={'x': slice(None, None, 2)})
+        with pytest.raises(sc.DimensionError):
+            sc.io.open_hdf5(filename=name, slices={'y': 0})
+
+
+def test_open_hdf5_lazy_reads_only_on_access():
+    with tempfile.TemporaryDirectory() as path:
+        name = f'{path}/test.hdf5'
+        array_2d.to_hdf5(filename=name)
+        lazy = sc.io.open_hdf5(filename=name, lazy=True)
+        assert lazy.sizes == array_2d.sizes
+        sliced = lazy['y', 1:5]['x', 1:]['y', -1]
+        assert sliced.sizes == {'x': 3}
+        assert sliced._loaded is None
+        assert sc.identical(sliced.load(), array_2d['y', 1:5]['x', 1:]['y', -1].copy())
+        assert sc.identical(sliced.data, array_2d['y', 4]['x', 1:].data)
+
+
+def test_open_hdf5_lazy_label_based_slicing():
+    with tempfile.TemporaryDirectory() as path:
+        name = f'{path}/test.hdf5'
+        array_2d.to_hdf5(filename=name)
+        lazy = sc.io.open_hdf5(filename=name, lazy=True)
+        start = 1.0 * sc.units.m
+        stop = 3.0 * sc.units.m
+        assert sc.identical(lazy['x', start:stop].load(),
+                            array_2d['x', start:stop].copy())
+        assert sc.identical(lazy['x', start].load(), array_2d['x', start].copy())
+        with pytest.raises(sc.DimensionError):
+            lazy['z', start]
+
+
+def test_open_hdf5_lazy_arithmetic_loads():
+    with tempfile.TemporaryDirectory() as path:
+        name = f'{path}/test.hdf5'
+        x.to_hdf5(filename=name)
+        lazy = sc.io.open_hdf5(filename=name, lazy=True)['x', 1:3]
+        assert sc.identical(lazy * 2.0, x['x', 1:3] * 2.0)
+        assert sc.identical(-lazy, -x['x', 1:3])
+
+
+def test_open_hdf5_lazy_free_functions_require_load():
+    with tempfile.TemporaryDirectory() as path:
+        name = f'{path}/test.hdf5'
+        x.to_hdf5(filename=name)
+        lazy = sc.io.open_hdf5(filename=name, lazy=True)['x', 1:3]
+        with pytest.raises(TypeError):
+            sc.sum(lazy)
+        assert sc.identical(sc.sum(lazy.load()), sc.sum(x['x', 1:3]))
+
+
+def test_open_hdf5_lazy_label_based_slicing_fallback_finds_same_positions():
+    from scipp.io.hdf5 import _label_slice_params_in_memory
+    with tempfile.TemporaryDirectory() as path:
+        name = f'{path}/test.hdf5'
+        array_2d.to_hdf5(filename=name)
+        lazy = sc.io.open_hdf5(filename=name, lazy=True)['y', 1:5]
+        start = 1.0 * sc.units.m
+        stop = 3.0 * sc.units.m
+        for params in [
+                dict(value=start),
+                dict(begin=start, end=stop),
+                dict(begin=start, end=None),
+                dict(begin=None, end=stop)
+        ]:
+            expected = sc._scipp.core._hdf5_slice_params(name, lazy._params(), 'x',
+                                                         **params)
+            assert _label_slice_params_in_memory(lazy.load(), 'x', **params) == expected
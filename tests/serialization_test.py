@@ -1,13 +1,101 @@
 # SPDX-License-Identifier: BSD-3-Clause
 # Copyright (c) 2022 Scipp contributors (https://github.com/scipp)
+import pickle
+
+import numpy as np
+import pytest
 import scipp as sc
 from scipp.serialization import serialize, deserialize
 
 
+def _writable(frames):
+    return [bytearray(frame) for frame in frames]
+
+
+def _make_data_array():
+    da = sc.data.table_xyz(10)
+    da.variances = da.values
+    da.masks['m'] = da.coords['x'] > sc.scalar(0.5, unit='m')
+    da.attrs['label'] = sc.array(dims=['row'], values=[str(i) for i in range(10)])
+    da.attrs['bank'] = sc.array(dims=['row'],
+                                values=[f'bank{i % 3}' for i in range(10)],
+                                dtype=sc.DType.categorical_string)
+    da.coords['time'] = sc.datetimes(dims=['row'], values=np.arange(10), unit='ns')
+    da.coords['pos'] = sc.vectors(dims=['row'], values=np.ones((10, 3)), unit='m')
+    return da
+
+
 def test_serialize_roundtrip():
-    # No detailed testing since this is currently just using HDF5IO internally
     da = sc.data.binned_x(nevent=10, nbin=2)
     ds = sc.Dataset(data={'a': da})
     assert sc.identical(deserialize(*serialize(da.data)), da.data)
     assert sc.identical(deserialize(*serialize(da)), da)
     assert sc.identical(deserialize(*serialize(ds)), ds)
+
+
+def test_serialize_roundtrip_dtypes_and_metadata():
+    da = _make_data_array()
+    assert sc.identical(deserialize(*serialize(da)), da)
+
+
+def test_serialize_roundtrip_slice():
+    da = _make_data_array()['row', 1::2]
+    assert sc.identical(deserialize(*serialize(da)), da)
+
+
+def test_serialize_roundtrip_dataset():
+    ds = sc.Dataset(data={'a': _make_data_array(), 'b': _make_data_array() * 2.0})
+    assert sc.identical(deserialize(*serialize(ds)), ds)
+
+
+def test_serialize_does_not_copy():
+    var = sc.arange('x', 10.0, unit='m')
+    header, frames = serialize(var)
+    assert len(frames) == 1
+    assert frames[0].__array_interface__['data'][0] == \
+        var.values.__array_interface__['data'][0]
+
+
+def test_deserialize_writable_frames_does_not_copy():
+    header, frames = serialize(sc.arange('x', 10.0, unit='m'))
+    frames = _writable(frames)
+    var = deserialize(header, frames)
+    var.values[2] = -1.0
+    assert np.frombuffer(frames[0], dtype=np.float64)[2] == -1.0
+
+
+def test_deserialize_readonly_frames_copies():
+    original = sc.arange('x', 10.0, unit='m')
+    header, frames = serialize(original)
+    var = deserialize(header, [bytes(frame) for frame in frames])
+    var.values[2] = -1.0
+    assert original.values[2] == 2.0
+
+
+def test_serialize_falls_back_to_hdf5_for_unsupported_dtypes():
+    pytest.importorskip('h5py')
+    var = sc.scalar(sc.arange('x', 3))
+    header, frames = serialize(var)
+    assert 'scipp' not in header
+    assert sc.identical(deserialize(header, frames), var)
+
+
+@pytest.mark.parametrize('protocol', range(2, pickle.HIGHEST_PROTOCOL + 1))
+def test_pickle_roundtrip(protocol):
+    da = _make_data_array()
+    assert sc.identical(pickle.loads(pickle.dumps(da, protocol=protocol)), da)
+    binned = sc.data.binned_x(nevent=10, nbin=2)
+    ds = sc.Dataset(data={'a': binned})
+    assert sc.identical(pickle.loads(pickle.dumps(ds, protocol=protocol)), ds)
+    assert sc.identical(pickle.loads(pickle.dumps(binned.data, protocol=protocol)),
+                        binned.data)
+
+
+def test_pickle_out_of_band_buffers_are_not_copied():
+    var = sc.arange('x', 100000.0, unit='m')
+    buffers = []
+    data = pickle.dumps(var, protocol=5, buffer_callback=buffers.append)
+    assert len(buffers) == 1
+    assert len(data) < var.values.nbytes
+    result = pickle.loads(data, buffers=[bytearray(b) for b in buffers])
+    assert sc.identical(result, var)
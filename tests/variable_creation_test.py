@@ -590,6 +590,54 @@ def test_arange_with_variables_mixed_dtype():
         sc.array(dims=['x'], values=[1, 2, 3], dtype='int64'))
 
 
+_range_dtypes = ('float64', 'float32', 'float16', 'int64', 'int32', 'int16', 'int8',
+                 'uint64', 'uint32', 'uint16', 'uint8')
+
+
+@pytest.mark.parametrize('dtype', _range_dtypes)
+def test_arange_supports_dtype(dtype):
+    var = sc.arange('x', 0, 5, dtype=dtype)
+    assert sc.identical(var, sc.array(dims=['x'], values=[0, 1, 2, 3, 4], dtype=dtype))
+
+
+@pytest.mark.parametrize('dtype', _range_dtypes)
+def test_linspace_supports_dtype(dtype):
+    var = sc.linspace('x', 0, 4, num=5, dtype=dtype)
+    assert sc.identical(var, sc.array(dims=['x'], values=[0, 1, 2, 3, 4], dtype=dtype))
+
+
+def test_arange_supports_datetime64():
+    var = sc.arange('t', np.datetime64(1, 's'), np.datetime64(5, 's'))
+    assert var.dtype == sc.DType.datetime64
+    assert sc.islinspace(var).value
+
+
+def test_linspace_is_no_longer_linspace_after_modification():
+    var = sc.linspace('x', 0.0, 1.0, num=5)
+    assert sc.islinspace(var).value
+    var.values[1] = 0.5
+    assert not sc.islinspace(var).value
+    assert sc.islinspace(var['x', 2:]).value
+
+
+def test_arange_is_no_longer_linspace_after_setitem():
+    var = sc.arange('x', 0.0, 4.0)
+    var['x', 1] = sc.scalar(3.0)
+    assert not sc.islinspace(var).value
+
+
+def test_islinspace_sees_modification_through_retained_numpy_array():
+    var = sc.linspace('x', 0.0, 1.0, num=5)
+    values = var.values
+    assert sc.islinspace(var).value
+    assert sc.issorted(var, 'x').value
+    assert var.max().value == 1.0
+    values[1] = 2.0
+    assert not sc.islinspace(var).value
+    assert not sc.issorted(var, 'x').value
+    assert var.max().value == 2.0
+
+
 def test_zeros_sizes():
     dims = ['x', 'y', 'z']
     shape = [2, 3, 4]
@@ -80,3 +80,118 @@ def test_nanmean():
     assert sc.identical(sc.nanmean(var), sc.scalar(3.0 / 3))
     assert sc.identical(sc.nanmean(var, 'x'), sc.Variable(dims=['y'], values=[1.0,
                                                                               1.0]))
+
+
+def test_reductions_over_multiple_dims():
+    var = sc.Variable(dims=['x', 'y', 'z'],
+                      values=np.arange(24.0).reshape(2, 3, 4),
+                      unit='m')
+    for op in [sc.sum, sc.nansum, sc.mean, sc.nanmean, sc.min, sc.max, sc.nanmin,
+               sc.nanmax]:
+        assert sc.allclose(op(var, ['x', 'z']), op(op(var, 'x'), 'z'))
+        assert sc.identical(op(var, ('x', 'y', 'z')), op(var))
+    flags = var < 10.0 * sc.Unit('m')
+    assert sc.identical(sc.all(flags, ['x', 'z']), sc.all(sc.all(flags, 'x'), 'z'))
+    assert sc.identical(sc.any(flags, ['y', 'z']), sc.any(sc.any(flags, 'y'), 'z'))
+
+
+def test_sum_float32_over_multiple_dims_casts_once():
+    var = sc.Variable(dims=['x', 'y'],
+                      values=np.full((1000, 1000), 0.1, dtype=np.float32))
+    result = sc.sum(var, ['x', 'y'])
+    assert result.dtype == sc.DType.float32
+    assert result.value == np.float32(np.sum(var.values, dtype=np.float64))
+
+
+def test_mean_over_multiple_dims_data_array_respects_masks():
+    da = sc.DataArray(
+        sc.Variable(dims=['x', 'y'], values=[[1.0, 2.0, np.nan], [4.0, 5.0, 6.0]]),
+        masks={'m': sc.Variable(dims=['x', 'y'],
+                                values=[[False, True, False], [False, False, True]])})
+    assert sc.identical(sc.sum(da, ['x', 'y']).data, sc.scalar(np.nan))
+    assert sc.identical(sc.nansum(da, ['x', 'y']).data, sc.scalar(10.0))
+    assert sc.identical(sc.nanmean(da, ['x', 'y']).data, sc.scalar(10.0 / 3))
+    assert sc.identical(sc.max(da, ['y', 'x']).data, sc.scalar(5.0))
+
+
+def test_reductions_over_multiple_dims_data_array_and_dataset():
+    da = sc.DataArray(sc.Variable(dims=['x', 'y', 'z'],
+                                  values=np.arange(24.0).reshape(2, 3, 4),
+                                  unit='m'),
+                      coords={
+                          'x': sc.arange('x', 2.0),
+                          'z': sc.arange('z', 4.0)
+                      },
+                      masks={
+                          'x': sc.array(dims=['x'], values=[False, True]),
+                          'y': sc.array(dims=['y'], values=[True, False, False])
+                      })
+    for op in [sc.sum, sc.nansum, sc.mean, sc.nanmean, sc.max, sc.nanmin]:
+        result = op(da, ['x', 'y'])
+        assert sc.allclose(result.data, op(op(da, 'x'), 'y').data)
+        assert set(result.coords) == {'z'}
+        assert set(result.masks) == set()
+        ds = sc.Dataset(data={'a': da})
+        assert sc.identical(op(ds, ['x', 'y'])['a'], result)
+    assert sc.identical(
+        sc.mean(da, ['x', 'y']).data,
+        sc.array(dims=['z'], values=[6.0, 7.0, 8.0, 9.0], unit='m'))
+
+
+def test_median():
+    var = sc.Variable(dims=['x', 'y'],
+                      values=np.array([[5.0, 1.0, 3.0], [4.0, 6.0, 2.0]]))
+    assert sc.identical(sc.median(var), sc.scalar(np.median(var.values)))
+    assert sc.identical(sc.median(var, 'y'), sc.Variable(dims=['x'], values=[3.0, 4.0]))
+    assert sc.identical(var.median('x'),
+                        sc.Variable(dims=['y'], values=np.median(var.values, axis=0)))
+
+
+def test_nanmedian():
+    var = sc.Variable(dims=['x'], values=[1.0, np.nan, 3.0, 4.0])
+    assert np.isnan(sc.median(var).value)
+    assert sc.identical(sc.nanmedian(var), sc.scalar(3.0))
+    assert sc.identical(sc.nanmedian(var, 'x'), sc.scalar(3.0))
+
+
+def test_quantile():
+    values = np.random.default_rng(1234).random(101)
+    var = sc.Variable(dims=['x'], values=values)
+    for q in [0.0, 0.1, 0.25, 0.5, 0.9, 1.0]:
+        assert sc.allclose(sc.quantile(var, q), sc.scalar(np.quantile(values, q)))
+    assert sc.identical(sc.quantile(var, 0.5, 'x'), sc.median(var))
+
+
+def test_median_data_array_ignores_masked():
+    da = sc.DataArray(
+        sc.Variable(dims=['x'], values=[1.0, 100.0, 2.0, 3.0]),
+        masks={'m': sc.Variable(dims=['x'], values=[False, True, False, False])})
+    assert sc.identical(sc.median(da).data, sc.scalar(2.0))
+    assert sc.identical(da.median('x').data, sc.scalar(2.0))
+
+
+def test_argmin_argmax():
+    var = sc.Variable(dims=['x', 'y'],
+                      values=np.array([[5.0, 1.0, 3.0], [4.0, 6.0, 2.0]]))
+    assert sc.identical(sc.argmin(var, 'y'),
+                        sc.Variable(dims=['x'], values=[1, 2], unit=None))
+    assert sc.identical(var.argmax('x'),
+                        sc.Variable(dims=['y'], values=[0, 1, 0], unit=None))
+    assert np.array_equal(sc.argmax(var, 'y').values, np.argmax(var.values, axis=1))
+
+
+def test_argmax_data_array_skips_masked():
+    da = sc.DataArray(
+        sc.Variable(dims=['x'], values=[1.0, 100.0, 2.0, 3.0]),
+        masks={'m': sc.Variable(dims=['x'], values=[False, True, False, False])})
+    assert sc.identical(da.argmax('x').data, sc.index(3))
+    assert sc.identical(da.argmin('x').data, sc.index(0))
+
+
+def test_topk():
+    var = sc.Variable(dims=['x', 'y'],
+                      values=np.array([[5.0, 1.0, 3.0], [4.0, 6.0, 2.0]]),
+                      unit='m')
+    assert sc.identical(
+        sc.topk(var, 2, 'y'),
+        sc.Variable(dims=['x', 'y'], values=[[5.0, 3.0], [6.0, 4.0]], unit='m'))
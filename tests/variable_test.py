@@ -201,6 +201,51 @@ def test_2D_access_variances():
     assert np.array_equal(var.variances, np.ones(shape=shape))
 
 
+def test_5D_access():
+    values = np.arange(2 * 3 * 4 * 5 * 6.0).reshape(2, 3, 4, 5, 6)
+    var = sc.Variable(dims=['a', 'b', 'c', 'd', 'e'], values=values)
+    assert np.array_equal(var.values, values)
+
+
+@pytest.mark.parametrize('index', [
+    (slice(None, None, 2), ), (slice(None, None, -1), ),
+    (slice(None), slice(1, 4), slice(None, None, -2)), (1, slice(None), 0)
+])
+def test_create_from_strided_numpy_array(index):
+    values = np.arange(4 * 5 * 6).reshape(4, 5, 6)[index]
+    var = sc.Variable(dims=['x', 'y', 'z'][:values.ndim], values=values)
+    assert np.array_equal(var.values, values)
+
+
+def test_set_values_from_transposed_numpy_array():
+    values = np.arange(4 * 5 * 6.0).reshape(4, 5, 6)
+    var = sc.zeros(dims=['z', 'y', 'x'], shape=(6, 5, 4))
+    var.values = values.T
+    assert np.array_equal(var.values, values.T)
+    var['y', 1:3].values = values.T[:, :2]
+    assert np.array_equal(var['y', 1:3].values, values.T[:, :2])
+
+
+def test_set_values_of_transposed_variable():
+    values = np.arange(4 * 5.0).reshape(4, 5)
+    var = sc.zeros(dims=['x', 'y'], shape=(4, 5)).transpose()
+    var.values = values.T
+    assert np.array_equal(var.values, values.T)
+    assert np.array_equal(var.transpose().values, values)
+
+
+def test_set_values_from_own_values_reversed():
+    var = sc.arange('x', 10.0)
+    var.values = var.values[::-1]
+    assert np.array_equal(var.values, np.arange(10.0)[::-1])
+
+
+def test_datetime_from_strided_numpy_array():
+    values = np.arange(24, dtype='datetime64[s]').reshape(4, 6)[::2, ::-3]
+    var = sc.Variable(dims=['x', 'y'], values=values, unit='s')
+    assert np.array_equal(var.values, values)
+
+
 def test_getitem_element():
     var = sc.arange('a', 0, 8).fold('a', {'x': 2, 'y': 4})
     for i in range(var.sizes['x']):